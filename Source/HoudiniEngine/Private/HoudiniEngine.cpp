@@ -29,6 +29,9 @@
 
 #include "HoudiniApi.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniGeoImporter.h"
+#include "UnrealLandscapeTranslator.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineScheduler.h"
@@ -36,6 +39,7 @@
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniPackageParams.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -333,6 +337,9 @@ FHoudiniEngine::ShutdownModule()
 
 	FHoudiniApi::FinalizeHAPI();
 
+	// Stop listening to the asset registry
+	FHoudiniPackageParams::ResetPackageNameIndex();
+
 	FHoudiniEngine::HoudiniEngineInstance = nullptr;
 }
 
@@ -750,6 +757,11 @@ FHoudiniEngine::InitializeHAPISession()
 		return false;
 	}
 
+	// Strings from a previous session are invalid
+	FHoudiniEngineString::ClearStringCache();
+	UHoudiniGeoImporter::ResetReusableBGEONode();
+	FUnrealLandscapeTranslator::ClearAllLandscapeUploadCaches();
+
 	// Now, initialize HAPI with the new session
 	// We need to make sure HAPI version is correct.
 	int32 RunningEngineMajor = 0;
@@ -853,6 +865,9 @@ FHoudiniEngine::OnSessionLost()
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Lost);
+	FHoudiniEngineString::ClearStringCache();
+	UHoudiniGeoImporter::ResetReusableBGEONode();
+	FUnrealLandscapeTranslator::ClearAllLandscapeUploadCaches();
 
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
@@ -889,6 +904,9 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
 	bEnableSessionSync = false;
+	FHoudiniEngineString::ClearStringCache();
+	UHoudiniGeoImporter::ResetReusableBGEONode();
+	FUnrealLandscapeTranslator::ClearAllLandscapeUploadCaches();
 
 	HoudiniEngineManager->StopHoudiniTicking();
 
@@ -1319,6 +1337,14 @@ FHoudiniEngine::GetPDGCommandletStatus()
 	return EHoudiniBGEOCommandletStatus::NotStarted;
 }
 
+FHoudiniBGEOCommandletPoolStats
+FHoudiniEngine::GetPDGCommandletPoolStats()
+{
+	if (HoudiniEngineManager)
+		return HoudiniEngineManager->GetPDGCommandletPoolStats();
+	return FHoudiniBGEOCommandletPoolStats();
+}
+
 void
 FHoudiniEngine::UnregisterPostEngineInitCallback()
 {
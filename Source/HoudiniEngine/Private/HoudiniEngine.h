@@ -43,6 +43,7 @@ class UMaterial;
 struct FSlateDynamicImageBrush;
 
 enum class EHoudiniBGEOCommandletStatus : uint8;
+struct FHoudiniBGEOCommandletPoolStats;
 
 UENUM()
 enum class EHoudiniSessionStatus : int8
@@ -239,6 +240,9 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		EHoudiniBGEOCommandletStatus GetPDGCommandletStatus();
 
+		// Returns the import throughput / queue depth of the PDG commandlet worker pool
+		FHoudiniBGEOCommandletPoolStats GetPDGCommandletPoolStats();
+
 		FHoudiniEngineManager* GetHoudiniEngineManager() { return HoudiniEngineManager; }
 
 		const FHoudiniEngineManager* GetHoudiniEngineManager() const { return HoudiniEngineManager; }
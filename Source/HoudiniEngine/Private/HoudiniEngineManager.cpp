@@ -38,7 +38,9 @@
 #include "HoudiniInputTranslator.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
+#include "HoudiniMeshTranslator.h"
 #include "HoudiniSplineTranslator.h"
+#include "UnrealLandscapeTranslator.h"
 
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -64,6 +66,14 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
 	TEXT("1.0: Default\n")
 );
 
+static TAutoConsoleVariable<float> CVarHoudiniEngineOutputProcessingTimeLimit(
+	TEXT("HoudiniEngine.OutputProcessingTimeLimit"),
+	0.1,
+	TEXT("Time budget per tick (in seconds) for translating the outputs of a cooked HDA. Remaining outputs are processed on the next ticks.\n")
+	TEXT("<= 0.0: No Limit, all outputs are processed at once\n")
+	TEXT("0.1: Default\n")
+);
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -85,6 +95,13 @@ FHoudiniEngineManager::~FHoudiniEngineManager()
 	PDGManager.StopBGEOCommandletAndEndpoint();
 }
 
+void
+FHoudiniEngineManager::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (auto& Pair : OutputProcessingStates)
+		Pair.Value.AddReferencedObjects(Collector);
+}
+
 void 
 FHoudiniEngineManager::StartHoudiniTicking()
 {
@@ -218,6 +235,16 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		CurrentIndex++;
 	}
 
+	// Cancel the output processing of components that have been destroyed
+	for (auto It = OutputProcessingStates.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || It.Key()->IsPendingKill())
+		{
+			FHoudiniOutputTranslator::CancelUpdateOutputs(nullptr, It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
 	// Sort the components by last tick time
 	ComponentsToProcess.Sort([](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B) { return A.LastTickTime < B.LastTickTime; });
 
@@ -351,6 +378,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
 				if (bShouldDeleteParent)
 					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete);
+
+				// Forget what was sent if this was a landscape heightfield input
+				FUnrealLandscapeTranslator::ClearLandscapeUploadCache(NodeIdToDelete);
 			}
 		}
 	}
@@ -451,6 +481,15 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		return;
 
 	const EHoudiniAssetState AssetStateToProcess = HAC->GetAssetState();
+
+	// The HAC can leave the output processing states from outside of the manager (ie, MarkAsNeedRebuild),
+	// cancel its output update before its nodes are rebuilt or deleted
+	if (AssetStateToProcess != EHoudiniAssetState::PostCook
+		&& AssetStateToProcess != EHoudiniAssetState::PreProcess
+		&& AssetStateToProcess != EHoudiniAssetState::Processing)
+	{
+		CancelOutputProcessing(HAC);
+	}
 	
 	// If cooking is paused, stay in the current state until cooking's resumed, unless we are in NewHDA
 	if (!FHoudiniEngine::Get().IsCookingEnabled() && AssetStateToProcess != EHoudiniAssetState::NewHDA)
@@ -485,6 +524,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			{
 				HAC->OnPrePreInstantiation();
 				HAC->bForceNeedUpdate = false;
+				HAC->SetHasPreviewOutputs(false);
 				// Update the HAC's state
 				HAC->SetAssetState(EHoudiniAssetState::PreInstantiation);
 			}
@@ -640,7 +680,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::Processing:
 		{
-			UpdateProcess(HAC);
+			// Stay in the processing state until all outputs have been processed
+			if (!UpdateProcess(HAC))
+				break;
 
 			int32 CookCount = FHoudiniEngineUtils::HapiGetCookCount(HAC->GetAssetId());
 			HAC->SetAssetCookCount(CookCount);
@@ -655,9 +697,25 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			// Do nothing unless the HAC has been updated
 			if (HAC->NeedUpdate())
 			{
-				HAC->bForceNeedUpdate = false;
-				// Update the HAC's state
-				HAC->SetAssetState(EHoudiniAssetState::PreCook);
+				// Wait for successive parameter/input edits to settle so they are merged in a single cook.
+				// World inputs and session sync are still updated below while waiting.
+				if (!HAC->IsWaitingForEditsToSettle())
+				{
+					// Cooks triggered by edits might only produce preview outputs
+					const bool bPreviewCook = HAC->ShouldCookInPreviewMode();
+					if (bPreviewCook)
+						HAC->PreviewOutputsEditTime = HAC->GetLastParameterOrInputEditTime();
+					HAC->SetHasPreviewOutputs(bPreviewCook);
+
+					HAC->bForceNeedUpdate = false;
+					// Update the HAC's state
+					HAC->SetAssetState(EHoudiniAssetState::PreCook);
+				}
+			}
+			else if (HAC->NeedPreviewOutputsRefinement())
+			{
+				// The edits have settled, fully process the outputs of the last preview cook
+				RefinePreviewOutputs(HAC);
 			}
 			else if (HAC->NeedTransformUpdate())
 			{
@@ -691,6 +749,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		{
 			StartTaskAssetRebuild(HAC->AssetId, HAC->HapiGUID);
 
+			HAC->SetHasPreviewOutputs(false);
 			HAC->MarkAsNeedCook();
 			HAC->SetAssetState(EHoudiniAssetState::PreInstantiation);
 			break;
@@ -702,6 +761,8 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			StartTaskAssetDelete(HAC->GetAssetId(), HapiDeletionGUID, true);
 				//HAC->AssetId = -1;
 
+			FHoudiniMeshTranslator::ClearDeduplicatedMeshSources(HAC);
+
 			// Update the HAC's state
 			HAC->SetAssetState(EHoudiniAssetState::Deleting);
 			break;
@@ -1159,7 +1220,6 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 		HAC->SetAssetCookCount(HAC->GetAssetCookCount()+1);
 	*/
 
-	bool bNeedsToTriggerViewportUpdate = false;
 	if (bCookSuccess)
 	{
 		FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString("Processing outputs..."), false);
@@ -1171,9 +1231,76 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 
 		FHoudiniInputTranslator::UpdateInputs(HAC);
 
-		bool bHasHoudiniStaticMeshOutput = false;
+		// Prepare the output processing, the outputs themselves will be 
+		// translated during the Processing state, possibly over multiple ticks.
 		bool ForceUpdate = HAC->HasRebuildBeenRequested() || HAC->HasRecookBeenRequested();
-		FHoudiniOutputTranslator::UpdateOutputs(HAC, ForceUpdate, bHasHoudiniStaticMeshOutput);
+		// If the outputs are processed over multiple ticks, keep the old ones until they've all been processed
+		const bool bKeepOldOutputs = CVarHoudiniEngineOutputProcessingTimeLimit.GetValueOnAnyThread() > 0.0f;
+		CancelOutputProcessing(HAC);
+		FHoudiniOutputProcessingState& ProcessingState = OutputProcessingStates.FindOrAdd(HAC);
+		if (!FHoudiniOutputTranslator::BeginUpdateOutputs(HAC, ForceUpdate, ProcessingState, bKeepOldOutputs))
+			OutputProcessingStates.Remove(HAC);
+	}
+	else
+	{
+		// TODO: Create parameters inputs and handles inputs.
+		//CreateParameters();
+		//CreateInputs();
+		//CreateHandles();
+
+		// Clear the bake after cook delegate if 
+		UHoudiniAssetComponent::FOnPostCookBakeDelegate& OnPostCookBakeDelegate = HAC->GetOnPostCookBakeDelegate();
+		if (OnPostCookBakeDelegate.IsBound() && !HAC->IsBakeAfterNextCookEnabled())
+		{
+			OnPostCookBakeDelegate.Unbind();
+			// Notify the user that the bake failed since the cook failed.
+			FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString("Cook failed, therefore the bake also failed..."), true);
+		}
+
+		FinishPostCook(HAC, false, false);
+	}
+
+	return bCookSuccess;
+}
+
+void
+FHoudiniEngineManager::CancelOutputProcessing(UHoudiniAssetComponent* HAC)
+{
+	FHoudiniOutputProcessingState* ProcessingState = OutputProcessingStates.Find(HAC);
+	if (!ProcessingState)
+		return;
+
+	FHoudiniOutputTranslator::CancelUpdateOutputs(HAC, *ProcessingState);
+	OutputProcessingStates.Remove(HAC);
+}
+
+bool
+FHoudiniEngineManager::ProcessOutputsWithinBudget(UHoudiniAssetComponent* HAC, const double& InTimeBudget)
+{
+	FHoudiniOutputProcessingState* ProcessingState = OutputProcessingStates.Find(HAC);
+	if (!ProcessingState)
+		return true;
+
+	const double StartTime = FPlatformTime::Seconds();
+	bool bFinished = false;
+	while (!bFinished)
+	{
+		bFinished = FHoudiniOutputTranslator::ProcessNextOutput(HAC, *ProcessingState);
+
+		// Always process at least one work unit per tick
+		if (InTimeBudget > 0.0 && (FPlatformTime::Seconds() - StartTime) > InTimeBudget)
+			break;
+	}
+
+	return bFinished;
+}
+
+void
+FHoudiniEngineManager::FinishPostCook(UHoudiniAssetComponent* HAC, const bool& bSuccess, const bool& bHasHoudiniStaticMeshOutput)
+{
+	bool bNeedsToTriggerViewportUpdate = false;
+	if (bSuccess)
+	{
 		HAC->SetNoProxyMeshNextCookRequested(false);
 
 		// Handles have to be updated after parameters
@@ -1223,22 +1350,6 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 				OnPostCookBakeDelegate.Unbind();
 		}
 	}
-	else
-	{
-		// TODO: Create parameters inputs and handles inputs.
-		//CreateParameters();
-		//CreateInputs();
-		//CreateHandles();
-
-		// Clear the bake after cook delegate if 
-		UHoudiniAssetComponent::FOnPostCookBakeDelegate& OnPostCookBakeDelegate = HAC->GetOnPostCookBakeDelegate();
-		if (OnPostCookBakeDelegate.IsBound() && !HAC->IsBakeAfterNextCookEnabled())
-		{
-			OnPostCookBakeDelegate.Unbind();
-			// Notify the user that the bake failed since the cook failed.
-			FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString("Cook failed, therefore the bake also failed..."), true);
-		}
-	}
 
 	if (HAC->InputPresets.Num() > 0)
 	{
@@ -1263,8 +1374,60 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 	HAC->SetRebuildRequested(false);
 
 	//HAC->SyncToBlueprintGeneratedClass();
+}
 
-	return bCookSuccess;
+bool
+FHoudiniEngineManager::RefinePreviewOutputs(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return false;
+
+	// The node has already been cooked with the latest values,
+	// we only need to run the output stages that were skipped by the preview cook.
+	HAC->SetHasPreviewOutputs(false);
+
+	if (!HAC->WasLastCookSuccessful() || HAC->GetAssetId() < 0)
+		return false;
+
+	FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString("Refining preview outputs..."), false);
+
+	HAC->OnPreOutputProcessing();
+
+	// The outputs are translated in the Processing state, possibly over multiple ticks
+	const bool bKeepOldOutputs = CVarHoudiniEngineOutputProcessingTimeLimit.GetValueOnAnyThread() > 0.0f;
+	CancelOutputProcessing(HAC);
+	FHoudiniOutputProcessingState& ProcessingState = OutputProcessingStates.FindOrAdd(HAC);
+	if (!FHoudiniOutputTranslator::BeginUpdateOutputs(HAC, false, ProcessingState, bKeepOldOutputs))
+	{
+		OutputProcessingStates.Remove(HAC);
+		return false;
+	}
+
+	ProcessingState.bIsPreviewRefinement = true;
+	HAC->SetAssetState(EHoudiniAssetState::PreProcess);
+
+	return true;
+}
+
+void
+FHoudiniEngineManager::FinishRefinePreviewOutputs(UHoudiniAssetComponent* HAC, const bool& bHasHoudiniStaticMeshOutput)
+{
+	HAC->UpdateRenderingInformation();
+	HAC->UpdateBounds();
+
+	FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString("Finished refining preview outputs"), true);
+
+	FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+
+	if (bHasHoudiniStaticMeshOutput && HAC->IsProxyStaticMeshRefinementByTimerEnabled())
+	{
+		if (!HAC->GetOnRefineMeshesTimerDelegate().IsBoundToObject(this))
+			HAC->GetOnRefineMeshesTimerDelegate().AddRaw(this, &FHoudiniEngineManager::BuildStaticMeshesForAllHoudiniStaticMeshes);
+		HAC->SetRefineMeshesTimer();
+	}
+
+	if (GEditor)
+		GEditor->RedrawAllViewports(false);
 }
 
 bool
@@ -1278,6 +1441,33 @@ FHoudiniEngineManager::StartTaskAssetProcess(UHoudiniAssetComponent* HAC)
 bool
 FHoudiniEngineManager::UpdateProcess(UHoudiniAssetComponent* HAC)
 {
+	// Don't block the game thread while the output data is being fetched on a worker thread
+	FHoudiniOutputProcessingState* FetchingState = OutputProcessingStates.Find(HAC);
+	if (FetchingState && FHoudiniOutputTranslator::IsFetchingOutputData(*FetchingState))
+		return false;
+
+	// Translate as many outputs as the time budget allows,
+	// the HAC stays in the Processing state until all its outputs have been processed.
+	const double dOutputTimeBudget = CVarHoudiniEngineOutputProcessingTimeLimit.GetValueOnAnyThread();
+	if (!ProcessOutputsWithinBudget(HAC, dOutputTimeBudget))
+		return false;
+
+	bool bHasHoudiniStaticMeshOutput = false;
+	bool bIsPreviewRefinement = false;
+	FHoudiniOutputProcessingState* ProcessingState = OutputProcessingStates.Find(HAC);
+	if (ProcessingState)
+	{
+		bIsPreviewRefinement = ProcessingState->bIsPreviewRefinement;
+		FHoudiniOutputTranslator::EndUpdateOutputs(HAC, *ProcessingState, bHasHoudiniStaticMeshOutput);
+		OutputProcessingStates.Remove(HAC);
+	}
+
+	// Refining the outputs of a preview cook doesn't cook the node, so the post cook steps are skipped
+	if (bIsPreviewRefinement)
+		FinishRefinePreviewOutputs(HAC, bHasHoudiniStaticMeshOutput);
+	else
+		FinishPostCook(HAC, true, bHasHoudiniStaticMeshOutput);
+
 	HAC->SetAssetState(EHoudiniAssetState::None);
 
 	return true;
@@ -28,12 +28,14 @@
 
 #include "HAPI/HAPI_Common.h"
 #include "TimerManager.h"
+#include "UObject/GCObject.h"
 
 //#include "HAL/Runnable.h"
 //#include "HAL/RunnableThread.h"
 //#include "Misc/SingleThreadRunnable.h"
 
 #include "HoudiniPDGManager.h"
+#include "HoudiniOutputTranslator.h"
 
 class UHoudiniAsset;
 class UHoudiniAssetComponent;
@@ -43,13 +45,17 @@ struct FGuid;
 
 enum class EHoudiniAssetState : uint8;
 
-class FHoudiniEngineManager
+class FHoudiniEngineManager : public FGCObject
 {
 public:
 
 	FHoudiniEngineManager();
 	virtual ~FHoudiniEngineManager();
 
+	// FGCObject: keeps the objects referenced by the output processing states alive between ticks
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FHoudiniEngineManager"); }
+
 	void StartHoudiniTicking();
 	void StopHoudiniTicking();
 	bool Tick(float DeltaTime);
@@ -80,6 +86,8 @@ public:
 	}
 
 	EHoudiniBGEOCommandletStatus GetPDGCommandletStatus() { return PDGManager.UpdateAndGetBGEOCommandletStatus(); }
+
+	FHoudiniBGEOCommandletPoolStats GetPDGCommandletPoolStats() const { return PDGManager.GetBGEOCommandletPoolStats(); }
 	
 	
 protected:
@@ -130,8 +138,29 @@ protected:
 		const bool& bSuccess,
 		const HAPI_NodeId& TaskAssetId);
 
+	// Starts fully processing the outputs of a preview cook, once the parameter/input edits have settled.
+	// The outputs are then processed in the Processing state, like the results of a cook.
+	bool RefinePreviewOutputs(UHoudiniAssetComponent* HAC);
+
+	// Called once all the outputs of a preview cook have been refined
+	void FinishRefinePreviewOutputs(UHoudiniAssetComponent* HAC, const bool& bHasHoudiniStaticMeshOutput);
+
+	// Abandons the output processing of a HAC that left the processing states before it was finished
+	void CancelOutputProcessing(UHoudiniAssetComponent* HAC);
+
+	// Translates the HAC's outputs until the time budget is exhausted (<= 0 means no limit)
+	// Returns true when all the outputs have been processed
+	bool ProcessOutputsWithinBudget(UHoudiniAssetComponent* HAC, const double& InTimeBudget);
+
+	// Called once all outputs have been processed (or if the cook failed)
+	void FinishPostCook(
+		UHoudiniAssetComponent* HAC,
+		const bool& bSuccess,
+		const bool& bHasHoudiniStaticMeshOutput);
+
 	bool StartTaskAssetProcess(UHoudiniAssetComponent* HAC);
 
+	// Returns true when the processing of the HAC's outputs is finished
 	bool UpdateProcess(UHoudiniAssetComponent* HAC);
 
 	// Starts a rebuild task (delete then re instantiate)
@@ -201,4 +230,7 @@ private:
 
 	// Indicates which HACs disable auto-saving
 	TSet<const UHoudiniAssetComponent*> DisableAutoSavingHACs;
+
+	// State of the output processing in progress for HACs in the Processing state
+	TMap<TWeakObjectPtr<UHoudiniAssetComponent>, FHoudiniOutputProcessingState> OutputProcessingStates;
 };
\ No newline at end of file
@@ -191,6 +191,8 @@
 
 
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME				 HAPI_ATTRIB_NAME
+#define HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_INDEX				"unreal_landscape_component_index"
+#define HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAMES				"unreal_landscape_component_names"
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_VERTEX_INDEX		    "unreal_vertex_index"
 #define HAPI_UNREAL_ATTRIB_UNIT_LANDSCAPE_LAYER				"unreal_unit_landscape_layer"
 #define HAPI_UNREAL_ATTRIB_NONWEIGHTBLENDED_LAYERS			"unreal_landscape_layer_nonweightblended"
@@ -287,6 +289,7 @@
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_NAME                 TEXT( "HoudiniGeneratedName" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE         TEXT( "HoudiniGeneratedTextureType" )
 #define HAPI_UNREAL_PACKAGE_META_NODE_PATH                      TEXT( "HoudiniNodePath" )
+#define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH         TEXT( "HoudiniGeneratedTextureHash" )
 #define HAPI_UNREAL_PACKAGE_META_BAKE_COUNTER                   TEXT( "HoudiniPackageBakeCounter" )
 
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL       TEXT( "N" )
@@ -297,6 +300,9 @@
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE     TEXT( "E" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK TEXT( "O" )
 
+// Key used to store the geometry fingerprint of instanced meshes in the output objects' cached attributes.
+#define HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT            TEXT( "HoudiniGeometryFingerprint" )
+
 // Texture planes.
 #define HAPI_UNREAL_MATERIAL_TEXTURE_COLOR_ALPHA        "C A"
 #define HAPI_UNREAL_MATERIAL_TEXTURE_COLOR              "C"
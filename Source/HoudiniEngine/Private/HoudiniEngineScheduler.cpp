@@ -274,6 +274,9 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		TEXT("HAPI Asynchronous Cooking Started for %s., AssetId = %d"),
 		*Task.ActorName, AssetId);
 
+	// Strings resolved before the cook shouldn't be reused
+	FHoudiniEngineString::ClearStringCache();
+
 	if (AssetId == -1)
 	{
 		// We have an invalid asset id.
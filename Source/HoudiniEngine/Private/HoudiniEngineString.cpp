@@ -30,8 +30,98 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
 #include <vector>
 
+static FAutoConsoleCommand CCmdHoudiniEngineLogStringCacheStatistics(
+	TEXT("HoudiniEngine.LogStringCacheStatistics"),
+	TEXT("Logs the hits/misses of the HAPI string handle cache and the number of HAPI calls made to resolve strings."),
+	FConsoleCommandDelegate::CreateStatic(&FHoudiniEngineString::LogStringCacheStatistics));
+
+// Strings resolved from HAPI string handles for the current session
+static TMap<int32, FString> CachedStrings;
+static FCriticalSection CachedStringsLock;
+
+// Incremented every time the cache is cleared, so strings resolved before a clear aren't added back
+static uint32 CachedStringsGeneration = 0;
+
+// Statistics, not reset when the cache is cleared
+static int64 CachedStringsHits = 0;
+static int64 CachedStringsMisses = 0;
+static int64 StringHAPICalls = 0;
+
+// Resolves a single string handle with HAPI
+static bool
+GetHAPIString(const int32& InStringId, std::string& OutString)
+{
+	OutString = "";
+
+	int32 NameLength = 0;
+	FPlatformAtomics::InterlockedAdd(&StringHAPICalls, 1);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBufLength(
+		FHoudiniEngine::Get().GetSession(), InStringId, &NameLength))
+	{
+		return false;
+	}
+		
+	if (NameLength <= 0)
+		return false;
+		
+	std::vector<char> NameBuffer(NameLength, '\0');
+	FPlatformAtomics::InterlockedAdd(&StringHAPICalls, 1);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetString(
+		FHoudiniEngine::Get().GetSession(),
+		InStringId, &NameBuffer[0], NameLength ) )
+	{
+		return false;
+	}
+
+	OutString = std::string(NameBuffer.begin(), NameBuffer.end());
+
+	return true;
+}
+
+// Resolves unique string handles with a single string batch
+static bool
+GetHAPIStringBatch(const TArray<int32>& InUniqueStringIds, TArray<FString>& OutStrings)
+{
+	OutStrings.Empty();
+
+	int32 BufferSize = 0;
+	FPlatformAtomics::InterlockedAdd(&StringHAPICalls, 1);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
+		FHoudiniEngine::Get().GetSession(), InUniqueStringIds.GetData(), InUniqueStringIds.Num(), &BufferSize))
+		return false;
+
+	if (BufferSize <= 0)
+		return false;
+
+	std::vector<char> Buffer(BufferSize, '\0');
+	FPlatformAtomics::InterlockedAdd(&StringHAPICalls, 1);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(
+		FHoudiniEngine::Get().GetSession(), &Buffer[0], BufferSize))
+		return false;
+
+	// Parse the buffer to a string array
+	OutStrings.Reserve(InUniqueStringIds.Num());
+	std::vector<char>::iterator CurrentBegin = Buffer.begin();	
+	for (std::vector<char>::iterator it = Buffer.begin(); it != Buffer.end(); it++)
+	{
+		if (*it != '\0')
+			continue;
+
+		std::string stdString = std::string(CurrentBegin, it);
+		OutStrings.Add(UTF8_TO_TCHAR(stdString.c_str()));
+
+		CurrentBegin = it;
+		CurrentBegin++;
+	}
+
+	return OutStrings.Num() == InUniqueStringIds.Num();
+}
+
 FHoudiniEngineString::FHoudiniEngineString()
 	: StringId(-1)
 {}
@@ -85,30 +175,15 @@ FHoudiniEngineString::ToStdString(std::string& String) const
 	// Null string ID / zero should be considered invalid
 	// (or we'd get the "null string, should never see this!" text)
 	if (StringId <= 0)
-	{
-		return false;
-	}		
-
-	int32 NameLength = 0;
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBufLength(
-		FHoudiniEngine::Get().GetSession(), StringId, &NameLength))
-	{
-		return false;
-	}
-		
-	if (NameLength <= 0)
-		return false;
-		
-	std::vector<char> NameBuffer(NameLength, '\0');
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetString(
-		FHoudiniEngine::Get().GetSession(),
-		StringId, &NameBuffer[0], NameLength ) )
 	{
 		return false;
 	}
 
-	String = std::string(NameBuffer.begin(), NameBuffer.end());
+	FString CachedString;
+	if (!ToFString(CachedString))
+		return false;
 
+	String = TCHAR_TO_UTF8(*CachedString);
 	return true;
 }
 
@@ -130,15 +205,37 @@ bool
 FHoudiniEngineString::ToFString(FString& String) const
 {
 	String = TEXT("");
-	std::string NamePlain = "";
 
-	if (ToStdString(NamePlain))
+	// Null string ID / zero should be considered invalid
+	if (StringId <= 0)
+		return false;
+
+	uint32 Generation = 0;
 	{
-		String = UTF8_TO_TCHAR(NamePlain.c_str());
-		return true;
+		FScopeLock ScopeLock(&CachedStringsLock);
+		if (const FString* FoundString = CachedStrings.Find(StringId))
+		{
+			String = *FoundString;
+			CachedStringsHits++;
+			return true;
+		}
+
+		CachedStringsMisses++;
+		Generation = CachedStringsGeneration;
 	}
 
-	return false;
+	std::string NamePlain = "";
+	if (!GetHAPIString(StringId, NamePlain))
+		return false;
+
+	String = UTF8_TO_TCHAR(NamePlain.c_str());
+
+	// Don't cache the string if the cache was cleared while we were resolving it
+	FScopeLock ScopeLock(&CachedStringsLock);
+	if (Generation == CachedStringsGeneration)
+		CachedStrings.Add(StringId, String);
+
+	return true;
 }
 
 bool
@@ -196,64 +293,25 @@ FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray
 bool
 FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
 {
-	bool bReturn = true;
 	OutStringArray.SetNumZeroed(InStringIdArray.Num());
 
-	TArray<int32> UniqueSH;
-	for (const auto& CurrentSH : InStringIdArray)
-	{
-		UniqueSH.AddUnique(CurrentSH);
-	}
-
-	int32 BufferSize = 0;
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
-		FHoudiniEngine::Get().GetSession(), UniqueSH.GetData(), UniqueSH.Num(), &BufferSize))
-		return false;
-
-	if (BufferSize <= 0)
-		return false;
-
-	std::vector<char> Buffer(BufferSize, '\0');
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(
-		FHoudiniEngine::Get().GetSession(), &Buffer[0], BufferSize))
+	// Resolve the missing strings, then fill the output array from the cache
+	if (!PrefetchStrings(InStringIdArray))
 		return false;
 
-	// Parse the buffer to a string array
-	TArray<FString> ConvertedString;
-	std::vector<char>::iterator CurrentBegin = Buffer.begin();	
-	for (std::vector<char>::iterator it = Buffer.begin(); it != Buffer.end(); it++)
-	{
-		if (*it != '\0')
-			continue;
-
-		std::string stdString = std::string(CurrentBegin, it);
-		ConvertedString.Add(UTF8_TO_TCHAR(stdString.c_str()));
-
-		CurrentBegin = it;
-		CurrentBegin++;
-	}
-
-	if (ConvertedString.Num() != UniqueSH.Num())
-		return false;
-
-	// Build a map to map string handles to indices
-	TMap<HAPI_StringHandle, int32> SHToIndexMap;
-	for (int32 Idx = 0; Idx < UniqueSH.Num(); Idx++)
-		SHToIndexMap.Add(UniqueSH[Idx], Idx);
-
-	// Fill the output array using the map
+	FScopeLock ScopeLock(&CachedStringsLock);
 	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
 	{
-		const int32* FoundIndex = SHToIndexMap.Find(InStringIdArray[IdxSH]);
-		if (!FoundIndex || !ConvertedString.IsValidIndex(*FoundIndex))
+		const FString* FoundString = CachedStrings.Find(InStringIdArray[IdxSH]);
+		if (!FoundString)
 			return false;
 
-		// Already resolved earlier, copy the string instead of calling HAPI.
-		OutStringArray[IdxSH] = ConvertedString[*FoundIndex];
+		OutStringArray[IdxSH] = *FoundString;
 	}
 
 	return true;
 }
+
 bool
 FHoudiniEngineString::SHArrayToFStringArray_Singles(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
 {
@@ -282,4 +340,74 @@ FHoudiniEngineString::SHArrayToFStringArray_Singles(const TArray<int32>& InStrin
 	}
 
 	return bReturn;
-}
\ No newline at end of file
+}
+
+bool
+FHoudiniEngineString::PrefetchStrings(const TArray<int32>& InStringIdArray)
+{
+	// Gather the handles that haven't been resolved yet
+	TArray<int32> UnresolvedSH;
+	uint32 Generation = 0;
+	{
+		FScopeLock ScopeLock(&CachedStringsLock);
+		Generation = CachedStringsGeneration;
+		TSet<int32> UnresolvedSet;
+		for (const auto& CurrentSH : InStringIdArray)
+		{
+			if (CachedStrings.Contains(CurrentSH) || UnresolvedSet.Contains(CurrentSH))
+			{
+				CachedStringsHits++;
+				continue;
+			}
+
+			UnresolvedSet.Add(CurrentSH);
+			UnresolvedSH.Add(CurrentSH);
+			CachedStringsMisses++;
+		}
+	}
+
+	if (UnresolvedSH.Num() <= 0)
+		return true;
+
+	TArray<FString> ResolvedStrings;
+	if (!GetHAPIStringBatch(UnresolvedSH, ResolvedStrings))
+		return false;
+
+	// Don't cache the strings if the cache was cleared while we were resolving them
+	FScopeLock ScopeLock(&CachedStringsLock);
+	if (Generation != CachedStringsGeneration)
+		return false;
+
+	for (int32 Idx = 0; Idx < UnresolvedSH.Num(); Idx++)
+		CachedStrings.Add(UnresolvedSH[Idx], ResolvedStrings[Idx]);
+
+	return true;
+}
+
+void
+FHoudiniEngineString::ClearStringCache()
+{
+	FScopeLock ScopeLock(&CachedStringsLock);
+	CachedStrings.Empty();
+	CachedStringsGeneration++;
+}
+
+void
+FHoudiniEngineString::LogStringCacheStatistics()
+{
+	int64 Hits = 0;
+	int64 Misses = 0;
+	int32 NumCached = 0;
+	{
+		FScopeLock ScopeLock(&CachedStringsLock);
+		Hits = CachedStringsHits;
+		Misses = CachedStringsMisses;
+		NumCached = CachedStrings.Num();
+	}
+
+	const int64 Lookups = Hits + Misses;
+	HOUDINI_LOG_MESSAGE(
+		TEXT("HAPI string cache: %d cached strings, %lld hits / %lld lookups (%.1f%%), %lld HAPI calls made to resolve strings."),
+		NumCached, Hits, Lookups, Lookups > 0 ? (100.0 * Hits / Lookups) : 0.0,
+		FPlatformAtomics::AtomicRead(&StringHAPICalls));
+}
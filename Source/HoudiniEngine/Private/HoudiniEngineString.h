@@ -67,6 +67,17 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		// Array converter, uses a map to reduce HAPI calls
 		static bool SHArrayToFStringArray_Singles(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
 
+		// Resolves all the handles that aren't in the string cache yet with a single string batch.
+		// Used to resolve all the strings needed by a translation phase at once.
+		static bool PrefetchStrings(const TArray<int32>& InStringIdArray);
+
+		// Clears the session string cache, needs to be called before any cook and on session reset.
+		// FHoudiniEngineUtils::HapiCookNode does it, direct calls to FHoudiniApi::CookNode must do it as well.
+		static void ClearStringCache();
+
+		// Logs the string cache hits / misses and the number of HAPI calls made to resolve strings.
+		static void LogStringCacheStatistics();
+
 		// Return id of this string.
 		int32 GetId() const;
 
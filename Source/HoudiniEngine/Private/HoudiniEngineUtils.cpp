@@ -89,6 +89,7 @@
 #include "FileHelpers.h"
 #include "Factories/WorldFactory.h"
 #include "HAL/FileManager.h"
+#include "InstancedFoliageActor.h"
 
 #if WITH_EDITOR
 	#include "EditorModeManager.h"
@@ -996,6 +997,33 @@ FHoudiniEngineUtils::RepopulateFoliageTypeListInUI()
 	return false;
 }
 
+int32
+FHoudiniEngineUtils::AddFoliageInstances(
+	AInstancedFoliageActor* InInstancedFoliageActor,
+	UFoliageType* InFoliageType,
+	FFoliageInfo* InFoliageInfo,
+	const TArray<FFoliageInstance>& InInstances)
+{
+	if (!IsValid(InInstancedFoliageActor) || !IsValid(InFoliageType) || !InFoliageInfo)
+		return 0;
+
+	if (InInstances.Num() <= 0)
+		return 0;
+
+	// Adding the instances at once only modifies the foliage actor once, and defers the update
+	// of the foliage component's cluster tree until all the instances are added
+	InFoliageInfo->ReserveAdditionalInstances(InInstancedFoliageActor, InFoliageType, InInstances.Num());
+
+	TSet<const FFoliageInstance*> NewInstances;
+	NewInstances.Reserve(InInstances.Num());
+	for (const FFoliageInstance& Instance : InInstances)
+		NewInstances.Add(&Instance);
+
+	InFoliageInfo->AddInstances(InInstancedFoliageActor, InFoliageType, NewInstances);
+
+	return InInstances.Num();
+}
+
 void
 FHoudiniEngineUtils::GatherLandscapeInputs(
 	UHoudiniAssetComponent* HAC,
@@ -4412,6 +4440,9 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 		AttribIndex = InAttribIndex;
 	}
 
+	// Resolve all the attribute names at once
+	FHoudiniEngineString::PrefetchStrings(AttribNameSHArray);
+
 	int32 FoundCount = 0;
 	for (int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx)
 	{
@@ -5421,6 +5452,9 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	if (InNodeId < 0)
 		return false;
 
+	// String handles resolved before the cook shouldn't be reused
+	FHoudiniEngineString::ClearStringCache();
+
 	// No Cook Options were specified, use the default one
 	if (InCookOptions == nullptr)
 	{
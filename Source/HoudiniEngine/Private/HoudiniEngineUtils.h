@@ -39,6 +39,8 @@ class FString;
 class UStaticMesh;
 class UHoudiniAsset;
 class UHoudiniAssetComponent;
+class AInstancedFoliageActor;
+class UFoliageType;
 
 struct FHoudiniPartInfo;
 struct FHoudiniMeshSocket;
@@ -46,6 +48,8 @@ struct FHoudiniGeoPartObject;
 struct FHoudiniGenericAttribute;
 
 struct FRawMesh;
+struct FFoliageInfo;
+struct FFoliageInstance;
 
 enum class EHoudiniCurveType : int8;
 enum class EHoudiniCurveMethod : int8;
@@ -668,6 +672,16 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// Returns true if the list was repopulated.
 		static bool RepopulateFoliageTypeListInUI();
 
+		// Adds instances of InFoliageType to the foliage actor.
+		// The instances are reserved and added to the foliage info at once, so the foliage component's
+		// cluster tree is only rebuilt once.
+		// Returns the number of instances added.
+		static int32 AddFoliageInstances(
+			AInstancedFoliageActor* InInstancedFoliageActor,
+			UFoliageType* InFoliageType,
+			FFoliageInfo* InFoliageInfo,
+			const TArray<FFoliageInstance>& InInstances);
+
 		// -------------------------------------------------
 		// Landscape utilities
 		// -------------------------------------------------
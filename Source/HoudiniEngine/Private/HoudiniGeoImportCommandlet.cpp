@@ -446,6 +446,7 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 		return 2;
 	}
 
+	const double StartTime = FPlatformTime::Seconds();
 	FHoudiniPackageParams PackageParams = InPackageParams;
 	UHoudiniGeoImporter* GeoImporter = NewObject<UHoudiniGeoImporter>(this);
 
@@ -619,6 +620,8 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 	PackagesToSave.Empty();
 	OutputObjects.Empty();
 
+	HOUDINI_LOG_DISPLAY(TEXT("Imported %s in %.3f ms"), *InFilename, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
 	return 0;
 }
 
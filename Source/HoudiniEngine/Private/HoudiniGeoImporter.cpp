@@ -29,6 +29,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniPackageParams.h"
@@ -42,6 +43,9 @@
 
 #include "CoreMinimal.h"
 #include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/MappedFileHandle.h"
 #include "Misc/PackageName.h"
 #include "UObject/Package.h"
 #include "PackageTools.h"
@@ -51,6 +55,7 @@
 #include "Materials/MaterialInterface.h"
 #include "Materials/Material.h"
 
+HAPI_NodeId UHoudiniGeoImporter::ReusableBGEONodeId = -1;
 
 UHoudiniGeoImporter::UHoudiniGeoImporter(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -622,6 +627,10 @@ UHoudiniGeoImporter::DeleteCreatedNode(const HAPI_NodeId& InNodeId)
 	if (InNodeId < 0)
 		return false;
 
+	// The reusable node is kept for the next import
+	if (IsReusableBGEONode(InNodeId))
+		return true;
+
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), InNodeId))
 	{
 		// Could not delete the bgeo's file sop !
@@ -637,6 +646,8 @@ UHoudiniGeoImporter::ImportBGEOFile(const FString& InBGEOFile, UObject* InParent
 {
 	if (InBGEOFile.IsEmpty())
 		return false;
+
+	const double StartTime = FPlatformTime::Seconds();
 	
 	// 1. Houdini Engine Session
 	// See if we should/can start the default "first" HE session
@@ -659,12 +670,16 @@ UHoudiniGeoImporter::ImportBGEOFile(const FString& InBGEOFile, UObject* InParent
 		return false;
 
 	// Failure lambda
-	auto CleanUpAndReturn = [&NewOutputs](const bool& bReturnValue)
+	auto CleanUpAndReturn = [&NewOutputs, &InBGEOFile, StartTime](const bool& bReturnValue)
 	{
 		// Remove the output objects from the root set before returning false
 		for (auto Out : NewOutputs)
 			Out->RemoveFromRoot();
 
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Houdini GEO Importer: Imported %s in %.3f ms (%s)."),
+			*InBGEOFile, (FPlatformTime::Seconds() - StartTime) * 1000.0, bReturnValue ? TEXT("success") : TEXT("failed"));
+
 		return bReturnValue;
 	};
 
@@ -784,27 +799,7 @@ UHoudiniGeoImporter::OpenBGEOFile(const FString& InBGEOFile, HAPI_NodeId& OutNod
 	FString Notification = TEXT("BGEO Importer: Loading bgeo file...");
 	FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(Notification), true);
 
-	// Create a file SOP
-	HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
-		-1,	"SOP/file", "bgeo", true, &OutNodeId), false);
-
-	/*
-	// Set the file path parameter
-	HAPI_ParmId ParmId = -1;
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIdFromName(
-		FHoudiniEngine::Get().GetSession(),
-		OutNodeId, "file", &ParmId), false);
-
-	const std::string ConvertedString = TCHAR_TO_UTF8(*AbsoluteFilePath);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmStringValue(
-		FHoudiniEngine::Get().GetSession(), OutNodeId, ConvertedString.c_str(), ParmId, 0), false);
-	*/
-
-	// Simply use LoadGeoFrom file
-	std::string ConvertedString = TCHAR_TO_UTF8(*AbsoluteFilePath);
-	FHoudiniApi::LoadGeoFromFile(FHoudiniEngine::Get().GetSession(), OutNodeId, ConvertedString.c_str());
-
-	return true;
+	return LoadBGEOFileInReusableNode(AbsoluteFilePath, FileExtension, OutNodeId);
 }
 
 bool
@@ -835,33 +830,90 @@ UHoudiniGeoImporter::LoadBGEOFileInHAPI(HAPI_NodeId& NodeId)
 	FString Notification = TEXT("BGEO Importer: Loading bgeo file...");
 	FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(Notification), true);
 
-	// Create a file SOP
-	HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
-		-1,	"SOP/file", "bgeo", true, &NodeId), false);
+	if (!LoadBGEOFileInReusableNode(AbsoluteFilePath, FileExtension, NodeId))
+		return false;
+
+	return CookFileNode(NodeId);
+}
 
-	/*
-	// Set the file path parameter
-	HAPI_ParmId ParmId = -1;
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIdFromName(
-		FHoudiniEngine::Get().GetSession(),
-		NodeId, "file", &ParmId), false);
-
-	std::string ConvertedString = TCHAR_TO_UTF8(*AbsoluteFilePath);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmStringValue(
-		FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str(), ParmId, 0), false);
-	*/
+bool
+UHoudiniGeoImporter::IsReusableBGEONode(const HAPI_NodeId& InNodeId)
+{
+	return InNodeId >= 0 && InNodeId == ReusableBGEONodeId;
+}
 
-	// Simply use LoadGeoFrom file
-	std::string ConvertedString = TCHAR_TO_UTF8(*AbsoluteFilePath);
-	FHoudiniApi::LoadGeoFromFile(FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str());
+void
+UHoudiniGeoImporter::ResetReusableBGEONode()
+{
+	ReusableBGEONodeId = -1;
+}
 
-	return CookFileNode(NodeId);
+bool
+UHoudiniGeoImporter::LoadBGEOFileInReusableNode(const FString& InAbsoluteFilePath, const FString& InFileExtension, HAPI_NodeId& OutNodeId)
+{
+	OutNodeId = -1;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// (Re)create the file SOP if needed. ReusableBGEONodeId is reset when the session changes,
+	// the validity check only handles the node being deleted in the current session.
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(ReusableBGEONodeId))
+	{
+		ReusableBGEONodeId = -1;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+			-1, "SOP/file", "bgeo", true, &ReusableBGEONodeId), false);
+	}
+	OutNodeId = ReusableBGEONodeId;
+
+	// Map the file in memory, or read it if the platform does not support mapped files
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*InAbsoluteFilePath));
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile.IsValid() ? MappedFile->MapRegion() : nullptr);
+
+	TArray<uint8> FileData;
+	const char* Buffer = nullptr;
+	int64 BufferSize = 0;
+	if (MappedRegion.IsValid())
+	{
+		Buffer = reinterpret_cast<const char*>(MappedRegion->GetMappedPtr());
+		BufferSize = MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(FileData, *InAbsoluteFilePath))
+	{
+		Buffer = reinterpret_cast<const char*>(FileData.GetData());
+		BufferSize = FileData.Num();
+	}
+
+	// HAPI takes the buffer length as an int: fall back to loading from the file path for larger files, or if
+	// HAPI could not parse the buffer.
+	bool bLoaded = false;
+	const bool bUseMemory = Buffer && BufferSize > 0 && BufferSize <= MAX_int32;
+	if (bUseMemory)
+	{
+		const std::string Format = TCHAR_TO_UTF8(*InFileExtension);
+		bLoaded = HAPI_RESULT_SUCCESS == FHoudiniApi::LoadGeoFromMemory(
+			FHoudiniEngine::Get().GetSession(), OutNodeId, Format.c_str(), Buffer, (int)BufferSize);
+	}
+
+	if (!bLoaded)
+	{
+		const std::string ConvertedString = TCHAR_TO_UTF8(*InAbsoluteFilePath);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::LoadGeoFromFile(
+			FHoudiniEngine::Get().GetSession(), OutNodeId, ConvertedString.c_str()), false);
+	}
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Houdini GEO Importer: Loaded %s (%lld bytes, %s) in %.3f ms."),
+		*InAbsoluteFilePath, BufferSize, bLoaded ? (MappedRegion.IsValid() ? TEXT("mapped") : TEXT("memory")) : TEXT("file"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return true;
 }
 
 bool
 UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 {
 	// Cook the node    
+	FHoudiniEngineString::ClearStringCache();
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
 		FHoudiniEngine::Get().GetSession(), InNodeId, &CookOptions), false);
@@ -59,6 +59,15 @@ public:
 		static bool BuildAllOutputsForNode(const HAPI_NodeId& InNodeId, UObject* InOuter, TArray<UHoudiniOutput*>& InOldOutputs, TArray<UHoudiniOutput*>& OutNewOutputs, bool bInAddOutputsToRootSet=false);
 		// Delete the HAPI node and remove InOutputs from the root set.
 		static bool CloseBGEOFile(const HAPI_NodeId& InNodeId);
+		// Load a BGEO file in the importer's reusable file node: the file is mapped in memory and sent to HAPI via
+		// LoadGeoFromMemory. The node is created on first use and kept alive across imports, so that consecutive
+		// imports (PDG results, the geo import commandlet) do not each pay for a node creation and deletion.
+		static bool LoadBGEOFileInReusableNode(const FString& InAbsoluteFilePath, const FString& InFileExtension, HAPI_NodeId& OutNodeId);
+		// Returns true if InNodeId is the reusable BGEO node, which is kept alive instead of being deleted after an import.
+		static bool IsReusableBGEONode(const HAPI_NodeId& InNodeId);
+		// Forgets the reusable BGEO node. Called when the session starts, stops or is lost, since the
+		// node id could otherwise alias an unrelated node of the new session.
+		static void ResetReusableBGEONode();
 		// END: Static API
 
 		// Import the BGEO file
@@ -89,6 +98,9 @@ public:
 
 	private:
 
+		// File node reused by LoadBGEOFileInReusableNode
+		static HAPI_NodeId ReusableBGEONodeId;
+
 		//
 		// Input file
 		//
@@ -40,6 +40,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniSplineTranslator.h"
 #include "HoudiniAssetActor.h"
+#include "HoudiniWorldInputChangeTracker.h"
 #include "HoudiniOutputTranslator.h"
 #include "UnrealBrushTranslator.h"
 #include "UnrealSplineTranslator.h"
@@ -2424,9 +2425,17 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 	bool bSucess = false;
 	if (ExportType == EHoudiniLandscapeExportType::Heightfield)
 	{
-		// Ensure we destroy any (Houdini) input nodes before clobbering this object with a new heightfield.
-		//DestroyInputNodes(InInput, InInput->GetInputType());
-		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+		// If the heightfield has already been sent, try to only send the landscape components that were modified
+		bSucess = FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(Landscape, InObject->InputNodeId);
+		if (!bSucess)
+		{
+			// The landscape's layout has changed, we need to send the whole heightfield
+			FUnrealLandscapeTranslator::ClearLandscapeUploadCache(InObject->InputNodeId);
+
+			// Ensure we destroy any (Houdini) input nodes before clobbering this object with a new heightfield.
+			//DestroyInputNodes(InInput, InInput->GetInputType());
+			bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+		}
 	}
 	else
 	{
@@ -2625,8 +2634,15 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 	if (!InputObjectsPtr)
 		return false;
 
+	// When change tracking is available, only the actors that have been modified since the last update need to be checked
+	FHoudiniWorldInputChangeTracker& ChangeTracker = FHoudiniWorldInputChangeTracker::Get();
+	const bool bUseChangeTracker = ChangeTracker.IsEnabled();
+	const uint64 UpdateSerial = ChangeTracker.GetCurrentSerial();
+	const uint64 LastUpdateSerial = bUseChangeTracker ? ChangeTracker.GetInputLastUpdateSerial(InInput) : 0;
+	const bool bHasWorldChanged = !bUseChangeTracker || ChangeTracker.HasWorldChangedSince(InInput->GetWorld(), LastUpdateSerial);
+
 	bool bHasChanged = false;
-	if (InInput->IsWorldInputBoundSelector() && InInput->GetWorldInputBoundSelectorAutoUpdates())
+	if (bHasWorldChanged && InInput->IsWorldInputBoundSelector() && InInput->GetWorldInputBoundSelectorAutoUpdates())
 	{
 		// If the input is in bound selector mode, and auto-update is enabled
 		// update the actors selected by the bounds first
@@ -2672,6 +2688,15 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 			continue;
 		}
 
+		if (bUseChangeTracker && !ChangeTracker.HasActorChangedSince(Actor, LastUpdateSerial))
+		{
+			// Brushes depend on the other brushes they intersect with,
+			// and Houdini Assets' outputs are updated by cooks without notifications.
+			const bool bNeedsCheck = (BrushActorObject && bHasWorldChanged) || Actor->IsA<AHoudiniAssetActor>();
+			if (!bNeedsCheck)
+				continue;
+		}
+
 		if (ActorObject->HasActorTransformChanged())
 		{
 			ActorObject->MarkTransformChanged(true);
@@ -2720,6 +2745,9 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 	if (bHasChanged)
 		InInput->MarkChanged(true);
 
+	if (bUseChangeTracker)
+		ChangeTracker.SetInputLastUpdateSerial(InInput, UpdateSerial);
+
 	return true;
 }
 
@@ -3025,6 +3053,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForDataTable(const FString& InNodeNa
 		FHoudiniEngine::Get().GetSession(), InputNodeId), false);
 
 	// Commit the geo.
+	FHoudiniEngineString::ClearStringCache();
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
 		FHoudiniEngine::Get().GetSession(), InputNodeId, nullptr), false);
 
@@ -68,20 +68,39 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	const TArray<UHoudiniOutput*>& InAllOutputs,
 	FHoudiniInstancedOutputPartData& OutInstancedOutputPartData)
 {
+	FHoudiniInstancerPartHAPIData HAPIData;
+	if (!GatherInstancerPartHAPIData(InHGPO, HAPIData))
+		return false;
+
+	return FinishInstancedOutputPartData(InHGPO, InAllOutputs, HAPIData, OutInstancedOutputPartData);
+}
+
+bool
+FHoudiniInstanceTranslator::GatherInstancerPartHAPIData(
+	const FHoudiniGeoPartObject& InHGPO,
+	FHoudiniInstancerPartHAPIData& OutHAPIData)
+{
+	FHoudiniInstancedOutputPartData& OutInstancedOutputPartData = OutHAPIData.PartData;
+
 	// Get if force to use HISM from attribute
 	OutInstancedOutputPartData.bForceHISM = HasHISMAttribute(InHGPO.GeoId, InHGPO.PartId);
 
-	// Extract the object and transforms for this instancer
-	if (!GetInstancerObjectsAndTransforms(
-			InHGPO,
-			InAllOutputs,
-			OutInstancedOutputPartData.OriginalInstancedObjects,
-			OutInstancedOutputPartData.OriginalInstancedTransforms,
-			OutInstancedOutputPartData.OriginalInstancedIndices,
-			OutInstancedOutputPartData.SplitAttributeName,
-			OutInstancedOutputPartData.SplitAttributeValues,
-			OutInstancedOutputPartData.PerSplitAttributes))
-		return false;
+	// Packed primitives only need HAPI to get their instanced parts and transforms,
+	// the other instancer types have to look for their objects when finishing the part data
+	if (InHGPO.InstancerType == EHoudiniInstancerType::PackedPrimitive)
+	{
+		if (!GetPackedPrimitiveInstancerHGPOsAndTransforms(
+				InHGPO,
+				OutHAPIData.InstancedHGPOs,
+				OutHAPIData.InstancedHGPOTransforms,
+				OutHAPIData.InstancedHGPOIndices,
+				OutInstancedOutputPartData.SplitAttributeName,
+				OutInstancedOutputPartData.SplitAttributeValues,
+				OutInstancedOutputPartData.PerSplitAttributes))
+			return false;
+
+		OutHAPIData.bHasInstancedHGPOs = true;
+	}
 	
 	// Check if this is a No-Instancers ( unreal_split_instances )
 	OutInstancedOutputPartData.bSplitMeshInstancer = IsSplitInstancer(InHGPO.GeoId, InHGPO.PartId);
@@ -143,6 +162,39 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	return true;
 }
 
+bool
+FHoudiniInstanceTranslator::FinishInstancedOutputPartData(
+	const FHoudiniGeoPartObject& InHGPO,
+	const TArray<UHoudiniOutput*>& InAllOutputs,
+	FHoudiniInstancerPartHAPIData& InHAPIData,
+	FHoudiniInstancedOutputPartData& OutInstancedOutputPartData)
+{
+	OutInstancedOutputPartData = MoveTemp(InHAPIData.PartData);
+
+	// Extract the object and transforms for this instancer
+	if (InHAPIData.bHasInstancedHGPOs)
+	{
+		return GetInstancedHGPOsObjectsAndTransforms(
+			InHAPIData.InstancedHGPOs,
+			InHAPIData.InstancedHGPOTransforms,
+			InHAPIData.InstancedHGPOIndices,
+			InAllOutputs,
+			OutInstancedOutputPartData.OriginalInstancedObjects,
+			OutInstancedOutputPartData.OriginalInstancedTransforms,
+			OutInstancedOutputPartData.OriginalInstancedIndices);
+	}
+
+	return GetInstancerObjectsAndTransforms(
+		InHGPO,
+		InAllOutputs,
+		OutInstancedOutputPartData.OriginalInstancedObjects,
+		OutInstancedOutputPartData.OriginalInstancedTransforms,
+		OutInstancedOutputPartData.OriginalInstancedIndices,
+		OutInstancedOutputPartData.SplitAttributeName,
+		OutInstancedOutputPartData.SplitAttributeValues,
+		OutInstancedOutputPartData.PerSplitAttributes);
+}
+
 bool
 FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	UHoudiniOutput* InOutput,
@@ -795,51 +847,84 @@ FHoudiniInstanceTranslator::GetInstancerObjectsAndTransforms(
 	// Attribute instancers don't need to do this since they refer UObjects directly
 	if (InstancedHGPOs.Num() > 0)
 	{
-		for (int32 HGPOIdx = 0; HGPOIdx < InstancedHGPOs.Num(); HGPOIdx++)
+		return GetInstancedHGPOsObjectsAndTransforms(
+			InstancedHGPOs, InstancedHGPOTransforms, InstancedHGPOIndices, InAllOutputs,
+			OutInstancedObjects, OutInstancedTransforms, OutInstancedIndices);
+	}
+	   
+	//
+	if (InstancedObjects.Num() <= 0 || InstancedTransforms.Num() != InstancedObjects.Num()  || InstancedIndices.Num() != InstancedObjects.Num())
+	{
+		// TODO
+		// Error / warning
+		return false;
+	}
+
+	OutInstancedObjects = InstancedObjects;
+	OutInstancedTransforms = InstancedTransforms;
+	OutInstancedIndices = InstancedIndices;
+
+	return true;
+}
+
+bool
+FHoudiniInstanceTranslator::GetInstancedHGPOsObjectsAndTransforms(
+	const TArray<FHoudiniGeoPartObject>& InInstancedHGPOs,
+	const TArray<TArray<FTransform>>& InInstancedHGPOTransforms,
+	const TArray<TArray<int32>>& InInstancedHGPOIndices,
+	const TArray<UHoudiniOutput*>& InAllOutputs,
+	TArray<UObject*>& OutInstancedObjects,
+	TArray<TArray<FTransform>>& OutInstancedTransforms,
+	TArray<TArray<int32>>& OutInstancedIndices)
+{
+	TArray<UObject*> InstancedObjects;
+	TArray<TArray<FTransform>> InstancedTransforms;
+	TArray<TArray<int32>> InstancedIndices;
+
+	for (int32 HGPOIdx = 0; HGPOIdx < InInstancedHGPOs.Num(); HGPOIdx++)
+	{
+		const FHoudiniGeoPartObject& CurrentHGPO = InInstancedHGPOs[HGPOIdx];
+
+		// Get the UObject that was generated for that HGPO
+		TArray<UObject*> ObjectsToInstance;
+		for (const auto& Output : InAllOutputs)
 		{
-			const FHoudiniGeoPartObject& CurrentHGPO = InstancedHGPOs[HGPOIdx];
+			if (!Output || Output->Type != EHoudiniOutputType::Mesh)
+				continue;
 
-			// Get the UObject that was generated for that HGPO
-			TArray<UObject*> ObjectsToInstance;
-			for (const auto& Output : InAllOutputs)
-			{
-				if (!Output || Output->Type != EHoudiniOutputType::Mesh)
-					continue;
+			if (Output->OutputObjects.Num() <= 0)
+				continue;
 
-				if (Output->OutputObjects.Num() <= 0)
+			for (const auto& OutObjPair : Output->OutputObjects)
+			{					
+				if (!OutObjPair.Key.Matches(CurrentHGPO))
 					continue;
 
-				for (const auto& OutObjPair : Output->OutputObjects)
-				{					
-					if (!OutObjPair.Key.Matches(CurrentHGPO))
-						continue;
+				const FHoudiniOutputObject& CurrentOutputObject = OutObjPair.Value;
 
-					const FHoudiniOutputObject& CurrentOutputObject = OutObjPair.Value;
-
-					// In the case of a single-instance we can use the proxy (if it is current)
-					// FHoudiniOutputTranslator::UpdateOutputs doesn't allow proxies if there is more than one instance in an output
-					if (InstancedHGPOTransforms[HGPOIdx].Num() <= 1 && CurrentOutputObject.bProxyIsCurrent 
-						&& CurrentOutputObject.ProxyObject && !CurrentOutputObject.ProxyObject->IsPendingKill())
-					{
-						ObjectsToInstance.Add(CurrentOutputObject.ProxyObject);
-					}
-					else if (CurrentOutputObject.OutputObject && !CurrentOutputObject.OutputObject->IsPendingKill())
-					{
-						ObjectsToInstance.Add(CurrentOutputObject.OutputObject);
-					}
+				// In the case of a single-instance we can use the proxy (if it is current)
+				// FHoudiniOutputTranslator::UpdateOutputs doesn't allow proxies if there is more than one instance in an output
+				if (InInstancedHGPOTransforms[HGPOIdx].Num() <= 1 && CurrentOutputObject.bProxyIsCurrent 
+					&& CurrentOutputObject.ProxyObject && !CurrentOutputObject.ProxyObject->IsPendingKill())
+				{
+					ObjectsToInstance.Add(CurrentOutputObject.ProxyObject);
+				}
+				else if (CurrentOutputObject.OutputObject && !CurrentOutputObject.OutputObject->IsPendingKill())
+				{
+					ObjectsToInstance.Add(CurrentOutputObject.OutputObject);
 				}
 			}
+		}
 
-			// Add the UObject and the HGPO transforms to the output arrays
-			for (const auto& MatchingOutputObj : ObjectsToInstance)
-			{
-				InstancedObjects.Add(MatchingOutputObj);
-				InstancedTransforms.Add(InstancedHGPOTransforms[HGPOIdx]);
-				InstancedIndices.Add(InstancedHGPOIndices[HGPOIdx]);
-			}
+		// Add the UObject and the HGPO transforms to the output arrays
+		for (const auto& MatchingOutputObj : ObjectsToInstance)
+		{
+			InstancedObjects.Add(MatchingOutputObj);
+			InstancedTransforms.Add(InInstancedHGPOTransforms[HGPOIdx]);
+			InstancedIndices.Add(InInstancedHGPOIndices[HGPOIdx]);
 		}
 	}
-	   
+
 	//
 	if (InstancedObjects.Num() <= 0 || InstancedTransforms.Num() != InstancedObjects.Num()  || InstancedIndices.Num() != InstancedObjects.Num())
 	{
@@ -2541,12 +2626,12 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 		return false;
 
 	FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
-	FFoliageInstance FoliageInstance;
-	int32 CurrentInstanceCount = 0;
-
-	FoliageInfo->ReserveAdditionalInstances(InstancedFoliageActor, FoliageType, InstancedObjectTransforms.Num());
-	for (auto CurrentTransform : InstancedObjectTransforms)
+	TArray<FFoliageInstance> FoliageInstances;
+	FoliageInstances.Reserve(InstancedObjectTransforms.Num());
+	for (const FTransform& CurrentTransform : InstancedObjectTransforms)
 	{
+		FFoliageInstance& FoliageInstance = FoliageInstances.AddDefaulted_GetRef();
+
 		// Use our parent component for the base component of the instances,
 		// this will allow us to clean the instances by component
 		FoliageInstance.BaseComponent = ParentComponent;
@@ -2566,11 +2651,10 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 			FoliageInstance.Rotation = HoudiniAssetTransform.TransformRotation(CurrentTransform.GetRotation()).Rotator();
 			FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
 		}
-
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-		CurrentInstanceCount++;
 	}
 
+	FHoudiniEngineUtils::AddFoliageInstances(InstancedFoliageActor, FoliageType, FoliageInfo, FoliageInstances);
+
 	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();	
 	if (IsValid(FoliageHISMC))
 	{
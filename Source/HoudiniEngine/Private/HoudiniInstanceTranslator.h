@@ -186,6 +186,21 @@ public:
 	void BuildOriginalInstancedTransformsAndObjectArrays();
 };
 
+// Instancer part data that only requires HAPI calls to be gathered.
+// It doesn't reference any UObject so it can be gathered on worker threads, 
+// the instanced objects are then resolved on the game thread by FinishInstancedOutputPartData().
+struct HOUDINIENGINE_API FHoudiniInstancerPartHAPIData
+{
+	// The part data, without the instanced objects
+	FHoudiniInstancedOutputPartData PartData;
+
+	// Packed primitive instancers: the instanced parts and their transforms
+	bool bHasInstancedHGPOs = false;
+	TArray<FHoudiniGeoPartObject> InstancedHGPOs;
+	TArray<TArray<FTransform>> InstancedHGPOTransforms;
+	TArray<TArray<int32>> InstancedHGPOIndices;
+};
+
 struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 {
 	public:
@@ -195,6 +210,19 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<UHoudiniOutput*>& InAllOutputs,
 			FHoudiniInstancedOutputPartData& OutInstancedOutputPartData);
 
+		// Gathers the HAPI data of an instancer part. Doesn't access any UObject, 
+		// so this can be called on worker threads for multiple instancers at once.
+		static bool GatherInstancerPartHAPIData(
+			const FHoudiniGeoPartObject& InHGPO,
+			FHoudiniInstancerPartHAPIData& OutHAPIData);
+
+		// Resolves the instanced objects and builds the part data from the gathered HAPI data.
+		static bool FinishInstancedOutputPartData(
+			const FHoudiniGeoPartObject& InHGPO,
+			const TArray<UHoudiniOutput*>& InAllOutputs,
+			FHoudiniInstancerPartHAPIData& InHAPIData,
+			FHoudiniInstancedOutputPartData& OutInstancedOutputPartData);
+
 		static bool CreateAllInstancersFromHoudiniOutput(
 			UHoudiniOutput* InOutput,
 			const TArray<UHoudiniOutput*>& InAllOutputs,
@@ -212,6 +240,16 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			TArray<FString>& OutSplitAttributeValues,
 			TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes);
 
+		// Finds the objects generated for the instanced HGPOs in the mesh outputs
+		static bool GetInstancedHGPOsObjectsAndTransforms(
+			const TArray<FHoudiniGeoPartObject>& InInstancedHGPOs,
+			const TArray<TArray<FTransform>>& InInstancedHGPOTransforms,
+			const TArray<TArray<int32>>& InInstancedHGPOIndices,
+			const TArray<UHoudiniOutput*>& InAllOutputs,
+			TArray<UObject*>& OutInstancedObjects,
+			TArray<TArray<FTransform>>& OutInstancedTransforms,
+			TArray<TArray<int32>>& OutInstancedIndices);
+
 		static bool GetPackedPrimitiveInstancerHGPOsAndTransforms(
 			const FHoudiniGeoPartObject& InHGPO,
 			TArray<FHoudiniGeoPartObject>& OutInstancedHGPO,
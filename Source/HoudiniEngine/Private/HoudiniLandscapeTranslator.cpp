@@ -431,15 +431,21 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	UPhysicalMaterial* LandscapePhysicalMaterial = nullptr;
 	FHoudiniLandscapeTranslator::GetLandscapeMaterials(*Heightfield, InPackageParams, LandscapeMaterial, LandscapeHoleMaterial, LandscapePhysicalMaterial);
 
+	// Export textures, if enabled. Mostly used for debugging at the moment.
+	bool bExportTexture = CVarHoudiniEngineExportLandscapeTextures.GetValueOnAnyThread() == 1 ? true : false;
+
+	// Heightfield conversions should always use the global float min/max
+	// since they need to be calculated externally, potentially across multiple tiles.
+	// The height data can then be streamed straight to the landscape data, unless we need the float data for the export.
+	const bool bStreamHeightData = !bExportTexture;
+
 	// Extract the float data from the Heightfield.
 	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
 	TArray<float> FloatValues;
 	float FloatMin, FloatMax;
-	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
+	if (!bStreamHeightData && !GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
 		return false;
 
-	// Heightfield conversions should always use the global float min/max
-	// since they need to be calculated externally, potentially across multiple tiles.
 	FloatMin = fGlobalMin;
 	FloatMax = fGlobalMax;
 
@@ -475,8 +481,6 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	// ----------------------------------------------------
 	// Export of layer textures
 	// ----------------------------------------------------
-	// Export textures, if enabled. Mostly used for debugging at the moment.
-	bool bExportTexture = CVarHoudiniEngineExportLandscapeTextures.GetValueOnAnyThread() == 1 ? true : false;
 	if (bExportTexture)
 	{
 		// Export raw height data to texture
@@ -508,7 +512,16 @@ FHoudiniLandscapeTranslator::OutputLandscape_Temp(
 	// Convert Houdini's heightfield data to Unreal's landscape data
 	TArray<uint16> IntHeightData;
 	FTransform TileTransform;
-	if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+	if (bStreamHeightData)
+	{
+		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+			Heightfield, VolumeInfo,
+			UnrealTileSizeX, UnrealTileSizeY,
+			FloatMin, FloatMax,
+			IntHeightData, TileTransform))
+			return false;
+	}
+	else if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 		FloatValues, VolumeInfo,
 		UnrealTileSizeX, UnrealTileSizeY,
 		FloatMin, FloatMax,
@@ -2118,6 +2131,101 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	const bool NoResize,
 	const bool bOverrideZScale,
 	const float CustomZScale)
+{
+	// HF sizes needs an X/Y swap
+	const int32 HoudiniXSize = HeightfieldVolumeInfo.YLength;
+	const int32 HoudiniYSize = HeightfieldVolumeInfo.XLength;
+	auto FillIntHeightData = [&](TFunctionRef<uint16(float)> ToDigit, TArray<uint16>& OutIntHeightData)
+	{
+		if (HeightfieldFloatValues.Num() < HoudiniXSize * HoudiniYSize)
+			return false;
+
+		int32 nUnreal = 0;
+		for (int32 nY = 0; nY < HoudiniYSize; nY++)
+		{
+			for (int32 nX = 0; nX < HoudiniXSize; nX++)
+			{
+				// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
+				int32 nHoudini = nY + nX * HoudiniYSize;
+				OutIntHeightData[nUnreal++] = ToDigit(HeightfieldFloatValues[nHoudini]);
+			}
+		}
+
+		return true;
+	};
+
+	return ConvertHeightfieldDataToLandscapeDataInternal(
+		FillIntHeightData, HeightfieldVolumeInfo, FinalXSize, FinalYSize, FloatMin, FloatMax,
+		IntHeightData, LandscapeTransform, NoResize, bOverrideZScale, CustomZScale);
+}
+
+bool
+FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+	const FHoudiniGeoPartObject* Heightfield,
+	const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+	const int32& FinalXSize, const int32& FinalYSize,
+	float FloatMin, float FloatMax,
+	TArray< uint16 >& IntHeightData,
+	FTransform& LandscapeTransform,
+	const bool NoResize,
+	const bool bOverrideZScale,
+	const float CustomZScale)
+{
+	HAPI_VolumeInfo VolumeInfo;
+	if (!Heightfield || !GetHoudiniHeightfieldVolumeInfo(Heightfield, VolumeInfo))
+		return false;
+
+	auto FillIntHeightData = [&](TFunctionRef<uint16(float)> ToDigit, TArray<uint16>& OutIntHeightData)
+	{
+		// Houdini's X is Unreal's Y, so the voxel (X, Y) goes to Unreal's index Y + X * YLength
+		const int32 YLength = VolumeInfo.yLength;
+		auto ConvertTile = [&](int32 StartX, int32 StartY, int32 SizeX, int32 SizeY, const float* Values, int32 Stride)
+		{
+			for (int32 Y = 0; Y < SizeY; Y++)
+			{
+				for (int32 X = 0; X < SizeX; X++)
+				{
+					OutIntHeightData[(StartY + Y) + (StartX + X) * YLength] = ToDigit(Values[X + Y * Stride]);
+				}
+			}
+		};
+
+		if (ForEachHeightfieldTile(Heightfield, VolumeInfo, ConvertTile))
+			return true;
+
+		// Fall back to fetching the whole heightfield if the tiles couldn't be read
+		TArray<float> FloatValues;
+		float UnusedMin, UnusedMax;
+		if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, UnusedMin, UnusedMax))
+			return false;
+
+		for (int32 X = 0; X < VolumeInfo.xLength; X++)
+		{
+			for (int32 Y = 0; Y < YLength; Y++)
+			{
+				OutIntHeightData[Y + X * YLength] = ToDigit(FloatValues[X + Y * VolumeInfo.xLength]);
+			}
+		}
+
+		return true;
+	};
+
+	return ConvertHeightfieldDataToLandscapeDataInternal(
+		FillIntHeightData, HeightfieldVolumeInfo, FinalXSize, FinalYSize, FloatMin, FloatMax,
+		IntHeightData, LandscapeTransform, NoResize, bOverrideZScale, CustomZScale);
+}
+
+bool
+FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeDataInternal(
+	TFunctionRef<bool(TFunctionRef<uint16(float)> ToDigit, TArray<uint16>& OutIntHeightData)> FillIntHeightData,
+	const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+	const int32& FinalXSize, const int32& FinalYSize,
+	float FloatMin, float FloatMax,
+	TArray< uint16 >& IntHeightData,
+	FTransform& LandscapeTransform,
+	const bool NoResize,
+	const bool bOverrideZScale,
+	const float CustomZScale)
 {
 	IntHeightData.Empty();
 	LandscapeTransform.SetIdentity();
@@ -2204,22 +2312,18 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	// For correct orientation in unreal, the point matrix has to be transposed.
 	IntHeightData.SetNumUninitialized(SizeInPoints);
 
-	int32 nUnreal = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
+	auto ToDigit = [FloatMin, ZSpacing, DigitCenterOffset](float HoudiniValue) -> uint16
 	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
+		// Get the double values in [0 - ZRange]
+		double DoubleValue = (double)HoudiniValue - (double)FloatMin;
 
-			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)HeightfieldFloatValues[nHoudini] - (double)FloatMin;
+		// Then convert it to [0 - DesiredRange] and center it 
+		DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
+		return FMath::RoundToInt(DoubleValue);
+	};
 
-			// Then convert it to [0 - DesiredRange] and center it 
-			DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
-			IntHeightData[nUnreal++] = FMath::RoundToInt(DoubleValue);
-		}
-	}
+	if (!FillIntHeightData(ToDigit, IntHeightData))
+		return false;
 
 	//--------------------------------------------------------------------------------------------------
 	// 2. Resample / Pad the int data so that if fits unreal size requirements
@@ -2811,6 +2915,33 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 	const int32 SizeInPoints = VolumeInfo.xLength *  VolumeInfo.yLength;
 
 	OutFloatArr.SetNum(SizeInPoints);
+
+	// Copy the tiles in the array and compute the min/max as they are streamed
+	float StreamedMin = TNumericLimits<float>::Max();
+	float StreamedMax = TNumericLimits<float>::Lowest();
+	auto CopyTile = [&](int32 StartX, int32 StartY, int32 SizeX, int32 SizeY, const float* Values, int32 Stride)
+	{
+		for (int32 Y = 0; Y < SizeY; Y++)
+		{
+			float* Dest = OutFloatArr.GetData() + StartX + (StartY + Y) * VolumeInfo.xLength;
+			const float* Src = Values + Y * Stride;
+			for (int32 X = 0; X < SizeX; X++)
+			{
+				Dest[X] = Src[X];
+				StreamedMin = FMath::Min(StreamedMin, Src[X]);
+				StreamedMax = FMath::Max(StreamedMax, Src[X]);
+			}
+		}
+	};
+
+	if (ForEachHeightfieldTile(HGPO, VolumeInfo, CopyTile))
+	{
+		OutFloatMin = StreamedMin;
+		OutFloatMax = StreamedMax;
+		return true;
+	}
+
+	// Fall back to fetching the whole array if the tiles couldn't be read
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetHeightFieldData(
 		FHoudiniEngine::Get().GetSession(),
 		HGPO->GeoId, HGPO->PartId,
@@ -2833,6 +2964,61 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 	return true;
 }
 
+bool
+FHoudiniLandscapeTranslator::ForEachHeightfieldTile(
+	const FHoudiniGeoPartObject* HGPO,
+	const HAPI_VolumeInfo& VolumeInfo,
+	TFunctionRef<void(int32 StartX, int32 StartY, int32 SizeX, int32 SizeY, const float* Values, int32 Stride)> InTileFunc)
+{
+	if (!HGPO || VolumeInfo.tileSize <= 0)
+		return false;
+
+	const int32 TileSize = VolumeInfo.tileSize;
+
+	// Tiles are cubes, even if heightfields only use their first slice
+	TArray<float> TileValues;
+	TileValues.SetNumUninitialized(TileSize * TileSize * TileSize * VolumeInfo.tupleSize);
+
+	HAPI_VolumeTileInfo TileInfo;
+	FHoudiniApi::VolumeTileInfo_Init(&TileInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetFirstVolumeTile(
+		FHoudiniEngine::Get().GetSession(),
+		HGPO->GeoId, HGPO->PartId, &TileInfo), false);
+
+	int64 NumVoxelsRead = 0;
+	while (TileInfo.isValid)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetVolumeTileFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			HGPO->GeoId, HGPO->PartId, 0.0f, &TileInfo,
+			TileValues.GetData(), TileValues.Num()), false);
+
+		// Clip the tile to the heightfield
+		const int32 StartX = TileInfo.minX - VolumeInfo.minX;
+		const int32 StartY = TileInfo.minY - VolumeInfo.minY;
+		const int32 SizeX = FMath::Min(TileSize, VolumeInfo.xLength - StartX);
+		const int32 SizeY = FMath::Min(TileSize, VolumeInfo.yLength - StartY);
+		if (StartX >= 0 && StartY >= 0 && SizeX > 0 && SizeY > 0)
+		{
+			InTileFunc(StartX, StartY, SizeX, SizeY, TileValues.GetData(), TileSize);
+			NumVoxelsRead += SizeX * SizeY;
+		}
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetNextVolumeTile(
+			FHoudiniEngine::Get().GetSession(),
+			HGPO->GeoId, HGPO->PartId, &TileInfo), false);
+	}
+
+	if (NumVoxelsRead != (int64)VolumeInfo.xLength * VolumeInfo.yLength)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Heightfield volume tiles only covered %lld of %d voxels."),
+			NumVoxelsRead, VolumeInfo.xLength * VolumeInfo.yLength);
+		return false;
+	}
+
+	return true;
+}
+
 bool
 FHoudiniLandscapeTranslator::GetNonWeightBlendedLayerNames(const FHoudiniGeoPartObject& InHGPO, TArray<FString>& NonWeightBlendedLayerNames)
 {
@@ -252,6 +252,14 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			float &OutFloatMin,
 			float &OutFloatMax);
 
+		// Iterates on the volume tiles of a heightfield, only holding one tile in memory at a time.
+		// InTileFunc receives the tile's start and size (clipped to the heightfield) and its values,
+		// indexed by X + Y * Stride. Returns false if the tiles didn't cover the whole heightfield.
+		static bool ForEachHeightfieldTile(
+			const FHoudiniGeoPartObject* HGPO,
+			const HAPI_VolumeInfo& VolumeInfo,
+			TFunctionRef<void(int32 StartX, int32 StartY, int32 SizeX, int32 SizeY, const float* Values, int32 Stride)> InTileFunc);
+
 		static bool CalcLandscapeSizeFromHeightfieldSize(
 			const int32& HoudiniSizeX,
 			const int32& HoudiniSizeY,
@@ -273,6 +281,36 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			const bool bOverrideZScale = false,
 			const float CustomZScale = 100.f);
 
+		// Same as above, but streams the heightfield's volume tiles straight into the uint16 data
+		// instead of fetching the whole float data first. FloatMin/FloatMax must be known beforehand.
+		static bool ConvertHeightfieldDataToLandscapeData(
+			const FHoudiniGeoPartObject* Heightfield,
+			const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+			const int32& FinalXSize,
+			const int32& FinalYSize,
+			float FloatMin,
+			float FloatMax,
+			TArray< uint16 >& IntHeightData,
+			FTransform& LandscapeTransform,
+			const bool NoResize = false,
+			const bool bOverrideZScale = false,
+			const float CustomZScale = 100.f);
+
+		// Shared implementation of the conversions above, FillIntHeightData must fill the transposed
+		// uint16 height data using the given Houdini value to Unreal digit conversion.
+		static bool ConvertHeightfieldDataToLandscapeDataInternal(
+			TFunctionRef<bool(TFunctionRef<uint16(float)> ToDigit, TArray<uint16>& OutIntHeightData)> FillIntHeightData,
+			const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+			const int32& FinalXSize,
+			const int32& FinalYSize,
+			float FloatMin,
+			float FloatMax,
+			TArray< uint16 >& IntHeightData,
+			FTransform& LandscapeTransform,
+			const bool NoResize,
+			const bool bOverrideZScale,
+			const float CustomZScale);
+
 		static bool ResizeHeightDataForLandscape(
 			TArray<uint16>& HeightData,
 			const int32& SizeX,
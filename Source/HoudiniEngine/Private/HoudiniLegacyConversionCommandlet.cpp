@@ -0,0 +1,283 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniLegacyConversionCommandlet.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniPluginSerializationVersion.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/PackageFileSummary.h"
+#include "UObject/UObjectHash.h"
+
+
+UHoudiniLegacyConversionCommandlet::UHoudiniLegacyConversionCommandlet()
+{
+	HelpDescription = TEXT("Converts the legacy (v1) Houdini Asset Components of all the maps in a directory to v2, and saves the maps.");
+
+	HelpUsage = TEXT("HoudiniLegacyConversion Usage: HoudiniLegacyConversion [-dir=/Game/Maps] [-nosave] [-report=filename.csv]");
+
+	HelpParamNames = {
+		"help",
+		"dir",
+		"nosave",
+		"report"
+	};
+
+	HelpParamDescriptions = {
+		"Displays this help.",
+		"The content directory (ie /Game/Maps) to look for maps in, recursively. Defaults to /Game.",
+		"Only convert the maps in memory and report the conversion times, do not save them.",
+		"Write the per map conversion results to a CSV file."
+	};
+
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowProgress = false;
+	ShowErrorCount = false;
+}
+
+void UHoudiniLegacyConversionCommandlet::PrintUsage() const
+{
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpDescription);
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpUsage);
+	const int32 NumOptions = HelpParamNames.Num();
+	for (int32 Idx = 0; Idx < NumOptions; ++Idx)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("-%s\t%s"), *HelpParamNames[Idx], *HelpParamDescriptions[Idx]);
+	}
+}
+
+void UHoudiniLegacyConversionCommandlet::FindLegacyMaps(const FString& InDirectory, TArray<FString>& OutMapFilenames) const
+{
+	TArray<FString> MapFilenames;
+	IFileManager::Get().FindFilesRecursive(
+		MapFilenames, *InDirectory, *(FString(TEXT("*")) + FPackageName::GetMapPackageExtension()), true, false);
+
+	// Reading the package summaries only touches the start of each file, so we can do it for all the maps in parallel
+	TArray<bool> HasLegacyData;
+	HasLegacyData.SetNumZeroed(MapFilenames.Num());
+	ParallelFor(MapFilenames.Num(), [&MapFilenames, &HasLegacyData](int32 Index)
+	{
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*MapFilenames[Index]));
+		if (!Reader)
+			return;
+
+		FPackageFileSummary Summary;
+		*Reader << Summary;
+		if (Reader->IsError() || Summary.Tag != PACKAGE_FILE_TAG)
+			return;
+
+		HasLegacyData[Index] = HasLegacyHoudiniData(Summary);
+	});
+
+	for (int32 Index = 0; Index < MapFilenames.Num(); Index++)
+	{
+		if (HasLegacyData[Index])
+			OutMapFilenames.Add(MapFilenames[Index]);
+	}
+}
+
+bool UHoudiniLegacyConversionCommandlet::HasLegacyHoudiniData(const FPackageFileSummary& InSummary)
+{
+	// Maps saved with legacy Houdini Asset Components use a v1 version of our custom version
+	const FCustomVersion* HoudiniVersion = InSummary.GetCustomVersionContainer().GetVersion(FHoudiniCustomSerializationVersion::GUID);
+	return HoudiniVersion
+		&& HoudiniVersion->Version >= VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BASE
+		&& HoudiniVersion->Version < VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_BASE;
+}
+
+void UHoudiniLegacyConversionCommandlet::CountLegacyComponents(UPackage* InPackage, int32& OutNumConverted, int32& OutNumFailed)
+{
+	OutNumConverted = 0;
+	OutNumFailed = 0;
+	if (!IsValid(InPackage))
+		return;
+
+	// ConvertLegacyData releases the legacy data once it is converted, so look at the flag it sets instead
+	ForEachObjectWithPackage(InPackage, [&OutNumConverted, &OutNumFailed](UObject* Object)
+	{
+		UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(Object);
+		if (!IsValid(HAC))
+			return true;
+
+		if (HAC->bConvertedFromLegacyData)
+			OutNumConverted++;
+		else if (HAC->Version1CompatibilityHAC)
+			OutNumFailed++;
+		return true;
+	});
+}
+
+bool UHoudiniLegacyConversionCommandlet::ConvertMap(
+	const FString& InMapFilename, bool bInSave, FHoudiniLegacyMapConversionResult& OutResult) const
+{
+	if (!FPackageName::TryConvertFilenameToLongPackageName(InMapFilename, OutResult.MapPackageName))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not get the package name of map %s"), *InMapFilename);
+		return false;
+	}
+
+	OutResult.FileSize = IFileManager::Get().FileSize(*InMapFilename);
+
+	// The legacy data is converted in UHoudiniAssetComponent::PostLoad
+	const double LoadStartTime = FPlatformTime::Seconds();
+	UPackage* Package = LoadPackage(nullptr, *OutResult.MapPackageName, LOAD_None);
+	OutResult.LoadAndConvertTime = FPlatformTime::Seconds() - LoadStartTime;
+	if (!Package)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not load map %s"), *OutResult.MapPackageName);
+		return false;
+	}
+
+	UWorld* World = UWorld::FindWorldInPackage(Package);
+	if (!World)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not find a world in %s"), *OutResult.MapPackageName);
+		return false;
+	}
+
+	int32 NumFailedComponents = 0;
+	CountLegacyComponents(Package, OutResult.NumConvertedComponents, NumFailedComponents);
+
+	if (NumFailedComponents > 0)
+		HOUDINI_LOG_WARNING(TEXT("%s: could not convert %d legacy components"), *OutResult.MapPackageName, NumFailedComponents);
+
+	// The map was found by its legacy custom version, so save it even if none of its components needed converting:
+	// this upgrades its version and it won't be picked up again by the next run
+	if (!bInSave)
+		return true;
+
+	const double SaveStartTime = FPlatformTime::Seconds();
+	OutResult.bSaved = UPackage::SavePackage(Package, World, RF_NoFlags, *InMapFilename, GError, nullptr, false, true, SAVE_NoError);
+	OutResult.SaveTime = FPlatformTime::Seconds() - SaveStartTime;
+	if (!OutResult.bSaved)
+		HOUDINI_LOG_ERROR(TEXT("Could not save map %s"), *OutResult.MapPackageName);
+
+	return OutResult.bSaved;
+}
+
+bool UHoudiniLegacyConversionCommandlet::WriteReport(
+	const FString& InFilename, const TArray<FHoudiniLegacyMapConversionResult>& InResults) const
+{
+	TArray<FString> Lines;
+	Lines.Add(TEXT("Map,FileSize,ConvertedComponents,LoadAndConvertSeconds,SaveSeconds,ComponentsPerSecond,MegabytesPerSecond,Saved"));
+	for (const FHoudiniLegacyMapConversionResult& Result : InResults)
+	{
+		const double TotalTime = Result.LoadAndConvertTime + Result.SaveTime;
+		Lines.Add(FString::Printf(
+			TEXT("%s,%lld,%d,%.3f,%.3f,%.1f,%.2f,%d"),
+			*Result.MapPackageName,
+			Result.FileSize,
+			Result.NumConvertedComponents,
+			Result.LoadAndConvertTime,
+			Result.SaveTime,
+			TotalTime > 0.0 ? Result.NumConvertedComponents / TotalTime : 0.0,
+			TotalTime > 0.0 ? Result.FileSize / (1024.0 * 1024.0) / TotalTime : 0.0,
+			Result.bSaved ? 1 : 0));
+	}
+
+	return FFileHelper::SaveStringArrayToFile(Lines, *InFilename);
+}
+
+int32 UHoudiniLegacyConversionCommandlet::Main(const FString& InParams)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*InParams, Tokens, Switches, Params);
+
+	if (Switches.Contains(TEXT("help")) || Switches.Contains(TEXT("?")))
+	{
+		PrintUsage();
+		return 0;
+	}
+
+	const FString ContentDirectory = Params.Contains(TEXT("dir")) ? Params.FindChecked(TEXT("dir")) : TEXT("/Game");
+	FString Directory;
+	if (!FPackageName::TryConvertLongPackageNameToFilename(ContentDirectory / TEXT(""), Directory))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Invalid content directory: %s"), *ContentDirectory);
+		return 1;
+	}
+
+	const bool bSave = !Switches.Contains(TEXT("nosave"));
+
+	// The legacy data is only converted when backward compatibility is enabled
+	UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetMutableDefault<UHoudiniRuntimeSettings>();
+	const bool bPreviousEnableBackwardCompatibility = HoudiniRuntimeSettings->bEnableBackwardCompatibility;
+	HoudiniRuntimeSettings->bEnableBackwardCompatibility = true;
+
+	const double ScanStartTime = FPlatformTime::Seconds();
+	TArray<FString> MapFilenames;
+	FindLegacyMaps(Directory, MapFilenames);
+	HOUDINI_LOG_DISPLAY(
+		TEXT("Found %d maps with legacy Houdini data in %s in %.3fs"),
+		MapFilenames.Num(), *ContentDirectory, FPlatformTime::Seconds() - ScanStartTime);
+
+	// Loading and converting the maps creates UObjects, this has to be done on the game thread, one map at a time
+	TArray<FHoudiniLegacyMapConversionResult> Results;
+	int32 NumFailed = 0;
+	for (const FString& MapFilename : MapFilenames)
+	{
+		FHoudiniLegacyMapConversionResult& Result = Results.AddDefaulted_GetRef();
+		if (!ConvertMap(MapFilename, bSave, Result))
+			NumFailed++;
+
+		const double TotalTime = Result.LoadAndConvertTime + Result.SaveTime;
+		HOUDINI_LOG_DISPLAY(
+			TEXT("%s: converted %d components in %.3fs (load %.3fs, save %.3fs), %.1f components/s, %.2f MB/s"),
+			*Result.MapPackageName, Result.NumConvertedComponents, TotalTime, Result.LoadAndConvertTime, Result.SaveTime,
+			TotalTime > 0.0 ? Result.NumConvertedComponents / TotalTime : 0.0,
+			TotalTime > 0.0 ? Result.FileSize / (1024.0 * 1024.0) / TotalTime : 0.0);
+
+		// Unload the map before converting the next one
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	HoudiniRuntimeSettings->bEnableBackwardCompatibility = bPreviousEnableBackwardCompatibility;
+
+	if (Params.Contains(TEXT("report")))
+	{
+		const FString ReportFilename = Params.FindChecked(TEXT("report"));
+		if (!WriteReport(ReportFilename, Results))
+			HOUDINI_LOG_ERROR(TEXT("Could not write the conversion report to %s"), *ReportFilename);
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("Converted %d maps, %d failed."), MapFilenames.Num() - NumFailed, NumFailed);
+
+	return NumFailed > 0 ? 2 : 0;
+}
@@ -0,0 +1,95 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+
+#include "HoudiniLegacyConversionCommandlet.generated.h"
+
+class UPackage;
+struct FPackageFileSummary;
+
+// Conversion results for a single map
+struct FHoudiniLegacyMapConversionResult
+{
+	// Long package name of the map
+	FString MapPackageName;
+
+	// Size of the map file before conversion, in bytes
+	int64 FileSize = 0;
+
+	// Number of legacy (v1) Houdini Asset Components converted to v2
+	int32 NumConvertedComponents = 0;
+
+	// Time spent loading the map, which includes the v1 to v2 conversion done in PostLoad
+	double LoadAndConvertTime = 0.0;
+
+	// Time spent saving the converted map
+	double SaveTime = 0.0;
+
+	bool bSaved = false;
+};
+
+UCLASS()
+class HOUDINIENGINE_API UHoudiniLegacyConversionCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UHoudiniLegacyConversionCommandlet();
+
+	void PrintUsage() const;
+
+	/**
+	* Entry point for the commandlet
+	*
+	* @param Params the string containing the parameters for the commandlet
+	*/
+	virtual int32 Main(const FString& Params) override;
+
+	// Returns true if a package was saved with a legacy (v1) version of the Houdini custom version
+	static bool HasLegacyHoudiniData(const FPackageFileSummary& InSummary);
+
+	// Counts the Houdini Asset Components of InPackage that were converted from legacy data when the package
+	// was loaded, and the ones that still hold legacy data because their conversion failed
+	static void CountLegacyComponents(UPackage* InPackage, int32& OutNumConverted, int32& OutNumFailed);
+
+protected:
+
+	// Finds the maps in InDirectory that contain legacy v1 Houdini data.
+	// Only the package file summaries are read, in parallel.
+	void FindLegacyMaps(const FString& InDirectory, TArray<FString>& OutMapFilenames) const;
+
+	// Loads a map (converting its legacy Houdini Asset Components) and saves it if bInSave is true
+	bool ConvertMap(const FString& InMapFilename, bool bInSave, FHoudiniLegacyMapConversionResult& OutResult) const;
+
+	// Writes the conversion results as CSV to InFilename
+	bool WriteReport(const FString& InFilename, const TArray<FHoudiniLegacyMapConversionResult>& InResults) const;
+};
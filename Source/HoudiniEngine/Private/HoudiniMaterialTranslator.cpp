@@ -52,6 +52,8 @@
 #include "PackageTools.h"
 #include "AssetRegistryModule.h"
 #include "UObject/MetaData.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
 
 #if WITH_EDITOR
 	#include "Factories/MaterialFactoryNew.h"
@@ -585,15 +587,68 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	const FCreateTexture2DParameters& TextureParameters,
 	const TextureGroup& LODGroup, 
 	const FString& TextureType,
-	const FString& NodePath)
+	const FString& NodePath,
+	bool& bOutTextureUpdated)
 {
+	bOutTextureUpdated = false;
+
 	if (!Package || Package->IsPendingKill())
 		return nullptr;
 
+	// Get the size and channel offsets of a source pixel for the extracted packing.
+	// Single and dual channel images are expanded to grayscale.
+	uint32 SrcPixelSize = 4;
+	int32 SrcR = 0, SrcG = 1, SrcB = 2, SrcA = 3;
+	switch (ImageInfo.packing)
+	{
+		case HAPI_IMAGE_PACKING_SINGLE:
+			SrcPixelSize = 1; SrcR = 0; SrcG = 0; SrcB = 0; SrcA = -1;
+			break;
+		case HAPI_IMAGE_PACKING_DUAL:
+			SrcPixelSize = 2; SrcR = 0; SrcG = 0; SrcB = 0; SrcA = 1;
+			break;
+		case HAPI_IMAGE_PACKING_RGB:
+			SrcPixelSize = 3; SrcR = 0; SrcG = 1; SrcB = 2; SrcA = -1;
+			break;
+		case HAPI_IMAGE_PACKING_BGR:
+			SrcPixelSize = 3; SrcR = 2; SrcG = 1; SrcB = 0; SrcA = -1;
+			break;
+		case HAPI_IMAGE_PACKING_RGBA:
+			SrcPixelSize = 4; SrcR = 0; SrcG = 1; SrcB = 2; SrcA = 3;
+			break;
+		case HAPI_IMAGE_PACKING_ABGR:
+			SrcPixelSize = 4; SrcR = 3; SrcG = 2; SrcB = 1; SrcA = 0;
+			break;
+		default:
+			HOUDINI_LOG_WARNING(TEXT("Unsupported image packing for texture %s."), *TextureName);
+			return nullptr;
+	}
+
+	const uint32 SrcWidth = ImageInfo.xRes;
+	const uint32 SrcHeight = ImageInfo.yRes;
+	if (ImageBuffer.Num() < (int32)(SrcWidth * SrcHeight * SrcPixelSize))
+	{
+		HOUDINI_LOG_WARNING(
+			TEXT("Extracted image data for texture %s is smaller than its %dx%d resolution."),
+			*TextureName, SrcWidth, SrcHeight);
+		return nullptr;
+	}
+
+	// Hash the image and the texture parameters, so we can skip the update of existing textures that haven't changed
+	const FString TextureHash = FHoudiniMaterialTranslator::ComputeImageHash(ImageInfo, ImageBuffer, TextureParameters);
+
 	UTexture2D * Texture = nullptr;
 	if (ExistingTexture)
 	{
 		Texture = ExistingTexture;
+
+		UMetaData* MetaData = Package->GetMetaData();
+		if (MetaData && MetaData->HasValue(Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH)
+			&& MetaData->GetValue(Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH).Equals(TextureHash))
+		{
+			// The texture is up to date, no need to update its source or recompress it
+			return Texture;
+		}
 	}
 	else
 	{
@@ -615,6 +670,8 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 		Package, Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE, *TextureType);
 	FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
 		Package, Texture, HAPI_UNREAL_PACKAGE_META_NODE_PATH, *NodePath);
+	FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+		Package, Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH, *TextureHash);
 
 	// Initialize texture source.
 	Texture->Source.Init(ImageInfo.xRes, ImageInfo.yRes, 1, 1, TSF_BGRA8);
@@ -622,51 +679,44 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	// Lock the texture.
 	uint8 * MipData = Texture->Source.LockMip(0);
 
-	// Create base map.
-	uint8* DestPtr = nullptr;
-	uint32 SrcWidth = ImageInfo.xRes;
-	uint32 SrcHeight = ImageInfo.yRes;
+	// Create base map, converting the rows to BGRA on worker threads.
+	// Houdini's rows are stored bottom to top.
 	const char * SrcData = &ImageBuffer[0];
+	const bool bUseAlpha = TextureParameters.bUseAlpha && SrcA >= 0;
+
+	TArray<bool> RowHasAlphaValue;
+	RowHasAlphaValue.SetNumZeroed(SrcHeight);
 
-	for (uint32 y = 0; y < SrcHeight; y++)
+	ParallelFor(SrcHeight, [&](int32 y)
 	{
-		DestPtr = &MipData[(SrcHeight - 1 - y) * SrcWidth * sizeof(FColor)];
+		uint8* DestPtr = &MipData[(SrcHeight - 1 - y) * SrcWidth * sizeof(FColor)];
+		const uint8* SrcPtr = (const uint8*)(SrcData + y * SrcWidth * SrcPixelSize);
 
+		bool bHasAlphaValue = false;
 		for (uint32 x = 0; x < SrcWidth; x++)
 		{
-			uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 2); // B
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 1); // G
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 0); // R
+			*DestPtr++ = SrcPtr[SrcB]; // B
+			*DestPtr++ = SrcPtr[SrcG]; // G
+			*DestPtr++ = SrcPtr[SrcR]; // R
 
-			if (TextureParameters.bUseAlpha)
-				*DestPtr++ = *(uint8*)(SrcData + DataOffset + 3); // A
+			if (bUseAlpha)
+			{
+				// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
+				*DestPtr++ = SrcPtr[SrcA]; // A
+				bHasAlphaValue |= (SrcPtr[SrcA] != 0xFF);
+			}
 			else
-				*DestPtr++ = 0xFF;
-		}
-	}
-
-	bool bHasAlphaValue = false;
-	if (TextureParameters.bUseAlpha)
-	{
-		// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-		for (uint32 y = 0; y < SrcHeight; y++)
-		{
-			for (uint32 x = 0; x < SrcWidth; x++)
 			{
-				uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-				if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-				{
-					bHasAlphaValue = true;
-					break;
-				}
+				*DestPtr++ = 0xFF;
 			}
 
-			if (bHasAlphaValue)
-				break;
+			SrcPtr += SrcPixelSize;
 		}
-	}
+
+		RowHasAlphaValue[y] = bHasAlphaValue;
+	});
+
+	const bool bHasAlphaValue = RowHasAlphaValue.Contains(true);
 
 	// Unlock the texture.
 	Texture->Source.UnlockMip(0);
@@ -685,11 +735,45 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	}
 	*/
 
-	Texture->PostEditChange();
+	// PostEditChange will be called by the caller once the texture has been set up,
+	// calling it here as well would compress the texture twice.
+	bOutTextureUpdated = true;
 
 	return Texture;
 }
 
+FString
+FHoudiniMaterialTranslator::ComputeImageHash(
+	const HAPI_ImageInfo& ImageInfo,
+	const TArray<char>& ImageBuffer,
+	const FCreateTexture2DParameters& TextureParameters)
+{
+	// Hash the image in chunks on worker threads, then combine the chunk hashes
+	const int32 ChunkSize = 1024 * 1024;
+	const int32 NumChunks = FMath::DivideAndRoundUp(ImageBuffer.Num(), ChunkSize);
+
+	TArray<uint64> Hashes;
+	Hashes.SetNumZeroed(NumChunks + 3);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 Start = ChunkIdx * ChunkSize;
+		const int32 Length = FMath::Min(ChunkSize, ImageBuffer.Num() - Start);
+		Hashes[ChunkIdx] = CityHash64(ImageBuffer.GetData() + Start, Length);
+	});
+
+	// The texture parameters affect the generated texture as well
+	Hashes[NumChunks] = ((uint64)ImageInfo.xRes << 32) | (uint32)ImageInfo.yRes;
+	Hashes[NumChunks + 1] = 
+		((uint64)TextureParameters.CompressionSettings << 8)
+		| (TextureParameters.bUseAlpha ? 1 : 0)
+		| (TextureParameters.bSRGB ? 2 : 0)
+		| (TextureParameters.bDeferCompression ? 4 : 0);
+	Hashes[NumChunks + 2] = (uint64)ImageInfo.packing;
+
+	const uint64 Hash = CityHash64((const char*)Hashes.GetData(), Hashes.Num() * sizeof(uint64));
+	return FString::Printf(TEXT("%016llx"), Hash);
+}
+
 
 
 bool
@@ -1028,6 +1112,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing diffuse texture, or create new one.
+				bool bTextureDiffuseUpdated = false;
 				TextureDiffuse = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureDiffuse,
 					ImageInfo,
@@ -1037,34 +1122,42 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-					NodePath);
-
-				//if (BakeMode == EBakeMode::CookToTemp)
-				TextureDiffuse->SetFlags(RF_Public | RF_Standalone);
+					NodePath,
+					bTextureDiffuseUpdated);
 
-				// Create diffuse sampling expression, if needed.
-				if (!ExpressionTextureSample)
+				if (IsValid(TextureDiffuse))
 				{
-					ExpressionTextureSample = NewObject<UMaterialExpressionTextureSampleParameter2D>(
-						Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
-				}
+					//if (BakeMode == EBakeMode::CookToTemp)
+					TextureDiffuse->SetFlags(RF_Public | RF_Standalone);
 
-				// Record generating parameter.
-				ExpressionTextureSample->Desc = GeneratingParameterNameDiffuseTexture;
-				ExpressionTextureSample->ParameterName = *GeneratingParameterNameDiffuseTexture;
-				ExpressionTextureSample->Texture = TextureDiffuse;
-				ExpressionTextureSample->SamplerType = SAMPLERTYPE_Color;
+					// Create diffuse sampling expression, if needed.
+					if (!ExpressionTextureSample)
+					{
+						ExpressionTextureSample = NewObject<UMaterialExpressionTextureSampleParameter2D>(
+							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+					}
 
-				// Add expression.
-				Material->Expressions.Add(ExpressionTextureSample);
+					// Record generating parameter.
+					ExpressionTextureSample->Desc = GeneratingParameterNameDiffuseTexture;
+					ExpressionTextureSample->ParameterName = *GeneratingParameterNameDiffuseTexture;
+					ExpressionTextureSample->Texture = TextureDiffuse;
+					ExpressionTextureSample->SamplerType = SAMPLERTYPE_Color;
+
+					// Add expression.
+					Material->Expressions.Add(ExpressionTextureSample);
 
-				// Propagate and trigger diffuse texture updates.
-				if (bCreatedNewTextureDiffuse)
-					FAssetRegistryModule::AssetCreated(TextureDiffuse);
+					// Propagate and trigger diffuse texture updates.
+					if (bCreatedNewTextureDiffuse)
+						FAssetRegistryModule::AssetCreated(TextureDiffuse);
 
-				TextureDiffuse->PreEditChange(nullptr);
-				TextureDiffuse->PostEditChange();
-				TextureDiffuse->MarkPackageDirty();
+					// Only trigger the texture update if its content has changed
+					if (bTextureDiffuseUpdated)
+					{
+						TextureDiffuse->PreEditChange(nullptr);
+						TextureDiffuse->PostEditChange();
+						TextureDiffuse->MarkPackageDirty();
+					}
+				}
 			}
 
 			// Cache the texture package
@@ -1341,6 +1434,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing opacity texture, or create new one.
+				bool bTextureOpacityUpdated = false;
 				TextureOpacity = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureOpacity,
 					ImageInfo,
@@ -1350,55 +1444,63 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-					NodePath);
+					NodePath,
+					bTextureOpacityUpdated);
 
- 				// if (BakeMode == EBakeMode::CookToTemp)
-				TextureOpacity->SetFlags(RF_Public | RF_Standalone);
-
-				// Create opacity sampling expression, if needed.
-				if (!ExpressionTextureOpacitySample)
+				if (IsValid(TextureOpacity))
 				{
-					ExpressionTextureOpacitySample = NewObject< UMaterialExpressionTextureSampleParameter2D >(
-						Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
-				}
+					// if (BakeMode == EBakeMode::CookToTemp)
+					TextureOpacity->SetFlags(RF_Public | RF_Standalone);
 
-				// Record generating parameter.
-				ExpressionTextureOpacitySample->Desc = GeneratingParameterNameTexture;
-				ExpressionTextureOpacitySample->ParameterName = *GeneratingParameterNameTexture;
-				ExpressionTextureOpacitySample->Texture = TextureOpacity;
-				ExpressionTextureOpacitySample->SamplerType = SAMPLERTYPE_Grayscale;
+					// Create opacity sampling expression, if needed.
+					if (!ExpressionTextureOpacitySample)
+					{
+						ExpressionTextureOpacitySample = NewObject< UMaterialExpressionTextureSampleParameter2D >(
+							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+					}
 
-				// Offset node placement.
-				ExpressionTextureOpacitySample->MaterialExpressionEditorX =
-					FHoudiniMaterialTranslator::MaterialExpressionNodeX;
-				ExpressionTextureOpacitySample->MaterialExpressionEditorY = MaterialNodeY;
-				MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
+					// Record generating parameter.
+					ExpressionTextureOpacitySample->Desc = GeneratingParameterNameTexture;
+					ExpressionTextureOpacitySample->ParameterName = *GeneratingParameterNameTexture;
+					ExpressionTextureOpacitySample->Texture = TextureOpacity;
+					ExpressionTextureOpacitySample->SamplerType = SAMPLERTYPE_Grayscale;
 
-				// Add expression.
-				Material->Expressions.Add(ExpressionTextureOpacitySample);
+					// Offset node placement.
+					ExpressionTextureOpacitySample->MaterialExpressionEditorX =
+						FHoudiniMaterialTranslator::MaterialExpressionNodeX;
+					ExpressionTextureOpacitySample->MaterialExpressionEditorY = MaterialNodeY;
+					MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
 
-				// We need to set material type to masked.
-				TArray< FExpressionOutput > ExpressionOutputs = ExpressionTextureOpacitySample->GetOutputs();
-				FExpressionOutput* ExpressionOutput = ExpressionOutputs.GetData();
+					// Add expression.
+					Material->Expressions.Add(ExpressionTextureOpacitySample);
 
-				Material->OpacityMask.Expression = ExpressionTextureOpacitySample;
-				Material->BlendMode = BLEND_Masked;
+					// We need to set material type to masked.
+					TArray< FExpressionOutput > ExpressionOutputs = ExpressionTextureOpacitySample->GetOutputs();
+					FExpressionOutput* ExpressionOutput = ExpressionOutputs.GetData();
 
-				Material->OpacityMask.Mask = ExpressionOutput->Mask;
-				Material->OpacityMask.MaskR = 1;
-				Material->OpacityMask.MaskG = 0;
-				Material->OpacityMask.MaskB = 0;
-				Material->OpacityMask.MaskA = 0;
+					Material->OpacityMask.Expression = ExpressionTextureOpacitySample;
+					Material->BlendMode = BLEND_Masked;
 
-				// Propagate and trigger opacity texture updates.
-				if (bCreatedNewTextureOpacity)
-					FAssetRegistryModule::AssetCreated(TextureOpacity);
+					Material->OpacityMask.Mask = ExpressionOutput->Mask;
+					Material->OpacityMask.MaskR = 1;
+					Material->OpacityMask.MaskG = 0;
+					Material->OpacityMask.MaskB = 0;
+					Material->OpacityMask.MaskA = 0;
 
-				TextureOpacity->PreEditChange(nullptr);
-				TextureOpacity->PostEditChange();
-				TextureOpacity->MarkPackageDirty();
+					// Propagate and trigger opacity texture updates.
+					if (bCreatedNewTextureOpacity)
+						FAssetRegistryModule::AssetCreated(TextureOpacity);
 
-				bExpressionCreated = true;
+					// Only trigger the texture update if its content has changed
+					if (bTextureOpacityUpdated)
+					{
+						TextureOpacity->PreEditChange(nullptr);
+						TextureOpacity->PostEditChange();
+						TextureOpacity->MarkPackageDirty();
+					}
+
+					bExpressionCreated = true;
+				}
 			}
 
 			// Cache the texture package
@@ -1756,6 +1858,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing normal texture, or create new one.
+				bool bTextureNormalUpdated = false;
 				TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureNormal,
 					ImageInfo,
@@ -1765,44 +1868,52 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_WorldNormalMap,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-					NodePath);
+					NodePath,
+					bTextureNormalUpdated);
 
-				//if (BakeMode == EBakeMode::CookToTemp)
-				TextureNormal->SetFlags(RF_Public | RF_Standalone);
+				if (IsValid(TextureNormal))
+				{
+					//if (BakeMode == EBakeMode::CookToTemp)
+					TextureNormal->SetFlags(RF_Public | RF_Standalone);
 
-				// Create normal sampling expression, if needed.
-				if (!ExpressionNormal)
-					ExpressionNormal = NewObject< UMaterialExpressionTextureSampleParameter2D >(
-						Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+					// Create normal sampling expression, if needed.
+					if (!ExpressionNormal)
+						ExpressionNormal = NewObject< UMaterialExpressionTextureSampleParameter2D >(
+							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
 
-				// Record generating parameter.
-				ExpressionNormal->Desc = GeneratingParameterName;
-				ExpressionNormal->ParameterName = *GeneratingParameterName;
+					// Record generating parameter.
+					ExpressionNormal->Desc = GeneratingParameterName;
+					ExpressionNormal->ParameterName = *GeneratingParameterName;
 
-				ExpressionNormal->Texture = TextureNormal;
-				ExpressionNormal->SamplerType = SAMPLERTYPE_Normal;
+					ExpressionNormal->Texture = TextureNormal;
+					ExpressionNormal->SamplerType = SAMPLERTYPE_Normal;
 
-				// Offset node placement.
-				ExpressionNormal->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
-				ExpressionNormal->MaterialExpressionEditorY = MaterialNodeY;
-				MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
+					// Offset node placement.
+					ExpressionNormal->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
+					ExpressionNormal->MaterialExpressionEditorY = MaterialNodeY;
+					MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
 
-				// Set normal space.
-				Material->bTangentSpaceNormal = bTangentSpaceNormal;
+					// Set normal space.
+					Material->bTangentSpaceNormal = bTangentSpaceNormal;
 
-				// Assign expression to material.
-				Material->Expressions.Add(ExpressionNormal);
-				Material->Normal.Expression = ExpressionNormal;
+					// Assign expression to material.
+					Material->Expressions.Add(ExpressionNormal);
+					Material->Normal.Expression = ExpressionNormal;
 
-				bExpressionCreated = true;
+					bExpressionCreated = true;
 
-				// Propagate and trigger normal texture updates.
-				if (bCreatedNewTextureNormal)
-					FAssetRegistryModule::AssetCreated(TextureNormal);
+					// Propagate and trigger normal texture updates.
+					if (bCreatedNewTextureNormal)
+						FAssetRegistryModule::AssetCreated(TextureNormal);
 
-				TextureNormal->PreEditChange(nullptr);
-				TextureNormal->PostEditChange();
-				TextureNormal->MarkPackageDirty();
+					// Only trigger the texture update if its content has changed
+					if (bTextureNormalUpdated)
+					{
+						TextureNormal->PreEditChange(nullptr);
+						TextureNormal->PostEditChange();
+						TextureNormal->MarkPackageDirty();
+					}
+				}
 			}
 
 			// Cache the texture package
@@ -1914,6 +2025,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 					// Reuse existing normal texture, or create new one.
+					bool bTextureNormalUpdated = false;
 					TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
 						TextureNormal, 
 						ImageInfo,
@@ -1923,44 +2035,52 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 						CreateTexture2DParameters,
 						TEXTUREGROUP_WorldNormalMap,
 						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-						NodePath);
+						NodePath,
+						bTextureNormalUpdated);
 
-					//if (BakeMode == EBakeMode::CookToTemp)
-					TextureNormal->SetFlags(RF_Public | RF_Standalone);
-
-					// Create normal sampling expression, if needed.
-					if (!ExpressionNormal)
-						ExpressionNormal = NewObject< UMaterialExpressionTextureSampleParameter2D >(
-							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
-
-					// Record generating parameter.
-					ExpressionNormal->Desc = GeneratingParameterName;
-					ExpressionNormal->ParameterName = *GeneratingParameterName;
-
-					ExpressionNormal->Texture = TextureNormal;
-					ExpressionNormal->SamplerType = SAMPLERTYPE_Normal;
-
-					// Offset node placement.
-					ExpressionNormal->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
-					ExpressionNormal->MaterialExpressionEditorY = MaterialNodeY;
-					MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
-
-					// Set normal space.
-					Material->bTangentSpaceNormal = bTangentSpaceNormal;
-
-					// Assign expression to material.
-					Material->Expressions.Add(ExpressionNormal);
-					Material->Normal.Expression = ExpressionNormal;
-
-					// Propagate and trigger diffuse texture updates.
-					if (bCreatedNewTextureNormal)
-						FAssetRegistryModule::AssetCreated(TextureNormal);
-
-					TextureNormal->PreEditChange(nullptr);
-					TextureNormal->PostEditChange();
-					TextureNormal->MarkPackageDirty();
-
-					bExpressionCreated = true;
+					if (IsValid(TextureNormal))
+					{
+						//if (BakeMode == EBakeMode::CookToTemp)
+						TextureNormal->SetFlags(RF_Public | RF_Standalone);
+
+						// Create normal sampling expression, if needed.
+						if (!ExpressionNormal)
+							ExpressionNormal = NewObject< UMaterialExpressionTextureSampleParameter2D >(
+								Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+
+						// Record generating parameter.
+						ExpressionNormal->Desc = GeneratingParameterName;
+						ExpressionNormal->ParameterName = *GeneratingParameterName;
+
+						ExpressionNormal->Texture = TextureNormal;
+						ExpressionNormal->SamplerType = SAMPLERTYPE_Normal;
+
+						// Offset node placement.
+						ExpressionNormal->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
+						ExpressionNormal->MaterialExpressionEditorY = MaterialNodeY;
+						MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
+
+						// Set normal space.
+						Material->bTangentSpaceNormal = bTangentSpaceNormal;
+
+						// Assign expression to material.
+						Material->Expressions.Add(ExpressionNormal);
+						Material->Normal.Expression = ExpressionNormal;
+
+						// Propagate and trigger diffuse texture updates.
+						if (bCreatedNewTextureNormal)
+							FAssetRegistryModule::AssetCreated(TextureNormal);
+
+						// Only trigger the texture update if its content has changed
+						if (bTextureNormalUpdated)
+						{
+							TextureNormal->PreEditChange(nullptr);
+							TextureNormal->PostEditChange();
+							TextureNormal->MarkPackageDirty();
+						}
+
+						bExpressionCreated = true;
+					}
 				}
 
 				// Cache the texture package
@@ -2102,6 +2222,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing specular texture, or create new one.
+				bool bTextureSpecularUpdated = false;
 				TextureSpecular = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureSpecular,
 					ImageInfo,
@@ -2111,43 +2232,51 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-					NodePath);
-
-				//if (BakeMode == EBakeMode::CookToTemp)
-				TextureSpecular->SetFlags(RF_Public | RF_Standalone);
+					NodePath,
+					bTextureSpecularUpdated);
 
-				// Create specular sampling expression, if needed.
-				if (!ExpressionSpecular)
+				if (IsValid(TextureSpecular))
 				{
-					ExpressionSpecular = NewObject< UMaterialExpressionTextureSampleParameter2D >(
-						Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
-				}
+					//if (BakeMode == EBakeMode::CookToTemp)
+					TextureSpecular->SetFlags(RF_Public | RF_Standalone);
 
-				// Record generating parameter.
-				ExpressionSpecular->Desc = GeneratingParameterName;
-				ExpressionSpecular->ParameterName = *GeneratingParameterName;
+					// Create specular sampling expression, if needed.
+					if (!ExpressionSpecular)
+					{
+						ExpressionSpecular = NewObject< UMaterialExpressionTextureSampleParameter2D >(
+							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+					}
 
-				ExpressionSpecular->Texture = TextureSpecular;
-				ExpressionSpecular->SamplerType = SAMPLERTYPE_LinearGrayscale;
+					// Record generating parameter.
+					ExpressionSpecular->Desc = GeneratingParameterName;
+					ExpressionSpecular->ParameterName = *GeneratingParameterName;
 
-				// Offset node placement.
-				ExpressionSpecular->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
-				ExpressionSpecular->MaterialExpressionEditorY = MaterialNodeY;
-				MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
+					ExpressionSpecular->Texture = TextureSpecular;
+					ExpressionSpecular->SamplerType = SAMPLERTYPE_LinearGrayscale;
 
-				// Assign expression to material.
-				Material->Expressions.Add(ExpressionSpecular);
-				Material->Specular.Expression = ExpressionSpecular;
+					// Offset node placement.
+					ExpressionSpecular->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
+					ExpressionSpecular->MaterialExpressionEditorY = MaterialNodeY;
+					MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
 
-				bExpressionCreated = true;
+					// Assign expression to material.
+					Material->Expressions.Add(ExpressionSpecular);
+					Material->Specular.Expression = ExpressionSpecular;
 
-				// Propagate and trigger specular texture updates.
-				if (bCreatedNewTextureSpecular)
-					FAssetRegistryModule::AssetCreated(TextureSpecular);
+					bExpressionCreated = true;
+
+					// Propagate and trigger specular texture updates.
+					if (bCreatedNewTextureSpecular)
+						FAssetRegistryModule::AssetCreated(TextureSpecular);
 
-				TextureSpecular->PreEditChange(nullptr);
-				TextureSpecular->PostEditChange();
-				TextureSpecular->MarkPackageDirty();
+					// Only trigger the texture update if its content has changed
+					if (bTextureSpecularUpdated)
+					{
+						TextureSpecular->PreEditChange(nullptr);
+						TextureSpecular->PostEditChange();
+						TextureSpecular->MarkPackageDirty();
+					}
+				}
 			}
 
 			// Cache the texture package
@@ -2352,6 +2481,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing roughness texture, or create new one.
+				bool bTextureRoughnessUpdated = false;
 				TextureRoughness = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureRoughness,
 					ImageInfo,
@@ -2361,41 +2491,49 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-					NodePath);
+					NodePath,
+					bTextureRoughnessUpdated);
 
-				//if (BakeMode == EBakeMode::CookToTemp)
-				TextureRoughness->SetFlags(RF_Public | RF_Standalone);
+				if (IsValid(TextureRoughness))
+				{
+					//if (BakeMode == EBakeMode::CookToTemp)
+					TextureRoughness->SetFlags(RF_Public | RF_Standalone);
 
-				// Create roughness sampling expression, if needed.
-				if (!ExpressionRoughness)
-					ExpressionRoughness = NewObject< UMaterialExpressionTextureSampleParameter2D >(
-						Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+					// Create roughness sampling expression, if needed.
+					if (!ExpressionRoughness)
+						ExpressionRoughness = NewObject< UMaterialExpressionTextureSampleParameter2D >(
+							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
 
-				// Record generating parameter.
-				ExpressionRoughness->Desc = GeneratingParameterName;
-				ExpressionRoughness->ParameterName = *GeneratingParameterName;
+					// Record generating parameter.
+					ExpressionRoughness->Desc = GeneratingParameterName;
+					ExpressionRoughness->ParameterName = *GeneratingParameterName;
 
-				ExpressionRoughness->Texture = TextureRoughness;
-				ExpressionRoughness->SamplerType = SAMPLERTYPE_LinearGrayscale;
+					ExpressionRoughness->Texture = TextureRoughness;
+					ExpressionRoughness->SamplerType = SAMPLERTYPE_LinearGrayscale;
 
-				// Offset node placement.
-				ExpressionRoughness->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
-				ExpressionRoughness->MaterialExpressionEditorY = MaterialNodeY;
-				MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
+					// Offset node placement.
+					ExpressionRoughness->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
+					ExpressionRoughness->MaterialExpressionEditorY = MaterialNodeY;
+					MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
 
-				// Assign expression to material.
-				Material->Expressions.Add(ExpressionRoughness);
-				Material->Roughness.Expression = ExpressionRoughness;
+					// Assign expression to material.
+					Material->Expressions.Add(ExpressionRoughness);
+					Material->Roughness.Expression = ExpressionRoughness;
 
-				bExpressionCreated = true;
+					bExpressionCreated = true;
 
-				// Propagate and trigger roughness texture updates.
-				if (bCreatedNewTextureRoughness)
-					FAssetRegistryModule::AssetCreated(TextureRoughness);
+					// Propagate and trigger roughness texture updates.
+					if (bCreatedNewTextureRoughness)
+						FAssetRegistryModule::AssetCreated(TextureRoughness);
 
-				TextureRoughness->PreEditChange(nullptr);
-				TextureRoughness->PostEditChange();
-				TextureRoughness->MarkPackageDirty();
+					// Only trigger the texture update if its content has changed
+					if (bTextureRoughnessUpdated)
+					{
+						TextureRoughness->PreEditChange(nullptr);
+						TextureRoughness->PostEditChange();
+						TextureRoughness->MarkPackageDirty();
+					}
+				}
 			}
 
 			// Cache the texture package
@@ -2606,6 +2744,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing metallic texture, or create new one.
+				bool bTextureMetallicUpdated = false;
 				TextureMetallic = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureMetallic, 
 					ImageInfo,
@@ -2615,41 +2754,49 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-					NodePath);
+					NodePath,
+					bTextureMetallicUpdated);
 
-				//if (BakeMode == EBakeMode::CookToTemp)
-				TextureMetallic->SetFlags(RF_Public | RF_Standalone);
+				if (IsValid(TextureMetallic))
+				{
+					//if (BakeMode == EBakeMode::CookToTemp)
+					TextureMetallic->SetFlags(RF_Public | RF_Standalone);
 
-				// Create metallic sampling expression, if needed.
-				if (!ExpressionMetallic)
-					ExpressionMetallic = NewObject< UMaterialExpressionTextureSampleParameter2D >(
-						Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+					// Create metallic sampling expression, if needed.
+					if (!ExpressionMetallic)
+						ExpressionMetallic = NewObject< UMaterialExpressionTextureSampleParameter2D >(
+							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
 
-				// Record generating parameter.
-				ExpressionMetallic->Desc = GeneratingParameterName;
-				ExpressionMetallic->ParameterName = *GeneratingParameterName;
+					// Record generating parameter.
+					ExpressionMetallic->Desc = GeneratingParameterName;
+					ExpressionMetallic->ParameterName = *GeneratingParameterName;
 
-				ExpressionMetallic->Texture = TextureMetallic;
-				ExpressionMetallic->SamplerType = SAMPLERTYPE_LinearGrayscale;
+					ExpressionMetallic->Texture = TextureMetallic;
+					ExpressionMetallic->SamplerType = SAMPLERTYPE_LinearGrayscale;
 
-				// Offset node placement.
-				ExpressionMetallic->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
-				ExpressionMetallic->MaterialExpressionEditorY = MaterialNodeY;
-				MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
+					// Offset node placement.
+					ExpressionMetallic->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
+					ExpressionMetallic->MaterialExpressionEditorY = MaterialNodeY;
+					MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
 
-				// Assign expression to material.
-				Material->Expressions.Add(ExpressionMetallic);
-				Material->Metallic.Expression = ExpressionMetallic;
+					// Assign expression to material.
+					Material->Expressions.Add(ExpressionMetallic);
+					Material->Metallic.Expression = ExpressionMetallic;
 
-				bExpressionCreated = true;
+					bExpressionCreated = true;
 
-				// Propagate and trigger metallic texture updates.
-				if (bCreatedNewTextureMetallic)
-					FAssetRegistryModule::AssetCreated(TextureMetallic);
+					// Propagate and trigger metallic texture updates.
+					if (bCreatedNewTextureMetallic)
+						FAssetRegistryModule::AssetCreated(TextureMetallic);
 
-				TextureMetallic->PreEditChange(nullptr);
-				TextureMetallic->PostEditChange();
-				TextureMetallic->MarkPackageDirty();
+					// Only trigger the texture update if its content has changed
+					if (bTextureMetallicUpdated)
+					{
+						TextureMetallic->PreEditChange(nullptr);
+						TextureMetallic->PostEditChange();
+						TextureMetallic->MarkPackageDirty();
+					}
+				}
 			}
 
 			// Cache the texture package
@@ -2858,6 +3005,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing emissive texture, or create new one.
+				bool bTextureEmissiveUpdated = false;
 				TextureEmissive = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureEmissive,
 					ImageInfo,
@@ -2867,41 +3015,49 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-					NodePath);
+					NodePath,
+					bTextureEmissiveUpdated);
 
-				//if (BakeMode == EBakeMode::CookToTemp)
-				TextureEmissive->SetFlags(RF_Public | RF_Standalone);
+				if (IsValid(TextureEmissive))
+				{
+					//if (BakeMode == EBakeMode::CookToTemp)
+					TextureEmissive->SetFlags(RF_Public | RF_Standalone);
 
-				// Create emissive sampling expression, if needed.
-				if (!ExpressionEmissive)
-					ExpressionEmissive = NewObject< UMaterialExpressionTextureSampleParameter2D >(
-						Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
+					// Create emissive sampling expression, if needed.
+					if (!ExpressionEmissive)
+						ExpressionEmissive = NewObject< UMaterialExpressionTextureSampleParameter2D >(
+							Material, UMaterialExpressionTextureSampleParameter2D::StaticClass(), NAME_None, ObjectFlag);
 
-				// Record generating parameter.
-				ExpressionEmissive->Desc = GeneratingParameterName;
-				ExpressionEmissive->ParameterName = *GeneratingParameterName;
+					// Record generating parameter.
+					ExpressionEmissive->Desc = GeneratingParameterName;
+					ExpressionEmissive->ParameterName = *GeneratingParameterName;
 
-				ExpressionEmissive->Texture = TextureEmissive;
-				ExpressionEmissive->SamplerType = SAMPLERTYPE_LinearGrayscale;
+					ExpressionEmissive->Texture = TextureEmissive;
+					ExpressionEmissive->SamplerType = SAMPLERTYPE_LinearGrayscale;
 
-				// Offset node placement.
-				ExpressionEmissive->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
-				ExpressionEmissive->MaterialExpressionEditorY = MaterialNodeY;
-				MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
+					// Offset node placement.
+					ExpressionEmissive->MaterialExpressionEditorX = FHoudiniMaterialTranslator::MaterialExpressionNodeX;
+					ExpressionEmissive->MaterialExpressionEditorY = MaterialNodeY;
+					MaterialNodeY += FHoudiniMaterialTranslator::MaterialExpressionNodeStepY;
 
-				// Assign expression to material.
-				Material->Expressions.Add(ExpressionEmissive);
-				Material->EmissiveColor.Expression = ExpressionEmissive;
+					// Assign expression to material.
+					Material->Expressions.Add(ExpressionEmissive);
+					Material->EmissiveColor.Expression = ExpressionEmissive;
 
-				bExpressionCreated = true;
+					bExpressionCreated = true;
 
-				// Propagate and trigger metallic texture updates.
-				if (bCreatedNewTextureEmissive)
-					FAssetRegistryModule::AssetCreated(TextureEmissive);
+					// Propagate and trigger metallic texture updates.
+					if (bCreatedNewTextureEmissive)
+						FAssetRegistryModule::AssetCreated(TextureEmissive);
 
-				TextureEmissive->PreEditChange(nullptr);
-				TextureEmissive->PostEditChange();
-				TextureEmissive->MarkPackageDirty();
+					// Only trigger the texture update if its content has changed
+					if (bTextureEmissiveUpdated)
+					{
+						TextureEmissive->PreEditChange(nullptr);
+						TextureEmissive->PostEditChange();
+						TextureEmissive->MarkPackageDirty();
+					}
+				}
 			}
 
 			// Cache the texture package
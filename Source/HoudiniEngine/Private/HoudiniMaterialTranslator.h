@@ -113,6 +113,7 @@ public:
 
 
 	// Create a texture from given information.
+	// bOutTextureUpdated is false if an existing texture was already up to date with the image.
 	static UTexture2D* CreateUnrealTexture(
 		UTexture2D* ExistingTexture,
 		const HAPI_ImageInfo& ImageInfo,
@@ -122,7 +123,14 @@ public:
 		const FCreateTexture2DParameters& TextureParameters,
 		const TextureGroup& LODGroup,
 		const FString& TextureType,
-		const FString& NodePath);
+		const FString& NodePath,
+		bool& bOutTextureUpdated);
+
+	// Returns a hash of an image extracted from Houdini and the parameters used to create its texture.
+	static FString ComputeImageHash(
+		const HAPI_ImageInfo& ImageInfo,
+		const TArray<char>& ImageBuffer,
+		const FCreateTexture2DParameters& TextureParameters);
 
 	// HAPI : Retrieve a list of image planes.
 	static bool HapiExtractImage(
@@ -33,6 +33,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniAssetActor.h"
@@ -63,6 +64,7 @@
 // #include "Async/ParallelFor.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Misc/SecureHash.h"
 
 #include "EditorSupportDelegates.h"
 
@@ -81,6 +83,65 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+// Instanced part whose meshes were built for a given fingerprint
+struct FHoudiniDeduplicatedMeshSource
+{
+	TWeakObjectPtr<UHoudiniOutput> Output;
+	int32 ObjectId = -1;
+	int32 GeoId = -1;
+	int32 PartId = -1;
+
+	// Time spent translating/building the meshes
+	double BuildTime = 0.0;
+};
+
+// Sources of the deduplicated instanced meshes, per HAC and fingerprint
+static TMap<FString, FHoudiniDeduplicatedMeshSource> DeduplicatedMeshSources;
+
+static FString
+GetDeduplicatedMeshSourceKey(const UHoudiniOutput* InOutput, const FString& InFingerprint)
+{
+	return InOutput->GetOuter()->GetPathName() + TEXT("|") + InFingerprint;
+}
+
+static bool
+IsOutputIdentifierForPart(const FHoudiniOutputObjectIdentifier& InIdentifier, const int32& InObjectId, const int32& InGeoId, const int32& InPartId)
+{
+	return InIdentifier.ObjectId == InObjectId && InIdentifier.GeoId == InGeoId && InIdentifier.PartId == InPartId;
+}
+
+// Gathers the output objects of a part, if they all hold valid meshes built for InFingerprint
+static bool
+GatherFingerprintedOutputObjects(
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOutputObjects,
+	const int32& InObjectId, const int32& InGeoId, const int32& InPartId,
+	const FString& InFingerprint,
+	TArray<TPair<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>>& OutOutputObjects)
+{
+	OutOutputObjects.Empty();
+	for (const auto& Pair : InOutputObjects)
+	{
+		if (!IsOutputIdentifierForPart(Pair.Key, InObjectId, InGeoId, InPartId))
+			continue;
+
+		const FString* FoundFingerprint = Pair.Value.CachedAttributes.Find(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT);
+		if (!FoundFingerprint || !FoundFingerprint->Equals(InFingerprint))
+			return false;
+
+		UObject* OutputObject = Pair.Value.OutputObject;
+		UObject* ProxyObject = Pair.Value.ProxyObject;
+		if ((OutputObject && OutputObject->IsPendingKill()) || (ProxyObject && ProxyObject->IsPendingKill()))
+			return false;
+
+		if (!OutputObject && !ProxyObject)
+			return false;
+
+		OutOutputObjects.Add(Pair);
+	}
+
+	return OutOutputObjects.Num() > 0;
+}
+
 // 
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
@@ -92,7 +153,8 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	const TMap<FString, UMaterialInterface*>& InAllOutputMaterials,
 	UObject* InOuterComponent,
 	bool bInTreatExistingMaterialsAsUpToDate,
-	bool bInDestroyProxies)
+	bool bInDestroyProxies,
+	const TMap<FHoudiniOutputObjectIdentifier, TSharedPtr<FHoudiniMeshTranslator>>* InPrefetchedPartData)
 {
 	if (!InOutput || InOutput->IsPendingKill())
 		return false;
@@ -115,6 +177,16 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 		InForceRebuild = true;
 	}
 
+	// Identical instanced parts (variants copied to points, PDG outputs...) share the same meshes.
+	// This is only done for HAC outputs, as the HAC's outputs are needed to know when a shared mesh is unused.
+	const bool bDeduplicateInstancedMeshes = !InForceRebuild
+		&& InOuterComponent->IsA<UHoudiniAssetComponent>()
+		&& InOutput->GetOuter() == InOuterComponent;
+
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> DeduplicatedOutputObjects;
+	int32 NumDeduplicatedParts = 0;
+	double DeduplicatedBuildTime = 0.0;
+
 	// Iterate on all of the output's HGPO, creating meshes as we go
 	for (const FHoudiniGeoPartObject& CurHGPO : InOutput->HoudiniGeoPartObjects)
 	{
@@ -134,10 +206,79 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 				InOuterComponent, PropertyAttributes);
 		}
 
+		const bool bRebuildPart = InForceRebuild || CurHGPO.bHasGeoChanged || CurHGPO.bHasPartChanged;
+
+		FString Fingerprint;
+		if (bDeduplicateInstancedMeshes && CurHGPO.bIsInstanced)
+		{
+			// Unchanged parts keep the fingerprint of their previous cook
+			if (!bRebuildPart)
+			{
+				for (const auto& OldPair : OldOutputObjects)
+				{
+					if (!IsOutputIdentifierForPart(OldPair.Key, CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId))
+						continue;
+
+					const FString* FoundFingerprint = OldPair.Value.CachedAttributes.Find(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT);
+					if (FoundFingerprint)
+						Fingerprint = *FoundFingerprint;
+					break;
+				}
+			}
+
+			if (Fingerprint.IsEmpty())
+				Fingerprint = ComputeInstancedPartFingerprint(CurHGPO, InStaticMeshMethod);
+
+			double SavedTime = 0.0;
+			if (!Fingerprint.IsEmpty() && FindDeduplicatedMeshes(
+				CurHGPO, Fingerprint, InOutput, OldOutputObjects, NewOutputObjects, DeduplicatedOutputObjects, SavedTime))
+			{
+				NumDeduplicatedParts++;
+				DeduplicatedBuildTime += SavedTime;
+				continue;
+			}
+		}
+
+		// Meshes of instanced parts might be shared with other parts, so they must not be rebuilt in place
+		TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> FilteredOldOutputObjects;
+		bool bFilteredOldOutputObjects = false;
+		if (bRebuildPart)
+		{
+			for (const auto& OldPair : OldOutputObjects)
+			{
+				if (IsOutputIdentifierForPart(OldPair.Key, CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId)
+					&& OldPair.Value.CachedAttributes.Contains(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT))
+				{
+					bFilteredOldOutputObjects = true;
+					continue;
+				}
+
+				FilteredOldOutputObjects.Add(OldPair.Key, OldPair.Value);
+			}
+		}
+
+		// Meshes of fingerprinted parts get new packages instead of replacing the previous meshes, which
+		// may still be referenced by the parts that shared them.
+		FHoudiniPackageParams PartPackageParams = InPackageParams;
+		if (!Fingerprint.IsEmpty())
+			PartPackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+
+		// Use the part's data if it was prefetched by the output fetch stage
+		FHoudiniMeshTranslator* PrefetchedTranslator = nullptr;
+		if (InPrefetchedPartData)
+		{
+			FHoudiniOutputObjectIdentifier PartIdentifier(CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId, FString());
+			PartIdentifier.PartName = CurHGPO.PartName;
+			const TSharedPtr<FHoudiniMeshTranslator>* FoundTranslator = InPrefetchedPartData->Find(PartIdentifier);
+			if (FoundTranslator && FoundTranslator->IsValid())
+				PrefetchedTranslator = FoundTranslator->Get();
+		}
+
+		const double PartStartTime = FPlatformTime::Seconds();
 		CreateStaticMeshFromHoudiniGeoPartObject(
 			CurHGPO,
-			InPackageParams,
-			OldOutputObjects,
+			PartPackageParams,
+			bFilteredOldOutputObjects ? FilteredOldOutputObjects : OldOutputObjects,
 			NewOutputObjects,
 			AssignementMaterials,
 			ReplacementMaterials,
@@ -146,7 +287,30 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 			InStaticMeshMethod,
 			InSMGenerationProperties,
 			InMeshBuildSettings,
-			bInTreatExistingMaterialsAsUpToDate);
+			bInTreatExistingMaterialsAsUpToDate,
+			PrefetchedTranslator);
+
+		if (Fingerprint.IsEmpty())
+			continue;
+
+		// Tag the part's meshes with its fingerprint, and register them so identical parts can use them
+		for (auto& NewPair : NewOutputObjects)
+		{
+			if (IsOutputIdentifierForPart(NewPair.Key, CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId))
+				NewPair.Value.CachedAttributes.Add(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT, Fingerprint);
+		}
+
+		RegisterDeduplicatedMeshSource(
+			CurHGPO, Fingerprint, InOutput, bRebuildPart ? FPlatformTime::Seconds() - PartStartTime : -1.0);
+	}
+
+	if (NumDeduplicatedParts > 0)
+	{
+		NewOutputObjects.Append(DeduplicatedOutputObjects);
+
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Mesh deduplication: %d instanced part(s) reused existing identical meshes, saving approximately %.3f seconds of mesh translation and build."),
+			NumDeduplicatedParts, DeduplicatedBuildTime);
 	}
 
 	return FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
@@ -235,12 +399,17 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 		RemoveAndDestroyComponent(OldOutputObject.ProxyComponent);
 		OldOutputObject.ProxyComponent = nullptr;
 
-		if (OldOutputObject.OutputObject && !OldOutputObject.OutputObject->IsPendingKill())
+		// Meshes of instanced parts can be shared by other parts, only destroy them if they're not used anymore
+		const bool bMightBeShared = OldOutputObject.CachedAttributes.Contains(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT);
+
+		if (OldOutputObject.OutputObject && !OldOutputObject.OutputObject->IsPendingKill()
+			&& !(bMightBeShared && IsMeshUsedByOtherOutputObjects(OldOutputObject.OutputObject, InOutput, InOuterComponent, InNewOutputObjects)))
 		{
 			OldOutputObject.OutputObject->MarkPendingKill();
 		}
 
-		if (OldOutputObject.ProxyObject && !OldOutputObject.ProxyObject->IsPendingKill())
+		if (OldOutputObject.ProxyObject && !OldOutputObject.ProxyObject->IsPendingKill()
+			&& !(bMightBeShared && IsMeshUsedByOtherOutputObjects(OldOutputObject.ProxyObject, InOutput, InOuterComponent, InNewOutputObjects)))
 		{
 			OldOutputObject.ProxyObject->MarkPendingKill();
 		}		
@@ -562,7 +731,8 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	const EHoudiniStaticMeshMethod& InStaticMeshMethod,
 	const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 	const FMeshBuildSettings& InSMBuildSettings,
-	bool bInTreatExistingMaterialsAsUpToDate)
+	bool bInTreatExistingMaterialsAsUpToDate,
+	FHoudiniMeshTranslator* InPrefetchedTranslator)
 {
 	// If we're not forcing the rebuild
 	// No need to recreate something that hasn't changed
@@ -574,6 +744,12 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	}
 	
 	FHoudiniMeshTranslator CurrentTranslator;
+	if (InPrefetchedTranslator && InPrefetchedTranslator->bHasPrefetchedPartData)
+	{
+		// Start from the prefetched part data, it is consumed by this translator
+		CurrentTranslator = MoveTemp(*InPrefetchedTranslator);
+		InPrefetchedTranslator->bHasPrefetchedPartData = false;
+	}
 	CurrentTranslator.ForceRebuild = InForceRebuild;
 	CurrentTranslator.SetHoudiniGeoPartObject(InHGPO);
 	CurrentTranslator.SetInputObjects(InOutputObjects);
@@ -613,6 +789,337 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	return true;
 }
 
+TSharedPtr<FHoudiniMeshTranslator>
+FHoudiniMeshTranslator::PrefetchPartData(const FHoudiniGeoPartObject& InHGPO)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::PrefetchPartData"));
+
+	TSharedPtr<FHoudiniMeshTranslator> Translator = MakeShared<FHoudiniMeshTranslator>();
+	Translator->SetHoudiniGeoPartObject(InHGPO);
+
+	if (!Translator->UpdatePartVertexList())
+		return nullptr;
+
+	Translator->SortSplitGroups();
+
+	if (!Translator->UpdateSplitsFacesAndIndices())
+		return nullptr;
+
+	Translator->ResetPartCache();
+
+	// Fetch all the attributes the mesh creation functions could need,
+	// the ones that are not found will simply be looked for again on the game thread
+	Translator->UpdatePartPositionIfNeeded();
+	Translator->UpdatePartNormalsIfNeeded();
+	Translator->UpdatePartTangentsIfNeeded();
+	Translator->UpdatePartColorsIfNeeded();
+	Translator->UpdatePartAlphasIfNeeded();
+	Translator->UpdatePartFaceSmoothingIfNeeded();
+	Translator->UpdatePartUVSetsIfNeeded();
+	Translator->UpdatePartLightmapResolutionsIfNeeded();
+	Translator->UpdatePartFaceMaterialIDsIfNeeded();
+	Translator->UpdatePartFaceMaterialOverridesIfNeeded();
+	Translator->UpdatePartLODScreensizeIfNeeded();
+
+	Translator->bHasPrefetchedPartData = true;
+
+	return Translator;
+}
+
+FString
+FHoudiniMeshTranslator::ComputeInstancedPartFingerprint(
+	const FHoudiniGeoPartObject& InHGPO,
+	const EHoudiniStaticMeshMethod& InStaticMeshMethod)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::ComputeInstancedPartFingerprint"));
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	HAPI_PartInfo PartInfo = FHoudiniEngineUtils::ToHAPIPartInfo(InHGPO.PartInfo);
+	if (PartInfo.faceCount <= 0 || PartInfo.vertexCount <= 0)
+		return FString();
+
+	FSHA1 Hash;
+
+	// The mesh creation method changes the type of the created meshes
+	const uint8 StaticMeshMethod = (uint8)InStaticMeshMethod;
+	Hash.Update(&StaticMeshMethod, sizeof(StaticMeshMethod));
+
+	// Topology
+	TArray<int32> IntData;
+	IntData.SetNumUninitialized(PartInfo.faceCount);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetFaceCounts(
+		Session, InHGPO.GeoId, InHGPO.PartId, IntData.GetData(), 0, PartInfo.faceCount))
+		return FString();
+	Hash.Update((const uint8*)IntData.GetData(), IntData.Num() * sizeof(int32));
+
+	IntData.SetNumUninitialized(PartInfo.vertexCount);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVertexList(
+		Session, InHGPO.GeoId, InHGPO.PartId, IntData.GetData(), 0, PartInfo.vertexCount))
+		return FString();
+	Hash.Update((const uint8*)IntData.GetData(), IntData.Num() * sizeof(int32));
+
+	// Houdini materials
+	HAPI_Bool bSingleFaceMaterial = false;
+	IntData.SetNumUninitialized(PartInfo.faceCount);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetMaterialNodeIdsOnFaces(
+		Session, InHGPO.GeoId, InHGPO.PartId, &bSingleFaceMaterial, IntData.GetData(), 0, PartInfo.faceCount))
+		return FString();
+	Hash.Update((const uint8*)IntData.GetData(), (bSingleFaceMaterial ? 1 : IntData.Num()) * sizeof(int32));
+
+	// Split groups
+	TArray<FString> SplitGroups = InHGPO.SplitGroups;
+	SplitGroups.Sort();
+	for (const FString& SplitGroup : SplitGroups)
+	{
+		TArray<int32> GroupMembership;
+		bool bAllEquals = false;
+		if (!FHoudiniEngineUtils::HapiGetGroupMembership(
+			InHGPO.GeoId, PartInfo, HAPI_GROUPTYPE_PRIM, SplitGroup, GroupMembership, bAllEquals))
+			return FString();
+
+		Hash.UpdateWithString(*SplitGroup, SplitGroup.Len());
+		Hash.Update((const uint8*)GroupMembership.GetData(), GroupMembership.Num() * sizeof(int32));
+	}
+
+	// Attributes, for all owners
+	TArray<float> FloatData;
+	TArray<FString> StringData;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const HAPI_AttributeOwner Owner = (HAPI_AttributeOwner)OwnerIdx;
+		const int32 AttributeCount = PartInfo.attributeCounts[Owner];
+		if (AttributeCount <= 0)
+			continue;
+
+		TArray<HAPI_StringHandle> AttributeNameSHs;
+		AttributeNameSHs.SetNum(AttributeCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			Session, InHGPO.GeoId, InHGPO.PartId, Owner, AttributeNameSHs.GetData(), AttributeCount))
+			return FString();
+
+		TArray<FString> AttributeNames;
+		FHoudiniEngineString::SHArrayToFStringArray(AttributeNameSHs, AttributeNames);
+		AttributeNames.Sort();
+
+		for (const FString& AttributeName : AttributeNames)
+		{
+			HAPI_AttributeInfo AttributeInfo;
+			FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+				Session, InHGPO.GeoId, InHGPO.PartId, TCHAR_TO_UTF8(*AttributeName), Owner, &AttributeInfo))
+				return FString();
+
+			if (!AttributeInfo.exists)
+				continue;
+
+			Hash.UpdateWithString(*AttributeName, AttributeName.Len());
+			Hash.Update((const uint8*)&OwnerIdx, sizeof(int32));
+			Hash.Update((const uint8*)&AttributeInfo.storage, sizeof(AttributeInfo.storage));
+			Hash.Update((const uint8*)&AttributeInfo.tupleSize, sizeof(AttributeInfo.tupleSize));
+			Hash.Update((const uint8*)&AttributeInfo.count, sizeof(AttributeInfo.count));
+
+			if (AttributeInfo.count <= 0 || AttributeInfo.tupleSize <= 0)
+				continue;
+
+			const int32 ValueCount = AttributeInfo.count * AttributeInfo.tupleSize;
+			if (AttributeInfo.storage == HAPI_STORAGETYPE_INT)
+			{
+				IntData.SetNumUninitialized(ValueCount);
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeIntData(
+					Session, InHGPO.GeoId, InHGPO.PartId, TCHAR_TO_UTF8(*AttributeName),
+					&AttributeInfo, -1, IntData.GetData(), 0, AttributeInfo.count))
+					return FString();
+				Hash.Update((const uint8*)IntData.GetData(), ValueCount * sizeof(int32));
+			}
+			else if (AttributeInfo.storage == HAPI_STORAGETYPE_FLOAT)
+			{
+				FloatData.SetNumUninitialized(ValueCount);
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeFloatData(
+					Session, InHGPO.GeoId, InHGPO.PartId, TCHAR_TO_UTF8(*AttributeName),
+					&AttributeInfo, -1, FloatData.GetData(), 0, AttributeInfo.count))
+					return FString();
+				Hash.Update((const uint8*)FloatData.GetData(), ValueCount * sizeof(float));
+			}
+			else if (AttributeInfo.storage == HAPI_STORAGETYPE_STRING)
+			{
+				// String handles aren't stable, so hash the strings themselves
+				if (!FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(
+					InHGPO.GeoId, InHGPO.PartId, TCHAR_TO_UTF8(*AttributeName), AttributeInfo, StringData))
+					return FString();
+				for (const FString& Value : StringData)
+				{
+					Hash.UpdateWithString(*Value, Value.Len());
+					Hash.Update((const uint8*)TEXT("|"), sizeof(TCHAR));
+				}
+			}
+			else
+			{
+				// Unsupported storage, don't deduplicate this part
+				return FString();
+			}
+		}
+	}
+
+	Hash.Final();
+	uint8 Digest[FSHA1::DigestSize];
+	Hash.GetHash(Digest);
+
+	return BytesToHex(Digest, FSHA1::DigestSize);
+}
+
+void
+FHoudiniMeshTranslator::RegisterDeduplicatedMeshSource(
+	const FHoudiniGeoPartObject& InHGPO,
+	const FString& InFingerprint,
+	UHoudiniOutput* InOutput,
+	const double& InBuildTime)
+{
+	if (!InOutput || InFingerprint.IsEmpty())
+		return;
+
+	FHoudiniDeduplicatedMeshSource& Source = DeduplicatedMeshSources.FindOrAdd(GetDeduplicatedMeshSourceKey(InOutput, InFingerprint));
+	Source.Output = InOutput;
+	Source.ObjectId = InHGPO.ObjectId;
+	Source.GeoId = InHGPO.GeoId;
+	Source.PartId = InHGPO.PartId;
+	if (InBuildTime >= 0.0)
+		Source.BuildTime = InBuildTime;
+}
+
+void
+FHoudiniMeshTranslator::ClearDeduplicatedMeshSources(const UObject* InOutputOrComponent)
+{
+	if (!InOutputOrComponent)
+		return;
+
+	for (auto It = DeduplicatedMeshSources.CreateIterator(); It; ++It)
+	{
+		// Also remove the sources whose output has been destroyed
+		const UHoudiniOutput* SourceOutput = It.Value().Output.Get();
+		if (!SourceOutput || SourceOutput == InOutputOrComponent || SourceOutput->GetOuter() == InOutputOrComponent)
+			It.RemoveCurrent();
+	}
+}
+
+bool
+FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+	const FHoudiniGeoPartObject& InHGPO,
+	const FString& InFingerprint,
+	UHoudiniOutput* InOutput,
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOldOutputObjects,
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InNewOutputObjects,
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutOutputObjects,
+	double& OutSavedTime)
+{
+	OutSavedTime = 0.0;
+
+	const bool bHasPartChanged = InHGPO.bHasGeoChanged || InHGPO.bHasPartChanged;
+
+	TArray<TPair<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>> SourceObjects;
+	const FString SourceKey = GetDeduplicatedMeshSourceKey(InOutput, InFingerprint);
+	FHoudiniDeduplicatedMeshSource* FoundSource = DeduplicatedMeshSources.Find(SourceKey);
+	if (FoundSource)
+	{
+		UHoudiniOutput* SourceOutput = FoundSource->Output.Get();
+		const bool bIsSourcePart = SourceOutput == InOutput
+			&& FoundSource->ObjectId == InHGPO.ObjectId
+			&& FoundSource->GeoId == InHGPO.GeoId
+			&& FoundSource->PartId == InHGPO.PartId;
+
+		// An unchanged source part simply reuses its meshes
+		if (bIsSourcePart && !bHasPartChanged)
+			return false;
+
+		// The source output's objects are only updated after all its parts have been processed
+		bool bFound = false;
+		if (SourceOutput == InOutput && !bIsSourcePart)
+		{
+			bFound = GatherFingerprintedOutputObjects(
+				InNewOutputObjects, FoundSource->ObjectId, FoundSource->GeoId, FoundSource->PartId, InFingerprint, SourceObjects);
+		}
+		else if (IsValid(SourceOutput) && SourceOutput->GetOuter() == InOutput->GetOuter())
+		{
+			bFound = GatherFingerprintedOutputObjects(
+				SourceOutput->GetOutputObjects(), FoundSource->ObjectId, FoundSource->GeoId, FoundSource->PartId, InFingerprint, SourceObjects);
+		}
+
+		if (bFound)
+		{
+			OutSavedTime = FoundSource->BuildTime;
+		}
+		else
+		{
+			// The source doesn't hold meshes for that fingerprint anymore
+			DeduplicatedMeshSources.Remove(SourceKey);
+		}
+	}
+
+	// If the part was flagged as changed but its geometry is identical, reuse the meshes from its previous cook
+	if (SourceObjects.Num() <= 0 && bHasPartChanged)
+	{
+		GatherFingerprintedOutputObjects(
+			InOldOutputObjects, InHGPO.ObjectId, InHGPO.GeoId, InHGPO.PartId, InFingerprint, SourceObjects);
+	}
+
+	if (SourceObjects.Num() <= 0)
+		return false;
+
+	for (const auto& SourcePair : SourceObjects)
+	{
+		FHoudiniOutputObjectIdentifier Identifier(InHGPO.ObjectId, InHGPO.GeoId, InHGPO.PartId, SourcePair.Key.SplitIdentifier);
+		Identifier.PartName = InHGPO.PartName;
+		Identifier.PrimitiveIndex = SourcePair.Key.PrimitiveIndex;
+		Identifier.PointIndex = SourcePair.Key.PointIndex;
+
+		// Instanced meshes don't have components
+		FHoudiniOutputObject OutputObject = SourcePair.Value;
+		OutputObject.OutputComponent = nullptr;
+		OutputObject.ProxyComponent = nullptr;
+
+		OutOutputObjects.Add(Identifier, OutputObject);
+	}
+
+	return true;
+}
+
+bool
+FHoudiniMeshTranslator::IsMeshUsedByOtherOutputObjects(
+	const UObject* InMesh,
+	const UHoudiniOutput* InOutput,
+	const UObject* InOuterComponent,
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InNewOutputObjects)
+{
+	auto UsesMesh = [InMesh](const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOutputObjects)
+	{
+		for (const auto& Pair : InOutputObjects)
+		{
+			if (Pair.Value.OutputObject == InMesh || Pair.Value.ProxyObject == InMesh)
+				return true;
+		}
+		return false;
+	};
+
+	if (UsesMesh(InNewOutputObjects))
+		return true;
+
+	const UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(InOuterComponent);
+	if (!IsValid(HAC))
+		return false;
+
+	TArray<UHoudiniOutput*> Outputs;
+	HAC->GetOutputs(Outputs);
+	for (const UHoudiniOutput* Output : Outputs)
+	{
+		if (!IsValid(Output) || Output == InOutput || Output->GetType() != EHoudiniOutputType::Mesh)
+			continue;
+
+		if (UsesMesh(Output->GetOutputObjects()))
+			return true;
+	}
+
+	return false;
+}
+
 bool
 FHoudiniMeshTranslator::UpdatePartVertexList()
 {
@@ -706,123 +1213,75 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices"));
 
 	// Reset the splits faces/indices arrays
-	AllSplitVertexLists.Empty();
-	AllSplitVertexCounts.Empty();
-	AllSplitFaceIndices.Empty();
-	AllSplitFirstValidVertexIndex.Empty();
-	AllSplitFirstValidPrimIndex.Empty();
+	AllSplits.Empty();
 
+	const int32 FaceCount = HGPO.PartInfo.FaceCount;
 	bool bHasSplit = AllSplitGroups.Num() > 0;
 	if (bHasSplit)
 	{
 		HAPI_PartInfo PartInfo = FHoudiniEngineUtils::ToHAPIPartInfo(HGPO.PartInfo);
 
-		// Buffer for all vertex indices used for split groups.
-		// We need this to figure out all vertex indices that are not part of them. 
-		TArray<int32> AllVertexList;
-		AllVertexList.SetNumZeroed(PartVertexList.Num());
-
-		// Buffer for all face indices used for split groups.
-		// We need this to figure out all face indices that are not part of them.
-		TArray<int32> AllGroupFaceIndices;
-		AllGroupFaceIndices.SetNumZeroed(HGPO.PartInfo.FaceCount);
-
-		// Some of the groups may contain invalid geometry 
-		// Store them here so we can remove them afterwards
-		TArray<int32> InvalidGroupNameIndices;
+		// Partition the faces between the split groups.
+		// FaceInAnyGroup is needed to figure out all faces/vertices that are not part of them.
+		TArray<bool> FaceInAnyGroup;
+		PartitionFacesIntoSplits(
+			AllSplitGroups.Num(), FaceCount, PartVertexList,
+			[&](const int32& InSplitIdx, TArray<int32>& OutGroupMembership, bool& bOutAllEquals)
+			{
+				return FHoudiniEngineUtils::HapiGetGroupMembership(
+					HGPO.GeoId, PartInfo, HAPI_GROUPTYPE_PRIM, AllSplitGroups[InSplitIdx], OutGroupMembership, bOutAllEquals);
+			},
+			AllSplits, FaceInAnyGroup);
 
-		// Extract the vertices/faces for each of the split groups
-		for (int32 SplitIdx = 0; SplitIdx < AllSplitGroups.Num(); SplitIdx++)
+		// Remove the groups that don't have vertices/faces
+		for (int32 SplitIdx = AllSplitGroups.Num() - 1; SplitIdx >= 0; SplitIdx--)
 		{
-			const FString& GroupName = AllSplitGroups[SplitIdx];
-
-			// New vertex list just for this group.
-			TArray< int32 > GroupVertexList;
-			TArray< int32 > AllFaceList;
-			
-			int32 FirstValidPrimIndex = 0;
-			int32 FirstValidVertexIndex = 0;
-			// Extract vertex indices for this split.
-			int32 GroupVertexListCount = FHoudiniEngineUtils::HapiGetVertexListForGroup(
-				HGPO.GeoId, PartInfo, GroupName,
-				PartVertexList, GroupVertexList,
-				AllVertexList, AllFaceList, AllGroupFaceIndices,
-				FirstValidVertexIndex, FirstValidPrimIndex,
-				HGPO.PartInfo.bIsInstanced);
-
-			if (GroupVertexListCount <= 0)
-			{
-				// This group doesn't have vertices/faces, mark it as invalid
-				InvalidGroupNameIndices.Add(SplitIdx);
-
-				// Error getting the vertex list.
-				HOUDINI_LOG_MESSAGE(
-					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve vertex list for group %s - skipping."),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, *GroupName);
-
+			if (AllSplits[SplitIdx].VertexCount > 0)
 				continue;
-			}
 
-			// If list is not empty, we store it for this group - this will define new mesh.
-			AllSplitVertexLists.Add(GroupName, GroupVertexList);
-			AllSplitVertexCounts.Add(GroupName, GroupVertexListCount);
-			AllSplitFaceIndices.Add(GroupName, AllFaceList);
-			AllSplitFirstValidVertexIndex.Add(GroupName, FirstValidVertexIndex);
-			AllSplitFirstValidPrimIndex.Add(GroupName, FirstValidPrimIndex);
-		}
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve vertex list for group %s - skipping."),
+				HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, *AllSplitGroups[SplitIdx]);
 
-		if (InvalidGroupNameIndices.Num() > 0)
-		{
-			// Remove all invalid split groups
-			for (int32 InvalIdx = InvalidGroupNameIndices.Num() - 1; InvalIdx >= 0; InvalIdx--)
-			{
-				int32 Index = InvalidGroupNameIndices[InvalIdx];
-				AllSplitGroups.RemoveAt(Index);
-			}
+			AllSplitGroups.RemoveAt(SplitIdx);
+			AllSplits.RemoveAt(SplitIdx);
 		}
 
 		// We also need to figure out / construct the vertex list for everything that's not in a split group
-		TArray<int32> GroupSplitFacesRemaining;
-		GroupSplitFacesRemaining.Init(-1, PartVertexList.Num());
-
-		int32 GroupVertexListCount = 0;
-		bool bHasMainSplitGroup = false;
-		TArray< int32 > GroupSplitFaceIndicesRemaining;
-		int32 FistUnusedVertexIndex = -1;		
-		for (int32 SplitVertexIdx = 0; SplitVertexIdx < AllVertexList.Num(); SplitVertexIdx++)
+		FHoudiniMeshSplit RemainingSplit;
+		RemainingSplit.VertexList.Init(-1, PartVertexList.Num());
+		RemainingSplit.FirstValidVertexIndex = -1;
+		RemainingSplit.FirstValidPrimIndex = -1;
+		for (int32 FaceIdx = 0; FaceIdx < FaceCount; FaceIdx++)
 		{
-			if (AllVertexList[SplitVertexIdx] == 0)
-			{
-				// This is an unused index, we need to add it to unused vertex list.
-				FistUnusedVertexIndex = SplitVertexIdx;
-				GroupSplitFacesRemaining[SplitVertexIdx] = PartVertexList[SplitVertexIdx];
-				bHasMainSplitGroup = true;
-				GroupVertexListCount++;
-			}
+			if (FaceInAnyGroup[FaceIdx])
+				continue;
+
+			// This is unused face, we need to add it to unused faces list.
+			RemainingSplit.FaceIndices.Add(FaceIdx);
+			RemainingSplit.FirstValidPrimIndex = FaceIdx;
 		}
 
-		int32 FistUnusedPrimIndex = -1;
-		for (int32 SplitFaceIdx = 0; SplitFaceIdx < AllGroupFaceIndices.Num(); SplitFaceIdx++)
+		for (int32 VertexIdx = 0; VertexIdx < PartVertexList.Num(); VertexIdx++)
 		{
-			if (AllGroupFaceIndices[SplitFaceIdx] == 0)
-			{
-				// This is unused face, we need to add it to unused faces list.
-				GroupSplitFaceIndicesRemaining.Add(SplitFaceIdx);
-				FistUnusedPrimIndex = SplitFaceIdx;
-			}
+			// Faces past the vertex list's end were never marked as used
+			const int32 FaceIdx = VertexIdx / 3;
+			if (FaceInAnyGroup.IsValidIndex(FaceIdx) && FaceInAnyGroup[FaceIdx])
+				continue;
+
+			// This is an unused index, we need to add it to unused vertex list.
+			RemainingSplit.FirstValidVertexIndex = VertexIdx;
+			RemainingSplit.VertexList[VertexIdx] = PartVertexList[VertexIdx];
+			RemainingSplit.VertexCount++;
 		}
 
 		// We store the remaining geo vertex list as a special split named "main geo"
 		// and make sure its treated before the collider meshes
-		if (bHasMainSplitGroup)
+		if (RemainingSplit.VertexCount > 0)
 		{
 			static const FString RemainingGroupName = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
 			AllSplitGroups.Add(RemainingGroupName);
-			AllSplitVertexLists.Add(RemainingGroupName, GroupSplitFacesRemaining);
-			AllSplitVertexCounts.Add(RemainingGroupName, GroupVertexListCount);
-			AllSplitFaceIndices.Add(RemainingGroupName, GroupSplitFaceIndicesRemaining);
-			AllSplitFirstValidPrimIndex.Add(RemainingGroupName, FistUnusedPrimIndex);
-			AllSplitFirstValidVertexIndex.Add(RemainingGroupName, FistUnusedVertexIndex);
+			AllSplits.Add(MoveTemp(RemainingSplit));
 		}
 	}
 	else
@@ -831,21 +1290,133 @@ FHoudiniMeshTranslator::UpdateSplitsFacesAndIndices()
 		// Mark everything as the main geo group
 		static const FString RemainingGroupName = HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION;
 		AllSplitGroups.Add(RemainingGroupName);
-		AllSplitVertexLists.Add(RemainingGroupName, PartVertexList);
-		AllSplitVertexCounts.Add(RemainingGroupName, PartVertexList.Num());
-		AllSplitFirstValidPrimIndex.Add(RemainingGroupName, 0);
-		AllSplitFirstValidVertexIndex.Add(RemainingGroupName, 0);
 
-		TArray<int32> AllFaces;
-		for (int32 FaceIdx = 0; FaceIdx < HGPO.PartInfo.FaceCount; ++FaceIdx)
-			AllFaces.Add(FaceIdx);
+		FHoudiniMeshSplit& MainSplit = AllSplits.AddDefaulted_GetRef();
+		MainSplit.VertexList = PartVertexList;
+		MainSplit.VertexCount = PartVertexList.Num();
+		MainSplit.FirstValidPrimIndex = 0;
+		MainSplit.FirstValidVertexIndex = 0;
 
-		AllSplitFaceIndices.Add(RemainingGroupName, AllFaces);
+		MainSplit.FaceIndices.SetNumUninitialized(FaceCount);
+		for (int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx)
+			MainSplit.FaceIndices[FaceIdx] = FaceIdx;
 	}
 
 	return true;
 }
 
+void
+FHoudiniMeshTranslator::PartitionFacesIntoSplits(
+	const int32& InNumSplits,
+	const int32& InFaceCount,
+	const TArray<int32>& InPartVertexList,
+	TFunctionRef<bool(const int32&, TArray<int32>&, bool&)> InGetGroupMembership,
+	TArray<FHoudiniMeshSplit>& OutSplits,
+	TArray<bool>& OutFaceInAnyGroup)
+{
+	OutSplits.Empty();
+	OutSplits.SetNum(InNumSplits);
+
+	// Faces used by any of the split groups
+	OutFaceInAnyGroup.Init(false, InFaceCount);
+
+	// Split membership of each face, one bit per split group.
+	// Groups are processed in batches of 64 (a face's mask), so that the faces are partitioned between
+	// all the groups of a batch in a single pass instead of scanning all faces once per group.
+	static const int32 MaxGroupsPerPass = 64;
+	TArray<uint64> FaceSplitMasks;
+	TArray<int32> GroupMembership;
+	for (int32 FirstSplitIdx = 0; FirstSplitIdx < InNumSplits; FirstSplitIdx += MaxGroupsPerPass)
+	{
+		const int32 LastSplitIdx = FMath::Min(FirstSplitIdx + MaxGroupsPerPass, InNumSplits);
+		FaceSplitMasks.Init(0, InFaceCount);
+
+		// Fetch the membership of each group of this batch
+		uint64 NonEmptySplitsMask = 0;
+		for (int32 SplitIdx = FirstSplitIdx; SplitIdx < LastSplitIdx; SplitIdx++)
+		{
+			const uint64 SplitBit = 1ull << (SplitIdx - FirstSplitIdx);
+			bool bAllEquals = false;
+			if (!InGetGroupMembership(SplitIdx, GroupMembership, bAllEquals))
+				continue;
+
+			int32 NumMembers = 0;
+			if (bAllEquals)
+			{
+				// All faces are either in or out of the group: no need to look at them individually
+				if (GroupMembership.Num() > 0 && GroupMembership[0] > 0)
+				{
+					for (uint64& FaceMask : FaceSplitMasks)
+						FaceMask |= SplitBit;
+					NumMembers = InFaceCount;
+				}
+			}
+			else
+			{
+				const int32 NumFaces = FMath::Min(InFaceCount, GroupMembership.Num());
+				for (int32 FaceIdx = 0; FaceIdx < NumFaces; FaceIdx++)
+				{
+					if (GroupMembership[FaceIdx] > 0)
+					{
+						FaceSplitMasks[FaceIdx] |= SplitBit;
+						NumMembers++;
+					}
+				}
+			}
+
+			if (NumMembers > 0)
+			{
+				NonEmptySplitsMask |= SplitBit;
+				FHoudiniMeshSplit& Split = OutSplits[SplitIdx];
+				Split.VertexList.Init(-1, InPartVertexList.Num());
+				Split.FaceIndices.Reserve(NumMembers);
+			}
+		}
+
+		if (NonEmptySplitsMask == 0)
+			continue;
+
+		// Partition the faces between the splits of this batch in a single pass
+		for (int32 FaceIdx = 0; FaceIdx < InFaceCount; FaceIdx++)
+		{
+			uint64 FaceMask = FaceSplitMasks[FaceIdx];
+			if (FaceMask == 0)
+				continue;
+
+			OutFaceInAnyGroup[FaceIdx] = true;
+
+			// Get the index of this face's vertices
+			const int32 FirstVertexIdx = FaceIdx * 3;
+			const int32 LastVertexIdx = FirstVertexIdx + 2;
+			const bool bValidVertices = InPartVertexList.IsValidIndex(LastVertexIdx);
+
+			while (FaceMask != 0)
+			{
+				const int32 SplitIdx = FirstSplitIdx + (int32)FMath::CountTrailingZeros64(FaceMask);
+				FaceMask &= FaceMask - 1;
+
+				FHoudiniMeshSplit& Split = OutSplits[SplitIdx];
+				if (Split.VertexCount == 0)
+				{
+					// Keep track of the first valid vertex/face indices for this group
+					// This will be useful later on when extracting attributes
+					Split.FirstValidVertexIndex = FirstVertexIdx;
+					Split.FirstValidPrimIndex = FaceIdx;
+				}
+
+				Split.FaceIndices.Add(FaceIdx);
+				if (bValidVertices)
+				{
+					Split.VertexList[FirstVertexIdx] = InPartVertexList[FirstVertexIdx];
+					Split.VertexList[FirstVertexIdx + 1] = InPartVertexList[FirstVertexIdx + 1];
+					Split.VertexList[LastVertexIdx] = InPartVertexList[LastVertexIdx];
+				}
+				Split.VertexCount += 3;
+			}
+		}
+	}
+}
+
 void
 FHoudiniMeshTranslator::ResetPartCache()
 {
@@ -1090,7 +1661,18 @@ FHoudiniMeshTranslator::UpdatePartUVSetsIfNeeded(const bool& bRemoveUnused)
 
 	// Only Retrieve uvs if necessary
 	if (PartUVSets.Num() > 0)
+	{
+		// Prefetched uvs still contain the unused sets
+		if (bRemoveUnused)
+		{
+			for (int32 Idx = PartUVSets.Num() - 1; Idx >= 0; Idx--)
+			{
+				if (PartUVSets[Idx].Num() <= 0)
+					PartUVSets.RemoveAt(Idx);
+			}
+		}
 		return true;
+	}
 
 	PartUVSets.SetNum(MAX_STATIC_TEXCOORDS);
 	AttribInfoUVSets.SetNum(MAX_STATIC_TEXCOORDS);
@@ -1440,20 +2022,24 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 
 	double time_start = FPlatformTime::Seconds();
 
-	// Start by updating the vertex list
-	if (!UpdatePartVertexList())
-		return false;
+	// The vertex list, splits and part attributes might have been prefetched on a worker thread
+	if (!bHasPrefetchedPartData)
+	{
+		// Start by updating the vertex list
+		if (!UpdatePartVertexList())
+			return false;
 
-	// Sort the split groups
-	SortSplitGroups();
+		// Sort the split groups
+		SortSplitGroups();
 
-	// Handles the split groups found in the part
-	// and builds the corresponding faces and indices arrays
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+		// Handles the split groups found in the part
+		// and builds the corresponding faces and indices arrays
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
 
-	// Resets the containers used for the raw data extraction.
-	ResetPartCache();
+		// Resets the containers used for the raw data extraction.
+		ResetPartCache();
+	}
 
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
@@ -1520,10 +2106,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		const FString& SplitGroupName = AllSplitGroups[SplitId];
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		TArray<int32>& SplitVertexList = AllSplits[SplitId].VertexList;
 
 		// Get valid count of vertex indices for this split.
-		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
+		const int32& SplitVertexCount = AllSplits[SplitId].VertexCount;
 
 		// Make sure we have a  valid vertex count for this split
 		if (SplitVertexCount % 3 != 0 || SplitVertexList.Num() % 3 != 0)
@@ -1553,8 +2139,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		FHoudiniOutputObjectIdentifier OutputObjectIdentifier(
 			HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, GetMeshIdentifierFromSplit(SplitGroupName, SplitType));
 		OutputObjectIdentifier.PartName = HGPO.PartName;
-		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitGroupName],
-		OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitGroupName];
+		OutputObjectIdentifier.PrimitiveIndex = AllSplits[SplitId].FirstValidVertexIndex,
+		OutputObjectIdentifier.PointIndex = AllSplits[SplitId].FirstValidPrimIndex;
 
 		// Get/Create the Aggregate Collisions for this mesh identifier
 		FKAggregateGeom& AggregateCollisions = AllAggregateCollisions.FindOrAdd(OutputObjectIdentifier);
@@ -1567,7 +2153,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			UpdatePartPositionIfNeeded();
 
 			// Create the convex hull colliders and add them to the Aggregate
-			if (!AddConvexCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!AddConvexCollisionToAggregate(SplitId, AggregateCollisions))
 			{
 				// Failed to generate a convex collider
 				HOUDINI_LOG_WARNING(
@@ -1586,7 +2172,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			UpdatePartPositionIfNeeded();
 
 			// Create the simple colliders and add them to the aggregate
-			if (!AddSimpleCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!AddSimpleCollisionToAggregate(SplitId, AggregateCollisions))
 			{
 				// Failed to generate a convex collider
 				HOUDINI_LOG_WARNING(
@@ -2235,7 +2821,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		// Handle Materials!!!!
 
 		// Get face indices for this split.
-		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		TArray<int32>& SplitFaceIndices = AllSplits[SplitId].FaceIndices;
 
 		// // We need to reset the Static Mesh's materials once per SM:
 		// // so, for the first lod, or the main geo...
@@ -2574,7 +3160,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 
 		// LOD Screensize
 		// default values has already been set, see if we have any attribute override for this
-		float screensize = GetLODSCreensizeForSplit(SplitGroupName);
+		float screensize = GetLODSCreensizeForSplit(SplitId);
 		if (screensize >= 0.0f)
 		{
 			// Only apply the LOD screensize if it's valid
@@ -2594,9 +3180,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		if (FHoudiniEngineUtils::GetGenericPropertiesAttributes(
 			HGPO.GeoId, HGPO.PartId,
 			true,
-			AllSplitFirstValidPrimIndex[SplitGroupName],
+			AllSplits[SplitId].FirstValidPrimIndex,
 			INDEX_NONE,
-			AllSplitFirstValidVertexIndex[SplitGroupName],
+			AllSplits[SplitId].FirstValidVertexIndex,
 			PropertyAttributes))
 		{
 			FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(
@@ -2861,21 +3447,25 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 
 	double time_start = FPlatformTime::Seconds();
 
-	// Start by updating the vertex list
-	if (!UpdatePartVertexList())
-		return false;
+	// The vertex list, splits and part attributes might have been prefetched on a worker thread
+	if (!bHasPrefetchedPartData)
+	{
+		// Start by updating the vertex list
+		if (!UpdatePartVertexList())
+			return false;
 
-	// Sort the split groups
-	// Simple colliders first, lods and finally, invisible colliders (that are separate Static Mesh)
-	SortSplitGroups();
+		// Sort the split groups
+		// Simple colliders first, lods and finally, invisible colliders (that are separate Static Mesh)
+		SortSplitGroups();
 
-	// Handles the split groups found in the part
-	// and builds the corresponding faces and indices arrays
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+		// Handles the split groups found in the part
+		// and builds the corresponding faces and indices arrays
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
 
-	// Resets the containers used for the raw data extraction.
-	ResetPartCache();
+		// Resets the containers used for the raw data extraction.
+		ResetPartCache();
+	}
 
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
@@ -2940,10 +3530,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		const FString& SplitGroupName = AllSplitGroups[SplitId];
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		TArray<int32>& SplitVertexList = AllSplits[SplitId].VertexList;
 
 		// Get valid count of vertex indices for this split.
-		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
+		const int32& SplitVertexCount = AllSplits[SplitId].VertexCount;
 
 		// Make sure we have a  valid vertex count for this split
 		if (SplitVertexCount % 3 != 0 || SplitVertexList.Num() % 3 != 0)
@@ -2973,8 +3563,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		FHoudiniOutputObjectIdentifier OutputObjectIdentifier(
 			HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, GetMeshIdentifierFromSplit(SplitGroupName, SplitType));
 		OutputObjectIdentifier.PartName = HGPO.PartName;
-		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitGroupName],
-		OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitGroupName];		
+		OutputObjectIdentifier.PrimitiveIndex = AllSplits[SplitId].FirstValidVertexIndex,
+		OutputObjectIdentifier.PointIndex = AllSplits[SplitId].FirstValidPrimIndex;		
 
 		// Get/Create the Aggregate Collisions for this mesh identifier
 		FKAggregateGeom& AggregateCollisions = AllAggregateCollisions.FindOrAdd(OutputObjectIdentifier);
@@ -2986,7 +3576,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			UpdatePartPositionIfNeeded();
 
 			// Create the convex hull colliders and add them to the Aggregate
-			if (!AddConvexCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!AddConvexCollisionToAggregate(SplitId, AggregateCollisions))
 			{
 				MainStaticMeshCTF = ECollisionTraceFlag::CTF_UseDefault;
 				// Failed to generate a convex collider
@@ -3006,7 +3596,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			UpdatePartPositionIfNeeded();
 
 			// Create the simple colliders and add them to the aggregate
-			if (!AddSimpleCollisionToAggregate(SplitGroupName, AggregateCollisions))
+			if (!AddSimpleCollisionToAggregate(SplitId, AggregateCollisions))
 			{
 				// Failed to generate a convex collider
 				HOUDINI_LOG_WARNING(
@@ -3332,7 +3922,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			TMap<UMaterialInterface*, int32>& MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh = MapUnrealMaterialInterfaceToUnrealIndexPerMesh.FindOrAdd(FoundStaticMesh);
 
 			// Get this split's faces
-			TArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitGroupName];
+			TArray<int32>& SplitGroupFaceIndices = AllSplits[SplitId].FaceIndices;
 			// Array holding the materials needed for this split
 			//TArray<UMaterialInterface*> SplitMaterials;
 			// Split Material indices per face, by default all faces are set to use the first Material
@@ -3925,7 +4515,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		
 		// LOD Screensize
 		// default values has already been set, see if we have any attribute override for this
-		float screensize = GetLODSCreensizeForSplit(SplitGroupName);
+		float screensize = GetLODSCreensizeForSplit(SplitId);
 		if (screensize >= 0.0f)
 		{
 			// Only apply the LOD screensize if it's valid
@@ -3945,9 +4535,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		if (FHoudiniEngineUtils::GetGenericPropertiesAttributes(
 			HGPO.GeoId, HGPO.PartId,
 			true,
-			AllSplitFirstValidPrimIndex[SplitGroupName],
+			AllSplits[SplitId].FirstValidPrimIndex,
 			INDEX_NONE,
-			AllSplitFirstValidVertexIndex[SplitGroupName],
+			AllSplits[SplitId].FirstValidVertexIndex,
 			PropertyAttributes))
 		{
 			FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(
@@ -4215,20 +4805,24 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 
 	const double time_start = FPlatformTime::Seconds();
 
-	// Start by updating the vertex list
-	if (!UpdatePartVertexList())
-		return false;
+	// The vertex list, splits and part attributes might have been prefetched on a worker thread
+	if (!bHasPrefetchedPartData)
+	{
+		// Start by updating the vertex list
+		if (!UpdatePartVertexList())
+			return false;
 
-	// Sort the split groups
-	SortSplitGroups();
+		// Sort the split groups
+		SortSplitGroups();
 
-	// Handles the split groups found in the part
-	// and builds the corresponding faces and indices arrays
-	if (!UpdateSplitsFacesAndIndices())
-		return true;
+		// Handles the split groups found in the part
+		// and builds the corresponding faces and indices arrays
+		if (!UpdateSplitsFacesAndIndices())
+			return true;
 
-	// Resets the containers used for the raw data extraction.
-	ResetPartCache();
+		// Resets the containers used for the raw data extraction.
+		ResetPartCache();
+	}
 
 	// Determine if there is "main" geo, if not we'll use the first LOD
 	// as main geo
@@ -4327,10 +4921,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		}
 
 		// Get the vertex indices for this group
-		TArray<int32>& SplitVertexList = AllSplitVertexLists[SplitGroupName];
+		TArray<int32>& SplitVertexList = AllSplits[SplitId].VertexList;
 
 		// Get valid count of vertex indices for this split.
-		const int32& SplitVertexCount = AllSplitVertexCounts[SplitGroupName];
+		const int32& SplitVertexCount = AllSplits[SplitId].VertexCount;
 
 		// Make sure we have a  valid vertex count for this split
 		if (SplitVertexCount % 3 != 0 || SplitVertexList.Num() % 3 != 0)
@@ -4348,8 +4942,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		FHoudiniOutputObjectIdentifier OutputObjectIdentifier(
 			HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, GetMeshIdentifierFromSplit(SplitGroupName, SplitType));
 		OutputObjectIdentifier.PartName = HGPO.PartName;
-		OutputObjectIdentifier.PrimitiveIndex = AllSplitFirstValidVertexIndex[SplitGroupName];
-			OutputObjectIdentifier.PointIndex = AllSplitFirstValidPrimIndex[SplitGroupName];
+		OutputObjectIdentifier.PrimitiveIndex = AllSplits[SplitId].FirstValidVertexIndex;
+			OutputObjectIdentifier.PointIndex = AllSplits[SplitId].FirstValidPrimIndex;
 
 		// Try to find existing properties for this identifier
 		FHoudiniOutputObject* FoundOutputObject = InputObjects.Find(OutputObjectIdentifier);
@@ -4817,7 +5411,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		//---------------------------------------------------------------------------------------------------------------------
 
 		// Get face indices for this split.
-		TArray<int32>& SplitFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		TArray<int32>& SplitFaceIndices = AllSplits[SplitId].FaceIndices;
 
 		// Fetch the FoundMesh's Static Materials array
 		TArray<FStaticMaterial>& FoundStaticMaterials = FoundStaticMesh->GetStaticMaterials();
@@ -5049,8 +5643,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 		//TArray<FHoudiniGenericAttribute> PropertyAttributes;
 		//if (GetGenericPropertiesAttributes(
 		//	HGPO.GeoId, HGPO.PartId,
-		//	AllSplitFirstValidVertexIndex[SplitGroupName],
-		//	AllSplitFirstValidPrimIndex[SplitGroupName],
+		//	AllSplits[SplitId].FirstValidVertexIndex,
+		//	AllSplits[SplitId].FirstValidPrimIndex,
 		//	PropertyAttributes))
 		//{
 		//	UpdateGenericPropertiesAttributes(
@@ -5340,10 +5934,12 @@ FHoudiniMeshTranslator::GetSplitTypeFromSplitName(const FString& InSplitName)
 }
 
 bool
-FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const int32& SplitId, FKAggregateGeom& AggCollisions)
 {
+	const FString& SplitGroupName = AllSplitGroups[SplitId];
+
 	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
+	TArray<int32>& SplitGroupVertexList = AllSplits[SplitId].VertexList;
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
@@ -5442,10 +6038,12 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 }
 
 bool
-FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
+FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const int32& SplitId, FKAggregateGeom& AggCollisions)
 {
+	const FString& SplitGroupName = AllSplitGroups[SplitId];
+
 	// Get the vertex indices for the split group
-	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
+	TArray<int32>& SplitGroupVertexList = AllSplits[SplitId].VertexList;
 
 	// We're only interested in unique vertices
 	TArray<int32> UniqueVertexIndexes;
@@ -5803,8 +6401,10 @@ int32 FHoudiniMeshTranslator::TransferPartAttributesToSplit(
 }
 
 float
-FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const FString& SplitGroupName)
+FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const int32& SplitId)
 {
+	const FString& SplitGroupName = AllSplitGroups[SplitId];
+
 	// LOD Screensize
 	// default values has already been set, see if we have any attribute override for this
 	float screensize = -1.0f;
@@ -5816,7 +6416,7 @@ FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const FString& SplitGroupName)
 	if (PartLODScreensize.Num() > 0)
 	{
 		// use the "lod_screensize" primitive attribute
-		int32 FirstValidPrimIndex = AllSplitFirstValidPrimIndex[SplitGroupName];
+		int32 FirstValidPrimIndex = AllSplits[SplitId].FirstValidPrimIndex;
 		if (PartLODScreensize.IsValidIndex(FirstValidPrimIndex))
 			screensize = PartLODScreensize[FirstValidPrimIndex];
 	}
@@ -5860,7 +6460,7 @@ FHoudiniMeshTranslator::GetLODSCreensizeForSplit(const FString& SplitGroupName)
 			}
 			else if (AttribInfoScreenSize.owner == HAPI_ATTROWNER_PRIM)
 			{
-				int32 FirstValidPrimIndex = AllSplitFirstValidPrimIndex[SplitGroupName];
+				int32 FirstValidPrimIndex = AllSplits[SplitId].FirstValidPrimIndex;
 				if (LODScreenSizes.IsValidIndex(FirstValidPrimIndex))
 					screensize = LODScreenSizes[FirstValidPrimIndex];
 			}
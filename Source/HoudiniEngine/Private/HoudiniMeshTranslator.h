@@ -69,6 +69,25 @@ enum class EHoudiniSplitType : uint8
 	InvisibleSimpleCollider
 };
 
+// Vertices and faces of one split group of a part
+struct HOUDINIENGINE_API FHoudiniMeshSplit
+{
+	// Part vertex list, with -1 for the vertices that are not in this split
+	TArray<int32> VertexList;
+
+	// Number of valid vertex indices in VertexList
+	int32 VertexCount = 0;
+
+	// Indices of the part's faces in this split
+	TArray<int32> FaceIndices;
+
+	// First valid vertex index
+	int32 FirstValidVertexIndex = 0;
+
+	// First valid prim index
+	int32 FirstValidPrimIndex = 0;
+};
+
 struct HOUDINIENGINE_API FHoudiniMeshTranslator
 {
 	public:
@@ -87,7 +106,8 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const TMap<FString, UMaterialInterface*>& InAllOutputMaterials,
 			UObject* InOuterComponent,
 			bool bInTreatExistingMaterialsAsUpToDate=false,
-			bool bInDestroyProxies=false);
+			bool bInDestroyProxies=false,
+			const TMap<FHoudiniOutputObjectIdentifier, TSharedPtr<FHoudiniMeshTranslator>>* InPrefetchedPartData=nullptr);
 	
 		static bool CreateStaticMeshFromHoudiniGeoPartObject(
 			const FHoudiniGeoPartObject& InHGPO,
@@ -101,7 +121,36 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const EHoudiniStaticMeshMethod& InStaticMeshMethod,
 			const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 			const FMeshBuildSettings& InMeshBuildSettings,
-			bool bInTreatExistingMaterialsAsUpToDate = false);
+			bool bInTreatExistingMaterialsAsUpToDate = false,
+			FHoudiniMeshTranslator* InPrefetchedTranslator = nullptr);
+
+		// Forgets the deduplicated mesh sources registered for an output or for all the outputs of a HAC.
+		// The sources whose output has been destroyed are removed as well.
+		static void ClearDeduplicatedMeshSources(const UObject* InOutputOrComponent);
+
+		// Registers the meshes built for InHGPO in InOutput as the source of the meshes of the parts matching InFingerprint.
+		// InBuildTime is the time spent building the meshes, a negative value keeps the previously registered time.
+		static void RegisterDeduplicatedMeshSource(
+			const FHoudiniGeoPartObject& InHGPO,
+			const FString& InFingerprint,
+			UHoudiniOutput* InOutput,
+			const double& InBuildTime);
+
+		// Looks for already built meshes matching the given fingerprint (in the outputs of the same HAC,
+		// or in the previous cook of InHGPO), and adds them to OutOutputObjects for InHGPO.
+		static bool FindDeduplicatedMeshes(
+			const FHoudiniGeoPartObject& InHGPO,
+			const FString& InFingerprint,
+			UHoudiniOutput* InOutput,
+			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOldOutputObjects,
+			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InNewOutputObjects,
+			TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutOutputObjects,
+			double& OutSavedTime);
+
+		// Fetches the HAPI data needed to build the part's meshes without touching any UObject,
+		// so it can be called from a worker thread. The returned translator can then be passed to
+		// CreateStaticMeshFromHoudiniGeoPartObject on the game thread. Returns null on failure.
+		static TSharedPtr<FHoudiniMeshTranslator> PrefetchPartData(const FHoudiniGeoPartObject& InHGPO);
 
 		static bool CreateOrUpdateAllComponents(
 			UHoudiniOutput* InOutput,
@@ -133,6 +182,17 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const TArray<TYPE>& InData,
 			TArray<TYPE>& OutSplitData);
 
+		// Partitions the faces of a part between InNumSplits split groups, in a single pass over the faces per 64 groups.
+		// InGetGroupMembership fetches the prim membership of a split group. Splits without faces are left empty,
+		// and OutFaceInAnyGroup flags the faces that are in at least one split group.
+		static void PartitionFacesIntoSplits(
+			const int32& InNumSplits,
+			const int32& InFaceCount,
+			const TArray<int32>& InPartVertexList,
+			TFunctionRef<bool(const int32&, TArray<int32>&, bool&)> InGetGroupMembership,
+			TArray<FHoudiniMeshSplit>& OutSplits,
+			TArray<bool>& OutFaceInAnyGroup);
+
 		// Update the MeshBuild Settings using the values from the runtime settings/overrides on the HAC
 		void UpdateMeshBuildSettings(
 			FMeshBuildSettings& OutMeshBuildSettings,
@@ -241,12 +301,12 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		UHoudiniStaticMesh* FindExistingHoudiniStaticMesh(const FHoudiniOutputObjectIdentifier& InIdentifier);
 
-		float GetLODSCreensizeForSplit(const FString& SplitGroupName);
+		float GetLODSCreensizeForSplit(const int32& SplitId);
 
 		// Create convex/UCX collider for a split and add to the aggregate
-		bool AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
+		bool AddConvexCollisionToAggregate(const int32& SplitId, FKAggregateGeom& AggCollisions);
 		// Create simple colliders for a split and add to the aggregate
-		bool AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions);
+		bool AddSimpleCollisionToAggregate(const int32& SplitId, FKAggregateGeom& AggCollisions);
 		
 		// Helper functions to generate the simple colliders and add them to the aggregate
 		static int32 GenerateBoxAsSimpleCollision(const TArray<FVector>& InPositionArray, FKAggregateGeom& OutAggregateCollisions);
@@ -263,6 +323,19 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Helper functions to remove unused/stale components
 		static bool RemoveAndDestroyComponent(UObject* InComponent);
 
+		// Computes a fingerprint of an instanced part's topology, attributes, split groups and materials.
+		// Returns an empty string if the part can't be fingerprinted.
+		static FString ComputeInstancedPartFingerprint(
+			const FHoudiniGeoPartObject& InHGPO,
+			const EHoudiniStaticMeshMethod& InStaticMeshMethod);
+
+		// Returns true if InMesh is used by InNewOutputObjects or by the other outputs of InOuterComponent
+		static bool IsMeshUsedByOtherOutputObjects(
+			const UObject* InMesh,
+			const UHoudiniOutput* InOutput,
+			const UObject* InOuterComponent,
+			const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InNewOutputObjects);
+
 		// Helper to create a new mesh component
 		static UMeshComponent* CreateMeshComponent(UObject *InOuterComponent, const TSubclassOf<UMeshComponent>& InComponentType);
 
@@ -335,20 +408,8 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Names of the groups used for splitting the geometry
 		TArray<FString> AllSplitGroups;
 
-		// Per-split lists of faces
-		TMap<FString, TArray<int32>> AllSplitVertexLists;
-
-		// Per-split number of faces
-		TMap<FString, int32> AllSplitVertexCounts;
-
-		// Per-split indices arrays
-		TMap<FString, TArray<int32>> AllSplitFaceIndices;
-
-		// Per-split first valid vertex index
-		TMap<FString, int32> AllSplitFirstValidVertexIndex;
-
-		// Per-split first valid prim index
-		TMap<FString, int32> AllSplitFirstValidPrimIndex;
+		// Per-split vertices and faces, indexed by split id (the split's index in AllSplitGroups)
+		TArray<FHoudiniMeshSplit> AllSplits;
 
 		// Vertex Indices for the part
 		TArray<int32> PartVertexList;
@@ -422,4 +483,7 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		// Default Mesh Build settings to be used when generating Static Meshes
 		FMeshBuildSettings StaticMeshBuildSettings;
+
+		// Indicates that the vertex list, splits and part attributes have been fetched by PrefetchPartData
+		bool bHasPrefetchedPartData = false;
 };
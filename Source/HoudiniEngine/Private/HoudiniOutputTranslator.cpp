@@ -41,6 +41,7 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniInput.h"
 #include "HoudiniStaticMesh.h"
+#include "HoudiniWorldInputChangeTracker.h"
 
 #include "HoudiniMeshTranslator.h"
 #include "HoudiniSplineTranslator.h"
@@ -58,6 +59,8 @@
 #include "WorldBrowserModule.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
@@ -67,10 +70,49 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	UHoudiniAssetComponent* HAC,
 	const bool& bInForceUpdate,
 	bool& bOutHasHoudiniStaticMeshOutput)
+{
+	bOutHasHoudiniStaticMeshOutput = false;
+
+	FHoudiniOutputProcessingState ProcessingState;
+	if (!BeginUpdateOutputs(HAC, bInForceUpdate, ProcessingState))
+		return false;
+
+	// Process all the work units at once
+	while (!ProcessNextOutput(HAC, ProcessingState));
+
+	return EndUpdateOutputs(HAC, ProcessingState, bOutHasHoudiniStaticMeshOutput);
+}
+
+bool
+FHoudiniOutputTranslator::BeginUpdateOutputs(
+	UHoudiniAssetComponent* HAC,
+	const bool& bInForceUpdate,
+	FHoudiniOutputProcessingState& OutState,
+	const bool bInKeepOldOutputsUntilEnd)
 {
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	OutState = FHoudiniOutputProcessingState();
+	OutState.bKeepOldOutputsUntilEnd = bInKeepOldOutputsUntilEnd;
+
+	if (bInKeepOldOutputsUntilEnd)
+	{
+		// Reused outputs update their existing components in place, these must not be hidden while the update is in progress
+		for (UHoudiniOutput* OldOutput : HAC->Outputs)
+		{
+			if (!IsValid(OldOutput))
+				continue;
+
+			for (auto& Pair : OldOutput->GetOutputObjects())
+			{
+				USceneComponent* Component = Cast<USceneComponent>(Pair.Value.OutputComponent);
+				if (IsValid(Component))
+					OutState.PreviousComponents.Add(Component);
+			}
+		}
+	}
+
 	// Get the temp folder override
 	FHoudiniOutputTranslator::GetTempFolderFromAttribute(HAC);
 
@@ -104,7 +146,26 @@ FHoudiniOutputTranslator::UpdateOutputs(
 			// capture the extent of the landscape. The extent of the landscape can only be calculated if all landscape
 			// tiles are still present in the map. If we find that we don't need this for updating of Input landscapes,
 			// we can safely remove this feature.
-			ClearAndRemoveOutputs(HAC, DeferredClearOutputs, true);
+			if (bInKeepOldOutputsUntilEnd)
+			{
+				// Keep the old outputs visible until all the new ones have been processed,
+				// except for landscapes, for the reason mentioned above.
+				for (UHoudiniOutput* OldOutput : HAC->Outputs)
+				{
+					if (!IsValid(OldOutput))
+						continue;
+
+					if (OldOutput->GetType() == EHoudiniOutputType::Landscape)
+						ClearOutput(OldOutput);
+					else
+						DeferredClearOutputs.Add(OldOutput);
+				}
+				HAC->Outputs.Empty();
+			}
+			else
+			{
+				ClearAndRemoveOutputs(HAC, DeferredClearOutputs, true);
+			}
 			// Replace with the new parameters
 			HAC->Outputs = NewOutputs;
 		}
@@ -115,6 +176,9 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		ClearAndRemoveOutputs(HAC, DeferredClearOutputs, true);
 	}
 
+	for (UHoudiniOutput* DeferredOutput : DeferredClearOutputs)
+		OutState.DeferredClearOutputs.Add(DeferredOutput);
+
 	// Look for details generic property attributes on the outputs,
 	// and try to apply them to the HAC.
 	// This can be used to preset some of the HDA's uproperty via attribute
@@ -163,16 +227,13 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		WorldComposition->bTemporarilyDisableOriginTracking = true;
 	}
 
+	OutState.PersistentWorld = PersistentWorld;
+	OutState.WorldComposition = WorldComposition;
+
 	// "Process" the mesh.
 	// TODO: Move this to the actual processing stage,
 	// And see if some of this could be threaded
-	UObject* OuterComponent = HAC;
-	
-	FString HoudiniAssetPath = FPaths::GetPath(HAC->GetPathName());
-	FString ComponentGUIDString = HAC->GetComponentGUID().ToString().Left(FHoudiniEngineUtils::PackageGUIDComponentNameLength);
-	FString HoudiniAssetNameString = HAC->GetDisplayName();
-
-	FHoudiniPackageParams PackageParams;
+	FHoudiniPackageParams& PackageParams = OutState.PackageParams;
 	PackageParams.PackageMode = FHoudiniPackageParams::GetDefaultStaticMeshesCookMode();
 	PackageParams.ReplaceMode = FHoudiniPackageParams::GetDefaultReplaceMode();
 
@@ -188,107 +249,223 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	// ----------------------------------------------------
 	// Outputs prepass
 	// ----------------------------------------------------
-	
-	TArray<UPackage*> CreatedWorldCompositionPackages;
-	bool bCreatedNewMaps = false;
-	//...  for heightfield outputs  ...//
 
-	// Collect all the landscape layers' global min/max values.
-	TMap<FString, float> LandscapeLayerGlobalMinimums;
-	TMap<FString, float> LandscapeLayerGlobalMaximums;
-	
-	// Store the instancer outputs separately so we can process them later, after all mesh output are processed.
 	// Determine the total number of instances, if we have more than 1 then mesh parts with instanced geo we will not create proxy meshes
 	// Also if we have object instancer (or oldschool attribute instancers), we won't be creating any proxy at all
-	TArray<UHoudiniOutput*> InstancerOutputs;
-	int32 NumInstances = 0;
-	bool bHasObjectInstancer = false;
-	
 	for (auto& CurOutput : HAC->Outputs)
 	{
 		if (CurOutput->GetType() == EHoudiniOutputType::Instancer)
 		{
-			// InstancerOutputs.Add(CurOutput);
 			for (const FHoudiniGeoPartObject &HGPO : CurOutput->GetHoudiniGeoPartObjects())
 			{
 				if (HGPO.Type == EHoudiniPartType::Instancer)
 				{
 					if (HGPO.InstancerType == EHoudiniInstancerType::PackedPrimitive)
 					{
-						NumInstances += HGPO.PartInfo.InstanceCount;
+						OutState.NumInstances += HGPO.PartInfo.InstanceCount;
 					}
 					else
 					{
-						NumInstances += HGPO.PartInfo.PointCount;
+						OutState.NumInstances += HGPO.PartInfo.PointCount;
 					}
 
 					if ((HGPO.InstancerType == EHoudiniInstancerType::ObjectInstancer)
 						|| (HGPO.InstancerType == EHoudiniInstancerType::OldSchoolAttributeInstancer))
 					{
-						bHasObjectInstancer = true;
+						OutState.bHasObjectInstancer = true;
 					}
 				}
 			}
 		}
 		else if (CurOutput->GetType() == EHoudiniOutputType::Landscape)
 		{
-			FHoudiniLandscapeTranslator::CalcHeightfieldsArrayGlobalZMinZMax(CurOutput->GetHoudiniGeoPartObjects(), LandscapeLayerGlobalMinimums, LandscapeLayerGlobalMaximums, false);
+			// Collect all the landscape layers' global min/max values.
+			FHoudiniLandscapeTranslator::CalcHeightfieldsArrayGlobalZMinZMax(
+				CurOutput->GetHoudiniGeoPartObjects(), OutState.LandscapeLayerGlobalMinimums, OutState.LandscapeLayerGlobalMaximums, false);
 		}
 	}
 
-	bOutHasHoudiniStaticMeshOutput = false;
-	int32 NumVisibleOutputs = 0;
-	int32 NumOutputs = HAC->Outputs.Num();
-	bool bHasLandscape = false;
+	// Preview cooks (while parameters are being edited) skip the expensive output stages:
+	// proxy meshes are created instead of building static meshes / collisions, and existing materials are reused.
+	OutState.bIsPreviewCook = HAC->HasPreviewOutputs();
 
 	// Before processing all the outputs, 
 	// See if we have any landscape input that have "Update Input Landscape" enabled
 	// And make an array of all our input landscapes as well.
-	TArray<ALandscapeProxy *> AllInputLandscapes;
-	TArray<ALandscapeProxy *> InputLandscapesToUpdate;
-	
-	FHoudiniEngineUtils::GatherLandscapeInputs(HAC, AllInputLandscapes, InputLandscapesToUpdate);
+	FHoudiniEngineUtils::GatherLandscapeInputs(HAC, OutState.AllInputLandscapes, OutState.InputLandscapesToUpdate);
+
+	OutState.NumOutputs = HAC->Outputs.Num();
+	OutState.NextOutputIndex = 0;
+	OutState.NextInstancerIndex = 0;
+	OutState.bIsValid = true;
+
+	// Start the fetch stage, the outputs will wait for it before being processed
+	StartFetchingOutputData(HAC, OutState);
+
+	return true;
+}
+
+void
+FHoudiniOutputTranslator::StartFetchingOutputData(
+	UHoudiniAssetComponent* HAC,
+	FHoudiniOutputProcessingState& InOutState)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return;
+
+	// Copy the parts that will need their data, the UObjects must not be touched from the worker thread
+	TArray<FHoudiniGeoPartObject> MeshHGPOs;
+	TArray<FHoudiniGeoPartObject> InstancerHGPOs;
+	for (UHoudiniOutput* CurOutput : HAC->Outputs)
+	{
+		if (!IsValid(CurOutput) || !HAC->IsOutputTypeSupported(CurOutput->GetType()))
+			continue;
+
+		if (CurOutput->GetType() == EHoudiniOutputType::Mesh)
+		{
+			// Unchanged parts reuse their meshes, unless the output's proxies have to be refined
+			const bool bForceRebuild = CurOutput->HasAnyCurrentProxy();
+			for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
+			{
+				if (CurHGPO.Type == EHoudiniPartType::Mesh && (bForceRebuild || CurHGPO.bHasGeoChanged || CurHGPO.bHasPartChanged))
+					MeshHGPOs.Add(CurHGPO);
+			}
+		}
+		else if (CurOutput->GetType() == EHoudiniOutputType::Instancer)
+		{
+			for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
+			{
+				if (CurHGPO.Type == EHoudiniPartType::Instancer)
+					InstancerHGPOs.Add(CurHGPO);
+			}
+		}
+	}
+
+	if (MeshHGPOs.Num() <= 0 && InstancerHGPOs.Num() <= 0)
+		return;
+
+	InOutState.PrefetchTask = Async(EAsyncExecution::ThreadPool,
+		[MeshHGPOs = MoveTemp(MeshHGPOs), InstancerHGPOs = MoveTemp(InstancerHGPOs)]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		const int32 NumMeshParts = MeshHGPOs.Num();
+		TArray<TSharedPtr<FHoudiniMeshTranslator>> MeshResults;
+		MeshResults.SetNum(NumMeshParts);
+		TArray<FHoudiniInstancerPartHAPIData> InstancerResults;
+		InstancerResults.SetNum(InstancerHGPOs.Num());
+		TArray<bool> InstancerSucceeded;
+		InstancerSucceeded.SetNumZeroed(InstancerHGPOs.Num());
+
+		ParallelFor(NumMeshParts + InstancerHGPOs.Num(), [&](int32 Index)
+		{
+			if (Index < NumMeshParts)
+			{
+				MeshResults[Index] = FHoudiniMeshTranslator::PrefetchPartData(MeshHGPOs[Index]);
+			}
+			else
+			{
+				const int32 InstancerIndex = Index - NumMeshParts;
+				InstancerSucceeded[InstancerIndex] = FHoudiniInstanceTranslator::GatherInstancerPartHAPIData(
+					InstancerHGPOs[InstancerIndex], InstancerResults[InstancerIndex]);
+			}
+		});
+
+		TSharedPtr<FHoudiniPrefetchedOutputData> Data = MakeShared<FHoudiniPrefetchedOutputData>();
+		for (int32 Index = 0; Index < NumMeshParts; Index++)
+		{
+			if (!MeshResults[Index].IsValid())
+				continue;
+
+			const FHoudiniGeoPartObject& CurHGPO = MeshHGPOs[Index];
+			FHoudiniOutputObjectIdentifier PartIdentifier(CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId, FString());
+			PartIdentifier.PartName = CurHGPO.PartName;
+			Data->MeshParts.Add(PartIdentifier, MeshResults[Index]);
+		}
+
+		for (int32 Index = 0; Index < InstancerHGPOs.Num(); Index++)
+		{
+			if (!InstancerSucceeded[Index])
+				continue;
+
+			const FHoudiniGeoPartObject& CurHGPO = InstancerHGPOs[Index];
+			FHoudiniOutputObjectIdentifier PartIdentifier(CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId, FString());
+			PartIdentifier.PartName = CurHGPO.PartName;
+			Data->InstancerParts.Add(PartIdentifier, MoveTemp(InstancerResults[Index]));
+		}
+
+		HOUDINI_LOG_MESSAGE(TEXT("Fetched the data of %d mesh part(s) and %d instancer part(s) in %.3f seconds."),
+			Data->MeshParts.Num(), Data->InstancerParts.Num(), FPlatformTime::Seconds() - StartTime);
+
+		return Data;
+	});
+}
+
+bool
+FHoudiniOutputTranslator::IsFetchingOutputData(const FHoudiniOutputProcessingState& InOutState)
+{
+	return InOutState.PrefetchTask.IsValid() && !InOutState.PrefetchTask.IsReady();
+}
+
+void
+FHoudiniOutputTranslator::FinishFetchingOutputData(FHoudiniOutputProcessingState& InOutState)
+{
+	if (!InOutState.PrefetchTask.IsValid())
+		return;
+
+	InOutState.PrefetchedData = InOutState.PrefetchTask.Get();
+	InOutState.PrefetchTask = TFuture<TSharedPtr<FHoudiniPrefetchedOutputData>>();
+
+	if (!InOutState.PrefetchedData.IsValid())
+		return;
+
+	// The instancer part data has been gathered by the fetch stage
+	InOutState.InstancerPartHAPIData = MoveTemp(InOutState.PrefetchedData->InstancerParts);
+	InOutState.bHasGatheredInstancerData = true;
+}
+
+bool
+FHoudiniOutputTranslator::ProcessNextOutput(
+	UHoudiniAssetComponent* HAC,
+	FHoudiniOutputProcessingState& InOutState)
+{
+	if (!HAC || HAC->IsPendingKill() || !InOutState.bIsValid)
+		return true;
+
+	UObject* OuterComponent = HAC;
+	FHoudiniPackageParams& PackageParams = InOutState.PackageParams;
+
+	// Make sure the fetch stage is done before creating anything from its data
+	FinishFetchingOutputData(InOutState);
 
 	// ----------------------------------------------------
 	// Process outputs
 	// ----------------------------------------------------
-	// Landscape creation will cache the first tile as a reference location
-	// in this struct to be used by during construction of subsequent tiles.
-	FHoudiniLandscapeReferenceLocation LandscapeReferenceLocation;
-	// Landscape Size info will be cached by the first tile, similar to LandscapeReferenceLocation
-	FHoudiniLandscapeTileSizeInfo LandscapeSizeInfo;
-	FHoudiniLandscapeExtent LandscapeExtent;
-	TSet<FString> ClearedLandscapeLayers;
-
-	// The houdini materials that have been generated by this HDA.
-	// We track them to prevent recreate the same houdini material over and over if it is assigned to multiple parts.
-	// (this can easily happen when using packed prims)
-	TMap<FString, UMaterialInterface*> AllOutputMaterials;
-
-	TArray<UPackage*> CreatedPackages;
-	for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
+	if (InOutState.NextOutputIndex < InOutState.NumOutputs)
 	{
+		const int32 OutputIdx = InOutState.NextOutputIndex++;
 		UHoudiniOutput* CurOutput = HAC->GetOutputAt(OutputIdx);
 		if (!CurOutput || CurOutput->IsPendingKill())
-			continue;
+			return false;
 
+		const int32 NumOutputs = InOutState.NumOutputs;
 		FString Notification = FString::Format(TEXT("Processing output {0} / {1}..."), {FString::FromInt(OutputIdx + 1), FString::FromInt(NumOutputs)});
 		FHoudiniEngine::Get().UpdateTaskSlateNotification(FText::FromString(Notification));
 
 		if (!HAC->IsOutputTypeSupported(CurOutput->GetType()))
-			continue;
+			return false;
 
 		switch (CurOutput->GetType())
 		{
 			case EHoudiniOutputType::Mesh:
 			{
 				bool bIsProxyStaticMeshEnabled = (
-					HAC->IsProxyStaticMeshEnabled() &&
+					(HAC->IsProxyStaticMeshEnabled() || InOutState.bIsPreviewCook) &&
 					!HAC->HasNoProxyMeshNextCookBeenRequested() &&
 					!HAC->IsBakeAfterNextCookEnabled());
-				if (bIsProxyStaticMeshEnabled && NumInstances > 1)
+				if (bIsProxyStaticMeshEnabled && InOutState.NumInstances > 1)
 				{
-					if (bHasObjectInstancer)
+					if (InOutState.bHasObjectInstancer)
 					{
 						// Completely disable proxies if we have object instancers/old school attribute instancers
 						// as they rely on having a static mesh created (and the instanced mesh HGPO is not marked as instanced...)
@@ -314,15 +491,18 @@ FHoudiniOutputTranslator::UpdateOutputs(
 					bIsProxyStaticMeshEnabled ? EHoudiniStaticMeshMethod::UHoudiniStaticMesh : HAC->StaticMeshMethod,
 					HAC->StaticMeshGenerationProperties,
 					HAC->StaticMeshBuildSettings,
-					AllOutputMaterials,
-					OuterComponent);
+					InOutState.AllOutputMaterials,
+					OuterComponent,
+					InOutState.bIsPreviewCook,  // bInTreatExistingMaterialsAsUpToDate
+					false,
+					InOutState.PrefetchedData.IsValid() ? &InOutState.PrefetchedData->MeshParts : nullptr);
 
-				NumVisibleOutputs++;
+				InOutState.NumVisibleOutputs++;
 
 				// Look for UHoudiniStaticMesh in the output, and set bOutHasHoudiniStaticMeshOutput accordingly
-				if (bIsProxyStaticMeshEnabled && !bOutHasHoudiniStaticMeshOutput)
+				if (bIsProxyStaticMeshEnabled && !InOutState.bHasHoudiniStaticMeshOutput)
 				{
-					bOutHasHoudiniStaticMeshOutput &= CurOutput->HasAnyCurrentProxy();
+					InOutState.bHasHoudiniStaticMeshOutput &= CurOutput->HasAnyCurrentProxy();
 				}
 				break;
 			}
@@ -332,7 +512,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 				const TArray<FHoudiniGeoPartObject> &GeoPartObjects = CurOutput->GetHoudiniGeoPartObjects();
 
 				if (GeoPartObjects.Num() <= 0)
-					continue;
+					return false;
 
 				const FHoudiniGeoPartObject & CurHGPO = GeoPartObjects[0];
 
@@ -365,19 +545,20 @@ FHoudiniOutputTranslator::UpdateOutputs(
 				{	
 					// Output curve
 					FHoudiniSplineTranslator::CreateAllSplinesFromHoudiniOutput(CurOutput, OuterComponent);
-					NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
+					InOutState.NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
 					break;
 				}
 			}
 			break;
 
 		case EHoudiniOutputType::Instancer:
-			InstancerOutputs.Add(CurOutput);
+			// Instancers are processed after all the mesh outputs
+			InOutState.InstancerOutputs.Add(CurOutput);
 			break;
 
 		case EHoudiniOutputType::Landscape:
 		{
-			NumVisibleOutputs++;
+			InOutState.NumVisibleOutputs++;
 
 			// This gets called for each heightfield primitive from Houdini, i.e., each "tile".
 			bool bNewMapCreated = false;
@@ -387,24 +568,25 @@ FHoudiniOutputTranslator::UpdateOutputs(
 			// make use of untracked actors on the HAC (similar to PDG Asset Link).
 			TArray<TWeakObjectPtr<AActor>> UntrackedActors;
 
+			UWorld* PersistentWorld = InOutState.PersistentWorld.Get();
 			FHoudiniLandscapeTranslator::CreateLandscape(
 				CurOutput,
 				UntrackedActors,
-				InputLandscapesToUpdate,
-				AllInputLandscapes,
+				InOutState.InputLandscapesToUpdate,
+				InOutState.AllInputLandscapes,
 				HAC,
 				TEXT("{hda_actor_name}_"),
 				PersistentWorld,
-				LandscapeLayerGlobalMinimums,
-				LandscapeLayerGlobalMaximums,
-				LandscapeExtent,
-				LandscapeSizeInfo,
-				LandscapeReferenceLocation,
+				InOutState.LandscapeLayerGlobalMinimums,
+				InOutState.LandscapeLayerGlobalMaximums,
+				InOutState.LandscapeExtent,
+				InOutState.LandscapeSizeInfo,
+				InOutState.LandscapeReferenceLocation,
 				PackageParams,
-				ClearedLandscapeLayers,
-				CreatedPackages);
+				InOutState.ClearedLandscapeLayers,
+				InOutState.CreatedPackages);
 
-			bHasLandscape = true;
+			InOutState.bHasLandscape = true;
 
 			// Attach the created landscape to the parent HAC.
 			ALandscapeProxy* OutputLandscape = nullptr;
@@ -433,7 +615,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 				FEditorDelegates::PostLandscapeLayerUpdated.Broadcast();
 			}
 
-			bCreatedNewMaps |= bNewMapCreated;
+			InOutState.bCreatedNewMaps |= bNewMapCreated;
 			break;
 		}
 		default:
@@ -444,21 +626,214 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		for (auto& CurMat : CurOutput->AssignementMaterials)
 		{
 			// Add the newly generated materials if any
-			if (!AllOutputMaterials.Contains(CurMat.Key))
-				AllOutputMaterials.Add(CurMat);
+			if (!InOutState.AllOutputMaterials.Contains(CurMat.Key))
+				InOutState.AllOutputMaterials.Add(CurMat);
 		}
+
+		HideProcessedOutput(CurOutput, InOutState);
+
+		return false;
 	}
 
 	// Now that all meshes have been created, process the instancers
-	for (auto& CurOutput : InstancerOutputs)
+	if (InOutState.NextInstancerIndex < InOutState.InstancerOutputs.Num())
 	{
-		if (!FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent, PackageParams))
+		if (!InOutState.bHasGatheredInstancerData)
+		{
+			InOutState.bHasGatheredInstancerData = true;
+			GatherAllInstancerPartHAPIData(InOutState);
+		}
+
+		UHoudiniOutput* CurOutput = InOutState.InstancerOutputs[InOutState.NextInstancerIndex++].Get();
+		if (IsValid(CurOutput))
+		{
+			// Finish the part data on the game thread, now that the instanced meshes exist
+			TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData> InstancedOutputPartData;
+			for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->HoudiniGeoPartObjects)
+			{
+				if (CurHGPO.Type != EHoudiniPartType::Instancer)
+					continue;
+
+				FHoudiniOutputObjectIdentifier OutputIdentifier(CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId, FString());
+				OutputIdentifier.PartName = CurHGPO.PartName;
+
+				FHoudiniInstancerPartHAPIData* HAPIData = InOutState.InstancerPartHAPIData.Find(OutputIdentifier);
+				if (!HAPIData)
+					continue;
+
+				FHoudiniInstancedOutputPartData PartData;
+				if (FHoudiniInstanceTranslator::FinishInstancedOutputPartData(CurHGPO, HAC->Outputs, *HAPIData, PartData))
+					InstancedOutputPartData.Add(OutputIdentifier, MoveTemp(PartData));
+
+				InOutState.InstancerPartHAPIData.Remove(OutputIdentifier);
+			}
+
+			if (FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
+				CurOutput, HAC->Outputs, OuterComponent, PackageParams, &InstancedOutputPartData))
+			{
+				InOutState.NumVisibleOutputs++;
+			}
+
+			HideProcessedOutput(CurOutput, InOutState);
+		}
+
+		return InOutState.NextInstancerIndex >= InOutState.InstancerOutputs.Num();
+	}
+
+	// All work units have been processed
+	return true;
+}
+
+void
+FHoudiniOutputTranslator::HideProcessedOutput(UHoudiniOutput* InOutput, FHoudiniOutputProcessingState& InOutState)
+{
+	if (!InOutState.bKeepOldOutputsUntilEnd || !IsValid(InOutput))
+		return;
+
+	// Landscapes are actors, and the old ones have already been cleared
+	if (InOutput->GetType() == EHoudiniOutputType::Landscape)
+		return;
+
+	for (auto& Pair : InOutput->GetOutputObjects())
+	{
+		USceneComponent* Component = Cast<USceneComponent>(Pair.Value.OutputComponent);
+		if (!IsValid(Component) || !Component->IsVisible())
+			continue;
+
+		if (InOutState.PreviousComponents.Contains(Component))
 			continue;
 
-		NumVisibleOutputs++;
+		// Only the components that were visible are tracked, so the ones hidden on purpose stay hidden
+		Component->SetVisibility(false);
+		InOutState.HiddenComponents.Add(Component);
+	}
+}
+
+void
+FHoudiniOutputTranslator::ShowHiddenOutputs(FHoudiniOutputProcessingState& InOutState)
+{
+	for (const TWeakObjectPtr<USceneComponent>& Component : InOutState.HiddenComponents)
+	{
+		if (Component.IsValid() && !Component->IsPendingKill())
+			Component->SetVisibility(true);
 	}
+	InOutState.HiddenComponents.Empty();
+}
 
-	if (NumVisibleOutputs > 0)
+void
+FHoudiniOutputProcessingState::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(CreatedPackages);
+	Collector.AddReferencedObjects(AllInputLandscapes);
+	Collector.AddReferencedObjects(InputLandscapesToUpdate);
+	for (auto& Pair : AllOutputMaterials)
+		Collector.AddReferencedObject(Pair.Value);
+	Collector.AddReferencedObject(PackageParams.OuterPackage);
+}
+
+void
+FHoudiniOutputTranslator::ClearDeferredOutputs(FHoudiniOutputProcessingState& InOutState)
+{
+	for (const TWeakObjectPtr<UHoudiniOutput>& OldOutput : InOutState.DeferredClearOutputs)
+	{
+		if (OldOutput.IsValid())
+			ClearOutput(OldOutput.Get());
+	}
+	InOutState.DeferredClearOutputs.Empty();
+}
+
+void
+FHoudiniOutputTranslator::CancelUpdateOutputs(
+	UHoudiniAssetComponent* HAC,
+	FHoudiniOutputProcessingState& InOutState)
+{
+	// The fetch stage is still reading from the HDA's nodes, which are about to be rebuilt or deleted
+	if (InOutState.PrefetchTask.IsValid())
+		InOutState.PrefetchTask.Wait();
+
+	if (InOutState.bIsValid)
+	{
+		if (IsValid(HAC))
+		{
+			ClearDeferredOutputs(InOutState);
+			ShowHiddenOutputs(InOutState);
+		}
+
+		UWorldComposition* WorldComposition = InOutState.WorldComposition.Get();
+		if (IsValid(WorldComposition))
+			WorldComposition->bTemporarilyDisableOriginTracking = false;
+	}
+
+	InOutState = FHoudiniOutputProcessingState();
+}
+
+void
+FHoudiniOutputTranslator::GatherAllInstancerPartHAPIData(FHoudiniOutputProcessingState& InOutState)
+{
+	InOutState.InstancerPartHAPIData.Empty();
+
+	// Collect all the instancer parts, the UObjects must not be touched from the worker threads
+	TArray<FHoudiniGeoPartObject> InstancerHGPOs;
+	for (const TWeakObjectPtr<UHoudiniOutput>& CurOutputPtr : InOutState.InstancerOutputs)
+	{
+		UHoudiniOutput* CurOutput = CurOutputPtr.Get();
+		if (!IsValid(CurOutput))
+			continue;
+
+		for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->HoudiniGeoPartObjects)
+		{
+			if (CurHGPO.Type == EHoudiniPartType::Instancer)
+				InstancerHGPOs.Add(CurHGPO);
+		}
+	}
+
+	if (InstancerHGPOs.Num() <= 0)
+		return;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FHoudiniInstancerPartHAPIData> AllHAPIData;
+	AllHAPIData.SetNum(InstancerHGPOs.Num());
+	TArray<bool> AllSucceeded;
+	AllSucceeded.SetNumZeroed(InstancerHGPOs.Num());
+
+	ParallelFor(InstancerHGPOs.Num(), [&InstancerHGPOs, &AllHAPIData, &AllSucceeded](int32 Index)
+	{
+		AllSucceeded[Index] = FHoudiniInstanceTranslator::GatherInstancerPartHAPIData(InstancerHGPOs[Index], AllHAPIData[Index]);
+	});
+
+	for (int32 Index = 0; Index < InstancerHGPOs.Num(); Index++)
+	{
+		if (!AllSucceeded[Index])
+			continue;
+
+		const FHoudiniGeoPartObject& CurHGPO = InstancerHGPOs[Index];
+		FHoudiniOutputObjectIdentifier OutputIdentifier(CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId, FString());
+		OutputIdentifier.PartName = CurHGPO.PartName;
+		InOutState.InstancerPartHAPIData.Add(OutputIdentifier, MoveTemp(AllHAPIData[Index]));
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Gathered the data of %d instancer parts in %.3f seconds."),
+		InstancerHGPOs.Num(), FPlatformTime::Seconds() - StartTime);
+}
+
+bool
+FHoudiniOutputTranslator::EndUpdateOutputs(
+	UHoudiniAssetComponent* HAC,
+	FHoudiniOutputProcessingState& InOutState,
+	bool& bOutHasHoudiniStaticMeshOutput)
+{
+	bOutHasHoudiniStaticMeshOutput = InOutState.bHasHoudiniStaticMeshOutput;
+
+	if (!HAC || HAC->IsPendingKill() || !InOutState.bIsValid)
+		return false;
+
+	InOutState.bIsValid = false;
+
+	UWorld* PersistentWorld = InOutState.PersistentWorld.Get();
+	UWorldComposition* WorldComposition = InOutState.WorldComposition.Get();
+
+	if (InOutState.NumVisibleOutputs > 0)
 	{
 		// If we have valid outputs, we don't need to display the houdini logo anymore...
 		FHoudiniEngineUtils::RemoveHoudiniLogoFromComponent(HAC);
@@ -473,10 +848,31 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	// This should happen before SharedLandscapeActor cleanup
 	// since this needs to remove old landscape proxies so that empty SharedLandscapeActors
 	// can be removed afterward.
-	HOUDINI_LANDSCAPE_MESSAGE(TEXT("[HoudiniOutputTranslator::UpdateOutputs] Clearing old outputs: %d"), DeferredClearOutputs.Num());
-	for(UHoudiniOutput* OldOutput : DeferredClearOutputs)
+	HOUDINI_LANDSCAPE_MESSAGE(TEXT("[HoudiniOutputTranslator::UpdateOutputs] Clearing old outputs: %d"), InOutState.DeferredClearOutputs.Num());
+	ClearDeferredOutputs(InOutState);
+
+	// Now that the old outputs are gone, display the new ones
+	ShowHiddenOutputs(InOutState);
+
+	// The output components were created/updated without change notifications, update the bounds of
+	// their actors for the world inputs' bound selectors
+	FHoudiniWorldInputChangeTracker& ChangeTracker = FHoudiniWorldInputChangeTracker::Get();
+	ChangeTracker.MarkActorBoundsChanged(HAC->GetOwner());
+	for (UHoudiniOutput* Output : HAC->Outputs)
 	{
-		ClearOutput(OldOutput);
+		if (!IsValid(Output))
+			continue;
+
+		for (const auto& Pair : Output->GetOutputObjects())
+		{
+			const USceneComponent* OutputComponent = Cast<USceneComponent>(Pair.Value.OutputComponent);
+			if (IsValid(OutputComponent) && OutputComponent->GetOwner() != HAC->GetOwner())
+				ChangeTracker.MarkActorBoundsChanged(OutputComponent->GetOwner());
+
+			UHoudiniLandscapePtr* LandscapePtr = Cast<UHoudiniLandscapePtr>(Pair.Value.OutputObject);
+			if (IsValid(LandscapePtr))
+				ChangeTracker.MarkActorBoundsChanged(LandscapePtr->GetRawPtr());
+		}
 	}
 
 	// if (IsValid(LandscapeExtents.IntermediateResizeLandscape))
@@ -485,7 +881,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	// 	LandscapeExtents.IntermediateResizeLandscape = nullptr;
 	// }
 
-	if (bHasLandscape)
+	if (InOutState.bHasLandscape)
 	{
 		// ----------------------------------------------------
 		// Cleanup untracked shared landscape actors
@@ -572,7 +968,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		}
 	}
 
-	if (bCreatedNewMaps)
+	if (InOutState.bCreatedNewMaps)
 	{
 		// Force the asset registry to update its cache of packages paths
 		// recursively for this world, otherwise world composition won't
@@ -591,11 +987,11 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		FEditorDelegates::RefreshAllBrowsers.Broadcast();
 	}
 
-	if (CreatedPackages.Num() > 0)
+	if (InOutState.CreatedPackages.Num() > 0)
 	{
 		// Save created packages. For example, we don't want landscape layers deleted 
 		// along with the HDA.
-		FEditorFileUtils::PromptForCheckoutAndSave(CreatedPackages, true, false);
+		FEditorFileUtils::PromptForCheckoutAndSave(InOutState.CreatedPackages, true, false);
 	}
 
 	return true;
@@ -2069,6 +2465,9 @@ FHoudiniOutputTranslator::ClearAndRemoveOutputs(UHoudiniAssetComponent *InHAC, T
 void 
 FHoudiniOutputTranslator::ClearOutput(UHoudiniOutput* Output) 
 {
+	// Identical parts of other outputs can't share this output's meshes anymore
+	FHoudiniMeshTranslator::ClearDeduplicatedMeshSources(Output);
+
 	switch (Output->GetType()) 
 	{
 		case EHoudiniOutputType::Landscape:
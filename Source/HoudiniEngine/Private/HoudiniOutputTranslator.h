@@ -30,28 +30,167 @@
 
 #include "CoreMinimal.h"
 
+#include "HoudiniPackageParams.h"
+#include "HoudiniTranslatorTypes.h"
+#include "HoudiniInstanceTranslator.h"
+
+#include "Async/Future.h"
+
 class UHoudiniOutput;
 class UHoudiniAssetComponent;
+class UMaterialInterface;
+class UPackage;
+class UWorld;
+class UWorldComposition;
+class USceneComponent;
+class ALandscapeProxy;
+class FReferenceCollector;
 
 struct FHoudiniObjectInfo;
 struct FHoudiniGeoInfo;
 struct FHoudiniPartInfo;
 struct FHoudiniVolumeInfo;
 struct FHoudiniCurveInfo;
+struct FHoudiniMeshTranslator;
 
 enum class EHoudiniOutputType : uint8;
 enum class EHoudiniGeoType : uint8;
 enum class EHoudiniPartType : uint8;
 enum class EHoudiniCurveType : int8;
 
+// HAPI data of the mesh and instancer parts, fetched on a worker thread before the outputs are processed
+struct HOUDINIENGINE_API FHoudiniPrefetchedOutputData
+{
+	TMap<FHoudiniOutputObjectIdentifier, TSharedPtr<FHoudiniMeshTranslator>> MeshParts;
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancerPartHAPIData> InstancerParts;
+};
+
+// Holds the state of an output update in progress, so that the outputs of a HAC
+// can be processed one work unit (output) at a time, over multiple ticks.
+struct HOUDINIENGINE_API FHoudiniOutputProcessingState
+{
+	// Indicates that BeginUpdateOutputs succeeded and EndUpdateOutputs hasn't been called yet
+	bool bIsValid = false;
+
+	// Index of the next output / instancer output to process
+	int32 NextOutputIndex = 0;
+	int32 NextInstancerIndex = 0;
+	int32 NumOutputs = 0;
+
+	// Instancer outputs are processed after all the other outputs
+	TArray<TWeakObjectPtr<UHoudiniOutput>> InstancerOutputs;
+	// HAPI data of all the instancer parts, gathered in parallel before the first instancer output is processed
+	bool bHasGatheredInstancerData = false;
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancerPartHAPIData> InstancerPartHAPIData;
+
+	// Fetch stage: the output data is fetched on a worker thread, UpdateProcess polls this task
+	// every tick without blocking, the game thread then only creates the UObjects from the prefetched data
+	TFuture<TSharedPtr<FHoudiniPrefetchedOutputData>> PrefetchTask;
+	TSharedPtr<FHoudiniPrefetchedOutputData> PrefetchedData;
+	// Old outputs that should only be cleared after the new outputs have been processed
+	TArray<TWeakObjectPtr<UHoudiniOutput>> DeferredClearOutputs;
+
+	// When the outputs are processed over multiple ticks, the old outputs stay visible and the
+	// processed outputs are hidden until EndUpdateOutputs, so old and new outputs are never displayed together.
+	// Components that already existed before the update are updated in place, and stay visible.
+	bool bKeepOldOutputsUntilEnd = false;
+	TSet<TWeakObjectPtr<USceneComponent>> PreviousComponents;
+	TArray<TWeakObjectPtr<USceneComponent>> HiddenComponents;
+
+	FHoudiniPackageParams PackageParams;
+
+	int32 NumInstances = 0;
+	bool bHasObjectInstancer = false;
+	bool bIsPreviewCook = false;
+	// Indicates that this update refines the outputs of a preview cook, without a new cook
+	bool bIsPreviewRefinement = false;
+
+	int32 NumVisibleOutputs = 0;
+	bool bHasHoudiniStaticMeshOutput = false;
+
+	TWeakObjectPtr<UWorld> PersistentWorld;
+	TWeakObjectPtr<UWorldComposition> WorldComposition;
+	bool bCreatedNewMaps = false;
+	TArray<UPackage*> CreatedPackages;
+
+	// Landscape data shared by all the heightfield tiles
+	bool bHasLandscape = false;
+	TMap<FString, float> LandscapeLayerGlobalMinimums;
+	TMap<FString, float> LandscapeLayerGlobalMaximums;
+	TArray<ALandscapeProxy*> AllInputLandscapes;
+	TArray<ALandscapeProxy*> InputLandscapesToUpdate;
+	FHoudiniLandscapeReferenceLocation LandscapeReferenceLocation;
+	FHoudiniLandscapeTileSizeInfo LandscapeSizeInfo;
+	FHoudiniLandscapeExtent LandscapeExtent;
+	TSet<FString> ClearedLandscapeLayers;
+
+	// The houdini materials that have been generated by this HDA.
+	// We track them to prevent recreate the same houdini material over and over if it is assigned to multiple parts.
+	// (this can easily happen when using packed prims)
+	TMap<FString, UMaterialInterface*> AllOutputMaterials;
+
+	// The state is kept across ticks, so the objects it references have to be reported to the garbage collector
+	void AddReferencedObjects(FReferenceCollector& Collector);
+};
+
 struct HOUDINIENGINE_API FHoudiniOutputTranslator
 {
-	// 
+	// Updates all the outputs of the HAC at once
 	static bool UpdateOutputs(
 		UHoudiniAssetComponent* HAC,
 		const bool& bInForceUpdate,
 		bool& bOutHasHoudiniStaticMeshOutput);
 
+	// Time-sliced version of UpdateOutputs:
+	// BeginUpdateOutputs rebuilds the output list and prepares the processing state,
+	// ProcessNextOutput translates one output per call and returns true when all outputs have been processed,
+	// EndUpdateOutputs finalizes the update (landscapes, world composition, logo...)
+	// If bInKeepOldOutputsUntilEnd is true, the old outputs are only cleared, and the new ones only shown, by EndUpdateOutputs.
+	static bool BeginUpdateOutputs(
+		UHoudiniAssetComponent* HAC,
+		const bool& bInForceUpdate,
+		FHoudiniOutputProcessingState& OutState,
+		const bool bInKeepOldOutputsUntilEnd = false);
+
+	static bool ProcessNextOutput(
+		UHoudiniAssetComponent* HAC,
+		FHoudiniOutputProcessingState& InOutState);
+
+	static bool EndUpdateOutputs(
+		UHoudiniAssetComponent* HAC,
+		FHoudiniOutputProcessingState& InOutState,
+		bool& bOutHasHoudiniStaticMeshOutput);
+
+	// Abandons an output update that was started by BeginUpdateOutputs, ie when the HAC is rebuilt or destroyed
+	// while its outputs are being processed: waits for the fetch stage, clears the deferred outputs, shows the hidden
+	// outputs and restores the world composition's origin tracking. HAC can be null if it has been destroyed.
+	static void CancelUpdateOutputs(
+		UHoudiniAssetComponent* HAC,
+		FHoudiniOutputProcessingState& InOutState);
+
+	// Starts fetching the HAPI data of the HAC's mesh and instancer parts on a worker thread
+	static void StartFetchingOutputData(
+		UHoudiniAssetComponent* HAC,
+		FHoudiniOutputProcessingState& InOutState);
+
+	// Returns true while the output data is still being fetched on the worker thread
+	static bool IsFetchingOutputData(const FHoudiniOutputProcessingState& InOutState);
+
+	// Retrieves the fetched output data, waiting for the worker thread if needed
+	static void FinishFetchingOutputData(FHoudiniOutputProcessingState& InOutState);
+
+	// Hides the components of an output that has just been processed, if the state keeps the old outputs until the end
+	static void HideProcessedOutput(UHoudiniOutput* InOutput, FHoudiniOutputProcessingState& InOutState);
+
+	// Shows the components hidden by HideProcessedOutput
+	static void ShowHiddenOutputs(FHoudiniOutputProcessingState& InOutState);
+
+	// Clears the old outputs whose clear was deferred to the end of the update
+	static void ClearDeferredOutputs(FHoudiniOutputProcessingState& InOutState);
+
+	// Gathers the HAPI data of all the instancer parts of the state's instancer outputs on worker threads
+	static void GatherAllInstancerPartHAPIData(FHoudiniOutputProcessingState& InOutState);
+
 	//
 	static bool BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAssetComponent* HAC, bool bInDestroyProxies=false);
 
@@ -51,6 +51,9 @@ HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+// The BGEO commandlet pool's import throughput is averaged over this window
+static const double BGEOImportThroughputWindowSeconds = 10.0;
+
 FHoudiniPDGManager::FHoudiniPDGManager()
 {
 }
@@ -1645,6 +1648,8 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ProcessWorkItemResults);
 
+	// Restart any crashed commandlet workers (re-queueing their in-flight imports) before dispatching
+	RestartCrashedBGEOCommandletWorkers();
 	const EHoudiniBGEOCommandletStatus CommandletStatus = UpdateAndGetBGEOCommandletStatus();
 	for (auto& CurrentPDGAssetLink : PDGAssetLinks)
 	{
@@ -1731,13 +1736,13 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 
 							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
 							{
-								BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
+								// Queue the import, it will be sent to the least loaded worker
+								QueuedBGEOImports.Emplace(
 									CurrentWorkResultObj.FilePath,
 									CurrentWorkResultObj.Name,
 									PackageParams,
 									CurrentTOPNode->NodeId,
-									CurrentWorkResult.WorkItemID
-								), BGEOCommandletAddress);
+									CurrentWorkResult.WorkItemID);
 							}
 							else
 							{
@@ -1800,6 +1805,9 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 			}
 		}
 	}
+
+	// Send as many queued imports as the workers can take
+	DispatchQueuedBGEOImports();
 }
 
 void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
@@ -1807,14 +1815,20 @@ void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_DISPLAY(TEXT("Received Discover from %s"), *InContext->GetSender().ToString());
-	// Ignore any discover acks received if we already have a valid local address
-	// for the commandlet
-	if (BGEOCommandletAddress.IsValid())
+	if (!InMessage.CommandletGuid.IsValid())
 		return;
 
-	if (BGEOCommandletProcHandle.IsValid() && InMessage.CommandletGuid.IsValid() && BGEOCommandletGuid == InMessage.CommandletGuid)
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		BGEOCommandletAddress = InContext->GetSender();
+		if (Worker.Guid != InMessage.CommandletGuid)
+			continue;
+
+		// Ignore any discover acks received if we already have a valid local address
+		// for the commandlet
+		if (!Worker.Address.IsValid() && Worker.ProcHandle.IsValid())
+			Worker.Address = InContext->GetSender();
+
+		return;
 	}
 }
 
@@ -1823,6 +1837,32 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Received BGEO import result message"));
+
+	// Remove the import from its worker's in-flight list and update the throughput stats
+	const FMessageAddress& Sender = InContext->GetSender();
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Address != Sender)
+			continue;
+
+		const int32 NumRemoved = Worker.InFlightImports.RemoveAll([&InMessage](const FHoudiniPDGImportBGEOMessage& InFlight)
+		{
+			return InFlight.TOPNodeId == InMessage.TOPNodeId
+				&& InFlight.WorkItemId == InMessage.WorkItemId
+				&& InFlight.Name == InMessage.Name;
+		});
+		if (NumRemoved > 0)
+		{
+			NumCompletedBGEOImports += NumRemoved;
+			const double Now = FPlatformTime::Seconds();
+			RecentBGEOImportCompletionTimes.RemoveAll([Now](const double CompletionTime)
+			{
+				return Now - CompletionTime > BGEOImportThroughputWindowSeconds;
+			});
+			RecentBGEOImportCompletionTimes.Add(Now);
+		}
+		break;
+	}
 	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success || InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess)
 	{
 		FHoudiniPackageParams PackageParams;
@@ -2060,7 +2100,6 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 {
 	if (!BGEOCommandletEndpoint.IsValid())
 	{
-		BGEOCommandletAddress.Invalidate();
 		BGEOCommandletEndpoint = FMessageEndpoint::Builder(TEXT("Houdini BGEO Commandlet"))
 			.Handling<FHoudiniPDGImportBGEOResultMessage>(this, &FHoudiniPDGManager::HandleImportBGEOResultMessage)
 			.Handling<FHoudiniPDGImportBGEODiscoverMessage>(this, &FHoudiniPDGManager::HandleImportBGEODiscoverMessage)
@@ -2075,101 +2114,301 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 		BGEOCommandletEndpoint->Subscribe<FHoudiniPDGImportBGEODiscoverMessage>();
 	}
 
-	if (!BGEOCommandletProcHandle.IsValid() || !FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	int32 NumWorkers = 1;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (IsValid(HoudiniRuntimeSettings))
+		NumWorkers = FMath::Max(1, HoudiniRuntimeSettings->PDGAsyncCommandletImportWorkerCount);
+
+	// Only grow the pool here: shrinking it would require stopping workers that may have imports in flight
+	if (BGEOCommandletWorkers.Num() < NumWorkers)
 	{
-		// Start the bgeo commandlet
-		static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
-		BGEOCommandletGuid = FGuid::NewGuid();
-		BGEOCommandletAddress.Invalidate();
+		BGEOCommandletWorkers.SetNum(NumWorkers);
+		NumCompletedBGEOImports = 0;
+		RecentBGEOImportCompletionTimes.Empty();
+	}
 
-		// Get the absolute path to the project file, if known, otherwise get
-		// the project name. For the path: quote it for the command line.
-		IFileManager& FileManager = IFileManager::Get();
-		FString ProjectPathOrName = FApp::GetProjectName();
-		if (FPaths::IsProjectFilePathSet())
-		{
-			const FString ProjectPath = FPaths::GetProjectFilePath();
-			if (!ProjectPath.IsEmpty())
-			{
-				ProjectPathOrName = FString::Printf(
-                    TEXT("\"%s\""),
-                    *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
-                );
-			}
-		}
+	bool bStartedAll = true;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			continue;
 
-		if (ProjectPathOrName.IsEmpty())
-			return false;
+		if (!StartBGEOCommandletWorker(Worker))
+			bStartedAll = false;
+	}
 
-		// Get the executable path for the app/editor
-		FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
-		if (!ExePath.IsEmpty())
-			ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+	return bStartedAll;
+}
 
-		if (ExePath.IsEmpty())
-			return false;
-		
-		const FString CommandLineParameters = FString::Printf(
-			TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
-			*ProjectPathOrName,
-			*BGEOCommandletName,
-			*BGEOCommandletGuid.ToString(),
-			*BGEOCommandletEndpoint->GetAddress().ToString(),
-			FPlatformProcess::GetCurrentProcessId());
-
-		BGEOCommandletProcHandle = FPlatformProcess::CreateProc(
-			*ExePath,
-			*CommandLineParameters,
-			false,
-			true,
-			false,
-			&BGEOCommandletProcessId,
-			0,
-			NULL,
-			NULL);
-		if (!BGEOCommandletProcHandle.IsValid())
+bool FHoudiniPDGManager::StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker)
+{
+	if (!BGEOCommandletEndpoint.IsValid())
+		return false;
+
+	// Start the bgeo commandlet
+	static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
+	InWorker.Guid = FGuid::NewGuid();
+	InWorker.Address.Invalidate();
+	if (InWorker.ProcHandle.IsValid())
+		FPlatformProcess::CloseProc(InWorker.ProcHandle);
+
+	// Get the absolute path to the project file, if known, otherwise get
+	// the project name. For the path: quote it for the command line.
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
 		{
-			return false;
+			ProjectPathOrName = FString::Printf(
+                TEXT("\"%s\""),
+                *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
+            );
 		}
 	}
 
-	return true;
+	if (ProjectPathOrName.IsEmpty())
+		return false;
+
+	// Get the executable path for the app/editor
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+
+	if (ExePath.IsEmpty())
+		return false;
+	
+	const FString CommandLineParameters = FString::Printf(
+		TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
+		*ProjectPathOrName,
+		*BGEOCommandletName,
+		*InWorker.Guid.ToString(),
+		*BGEOCommandletEndpoint->GetAddress().ToString(),
+		FPlatformProcess::GetCurrentProcessId());
+
+	InWorker.ProcHandle = FPlatformProcess::CreateProc(
+		*ExePath,
+		*CommandLineParameters,
+		false,
+		true,
+		false,
+		&InWorker.ProcessId,
+		0,
+		NULL,
+		NULL);
+
+	return InWorker.ProcHandle.IsValid();
 }
 
 void FHoudiniPDGManager::StopBGEOCommandletAndEndpoint()
 {
 	BGEOCommandletEndpoint.Reset();
-	BGEOCommandletAddress.Invalidate();
-	BGEOCommandletGuid.Invalidate();
 
-	if (BGEOCommandletProcHandle.IsValid() && FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		FPlatformProcess::TerminateProc(BGEOCommandletProcHandle, true);
-		if (BGEOCommandletProcHandle.IsValid())
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
 		{
-			FPlatformProcess::WaitForProc(BGEOCommandletProcHandle);
-			FPlatformProcess::CloseProc(BGEOCommandletProcHandle);
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			FPlatformProcess::WaitForProc(Worker.ProcHandle);
 		}
+		// Workers that already exited still hold an open handle
+		if (Worker.ProcHandle.IsValid())
+			FPlatformProcess::CloseProc(Worker.ProcHandle);
+
+		// The results of the imports that were in flight will never arrive: load them in-process instead
+		ReleaseBGEOImportsToLocalLoad(Worker.InFlightImports);
 	}
+	BGEOCommandletWorkers.Empty();
+
+	ReleaseBGEOImportsToLocalLoad(QueuedBGEOImports);
+	QueuedBGEOImports.Empty();
+
+	BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 }
 
 EHoudiniBGEOCommandletStatus FHoudiniPDGManager::UpdateAndGetBGEOCommandletStatus()
 {
-	if (BGEOCommandletProcHandle.IsValid())
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		if (!FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
-		else if (BGEOCommandletAddress.IsValid())
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+		if (Worker.ProcHandle.IsValid())
+		{
+			if (!FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+				Worker.Status = EHoudiniBGEOCommandletStatus::Crashed;
+			else if (Worker.Address.IsValid())
+				Worker.Status = EHoudiniBGEOCommandletStatus::Connected;
+			else
+				Worker.Status = EHoudiniBGEOCommandletStatus::Running;
+		}
 		else
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+			Worker.Status = EHoudiniBGEOCommandletStatus::NotStarted;
 	}
-	else
-		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 
+	BGEOCommandletStatus = GetBGEOCommandletPoolStatus(BGEOCommandletWorkers);
 	return BGEOCommandletStatus;
 }
 
+EHoudiniBGEOCommandletStatus FHoudiniPDGManager::GetBGEOCommandletPoolStatus(const TArray<FHoudiniBGEOCommandletWorker>& InWorkers)
+{
+	bool bAnyConnected = false;
+	bool bAnyRunning = false;
+	bool bAnyCrashed = false;
+	for (const FHoudiniBGEOCommandletWorker& Worker : InWorkers)
+	{
+		bAnyConnected |= Worker.Status == EHoudiniBGEOCommandletStatus::Connected;
+		bAnyRunning |= Worker.Status == EHoudiniBGEOCommandletStatus::Running;
+		bAnyCrashed |= Worker.Status == EHoudiniBGEOCommandletStatus::Crashed;
+	}
+
+	if (bAnyConnected)
+		return EHoudiniBGEOCommandletStatus::Connected;
+	else if (bAnyRunning)
+		return EHoudiniBGEOCommandletStatus::Running;
+	else if (bAnyCrashed)
+		return EHoudiniBGEOCommandletStatus::Crashed;
+
+	return EHoudiniBGEOCommandletStatus::NotStarted;
+}
+
+int32 FHoudiniPDGManager::FindLeastLoadedBGEOCommandletWorker(const TArray<FHoudiniBGEOCommandletWorker>& InWorkers, const int32 InMaxImportsPerWorker)
+{
+	int32 LeastLoadedWorkerIdx = INDEX_NONE;
+	for (int32 WorkerIdx = 0; WorkerIdx < InWorkers.Num(); ++WorkerIdx)
+	{
+		const FHoudiniBGEOCommandletWorker& Worker = InWorkers[WorkerIdx];
+		if (Worker.Status != EHoudiniBGEOCommandletStatus::Connected || Worker.InFlightImports.Num() >= InMaxImportsPerWorker)
+			continue;
+
+		if (LeastLoadedWorkerIdx == INDEX_NONE || Worker.InFlightImports.Num() < InWorkers[LeastLoadedWorkerIdx].InFlightImports.Num())
+			LeastLoadedWorkerIdx = WorkerIdx;
+	}
+
+	return LeastLoadedWorkerIdx;
+}
+
+void FHoudiniPDGManager::RestartCrashedBGEOCommandletWorkers()
+{
+	// Give up on a worker after this many restarts, to avoid relaunching a process that crashes on startup forever
+	static const int32 MaxNumRestarts = 3;
+
+	UpdateAndGetBGEOCommandletStatus();
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Status != EHoudiniBGEOCommandletStatus::Crashed)
+			continue;
+
+		// Put the imports this worker was processing back at the front of the queue
+		if (Worker.InFlightImports.Num() > 0)
+		{
+			HOUDINI_PDG_WARNING(TEXT("BGEO commandlet (pid %d) stopped with %d import(s) in flight, re-queueing them."), Worker.ProcessId, Worker.InFlightImports.Num());
+			QueuedBGEOImports.Insert(Worker.InFlightImports, 0);
+			Worker.InFlightImports.Empty();
+		}
+
+		if (Worker.NumRestarts >= MaxNumRestarts)
+			continue;
+
+		Worker.NumRestarts++;
+		HOUDINI_PDG_WARNING(TEXT("Restarting crashed BGEO commandlet (attempt %d of %d)."), Worker.NumRestarts, MaxNumRestarts);
+		if (!StartBGEOCommandletWorker(Worker))
+			HOUDINI_PDG_ERROR(TEXT("Failed to restart the BGEO commandlet."));
+	}
+
+	// If no worker is left to process the queue, load the remaining imports in-process
+	const EHoudiniBGEOCommandletStatus PoolStatus = UpdateAndGetBGEOCommandletStatus();
+	if (QueuedBGEOImports.Num() > 0
+		&& PoolStatus != EHoudiniBGEOCommandletStatus::Connected
+		&& PoolStatus != EHoudiniBGEOCommandletStatus::Running)
+	{
+		ReleaseBGEOImportsToLocalLoad(QueuedBGEOImports);
+		QueuedBGEOImports.Empty();
+	}
+}
+
+void FHoudiniPDGManager::DispatchQueuedBGEOImports()
+{
+	if (QueuedBGEOImports.Num() <= 0 || !BGEOCommandletEndpoint.IsValid())
+		return;
+
+	int32 MaxImportsPerWorker = 2;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (IsValid(HoudiniRuntimeSettings))
+		MaxImportsPerWorker = FMath::Max(1, HoudiniRuntimeSettings->PDGAsyncCommandletMaxImportsPerWorker);
+
+	int32 NumDispatched = 0;
+	while (NumDispatched < QueuedBGEOImports.Num())
+	{
+		// Find the least loaded connected worker that can still take an import
+		const int32 WorkerIdx = FindLeastLoadedBGEOCommandletWorker(BGEOCommandletWorkers, MaxImportsPerWorker);
+		if (WorkerIdx == INDEX_NONE)
+			break;
+
+		FHoudiniBGEOCommandletWorker& Worker = BGEOCommandletWorkers[WorkerIdx];
+		const FHoudiniPDGImportBGEOMessage& Import = QueuedBGEOImports[NumDispatched++];
+		BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(Import), Worker.Address);
+		Worker.InFlightImports.Add(Import);
+	}
+
+	if (NumDispatched > 0)
+		QueuedBGEOImports.RemoveAt(0, NumDispatched);
+}
+
+void FHoudiniPDGManager::ReleaseBGEOImportsToLocalLoad(const TArray<FHoudiniPDGImportBGEOMessage>& InImports)
+{
+	for (const FHoudiniPDGImportBGEOMessage& Import : InImports)
+	{
+		FTOPWorkResultObject* WorkResultObject = FindWorkResultObjectForImport(Import);
+		if (WorkResultObject && WorkResultObject->State == EPDGWorkResultState::Loading)
+			WorkResultObject->State = EPDGWorkResultState::ToLoad;
+	}
+}
+
+FTOPWorkResultObject* FHoudiniPDGManager::FindWorkResultObjectForImport(const FHoudiniPDGImportBGEOMessage& InMessage)
+{
+	UHoudiniPDGAssetLink* AssetLink = nullptr;
+	UTOPNetwork* TOPNetwork = nullptr;
+	UTOPNode* TOPNode = nullptr;
+	if (!GetTOPAssetLinkNetworkAndNode(InMessage.TOPNodeId, AssetLink, TOPNetwork, TOPNode) ||
+		!IsValid(AssetLink) || !IsValid(TOPNode))
+	{
+		return nullptr;
+	}
+
+	FTOPWorkResult* WorkResult = AssetLink->GetWorkResultByID(InMessage.WorkItemId, TOPNode);
+	if (!WorkResult)
+		return nullptr;
+
+	return WorkResult->ResultObjects.FindByPredicate([&InMessage](const FTOPWorkResultObject& WorkResultObject)
+	{
+		return WorkResultObject.Name == InMessage.Name;
+	});
+}
+
+FHoudiniBGEOCommandletPoolStats FHoudiniPDGManager::GetBGEOCommandletPoolStats() const
+{
+	FHoudiniBGEOCommandletPoolStats Stats;
+	Stats.NumWorkers = BGEOCommandletWorkers.Num();
+	Stats.NumQueuedImports = QueuedBGEOImports.Num();
+	Stats.NumCompletedImports = NumCompletedBGEOImports;
+	for (const FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Status == EHoudiniBGEOCommandletStatus::Connected)
+			Stats.NumConnectedWorkers++;
+		Stats.NumInFlightImports += Worker.InFlightImports.Num();
+	}
+
+	const double WindowStart = FPlatformTime::Seconds() - BGEOImportThroughputWindowSeconds;
+	int32 NumRecent = 0;
+	for (const double CompletionTime : RecentBGEOImportCompletionTimes)
+	{
+		if (CompletionTime >= WindowStart)
+			NumRecent++;
+	}
+	Stats.ImportsPerSecond = NumRecent / BGEOImportThroughputWindowSeconds;
+
+	return Stats;
+}
+
 
 bool
 FHoudiniPDGManager::IsPDGAsset(const HAPI_NodeId& InAssetId)
@@ -32,10 +32,13 @@
 
 #include "MessageEndpoint.h"
 
+#include "HoudiniPDGImporterMessages.h"
+
 class UHoudiniAssetComponent;
 class UHoudiniPDGAssetLink;
 class UTOPNetwork;
 class UTOPNode;
+struct FTOPWorkResultObject;
 class FSocket;
 
 enum class EPDGNodeState : uint8;
@@ -55,6 +58,36 @@ enum class HOUDINIENGINE_API EHoudiniBGEOCommandletStatus : uint8
 	Crashed
 };
 
+// A single BGEO commandlet process of the PDG manager's import worker pool
+struct HOUDINIENGINE_API FHoudiniBGEOCommandletWorker
+{
+	FProcHandle ProcHandle;
+	FGuid Guid;
+	// Address of the commandlet's endpoint, only valid once we have received its discover message
+	FMessageAddress Address;
+	uint32 ProcessId = 0;
+	EHoudiniBGEOCommandletStatus Status = EHoudiniBGEOCommandletStatus::NotStarted;
+	// Import requests that have been sent to this worker and for which we have not received a result yet
+	TArray<FHoudiniPDGImportBGEOMessage> InFlightImports;
+	// Number of times this worker has been restarted after crashing
+	int32 NumRestarts = 0;
+};
+
+// Statistics of the BGEO commandlet worker pool, for display in the UI
+struct HOUDINIENGINE_API FHoudiniBGEOCommandletPoolStats
+{
+	int32 NumWorkers = 0;
+	int32 NumConnectedWorkers = 0;
+	// Number of imports waiting for a worker to become available
+	int32 NumQueuedImports = 0;
+	// Number of imports currently being processed by the workers
+	int32 NumInFlightImports = 0;
+	// Number of imports completed since the pool was started
+	int32 NumCompletedImports = 0;
+	// Imports completed per second, averaged over the last few seconds
+	float ImportsPerSecond = 0.0f;
+};
+
 struct HOUDINIENGINE_API FHoudiniPDGManager
 {
 
@@ -153,20 +186,49 @@ public:
 		const struct FHoudiniPDGImportBGEOResultMessage& InMessage, 
 		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
 
-	// Create the bgeo commandlet endpoint and start the commandlet (if not already running).
+	// Create the bgeo commandlet endpoint and start the commandlet workers (if not already running).
+	// The number of workers is controlled by the PDGAsyncCommandletImportWorkerCount setting.
 	bool CreateBGEOCommandletAndEndpoint();
 
 	void StopBGEOCommandletAndEndpoint();
 
-	// Updates and returns the BGEO commandlet status
+	// Updates the status of all commandlet workers and returns the aggregate status of the pool:
+	// Connected if at least one worker is connected, Running if at least one is running, Crashed if all
+	// started workers have crashed.
 	EHoudiniBGEOCommandletStatus UpdateAndGetBGEOCommandletStatus();
 
+	// Returns the current statistics of the BGEO commandlet worker pool
+	FHoudiniBGEOCommandletPoolStats GetBGEOCommandletPoolStats() const;
+
+	// Returns the aggregate status of the given workers, from their current status (see UpdateAndGetBGEOCommandletStatus)
+	static EHoudiniBGEOCommandletStatus GetBGEOCommandletPoolStatus(const TArray<FHoudiniBGEOCommandletWorker>& InWorkers);
+
+	// Returns the index of the connected worker with the fewest imports in flight that can still take an import,
+	// INDEX_NONE if all the connected workers already have InMaxImportsPerWorker imports in flight.
+	static int32 FindLeastLoadedBGEOCommandletWorker(const TArray<FHoudiniBGEOCommandletWorker>& InWorkers, const int32 InMaxImportsPerWorker);
+
 private:
 	
 	void UpdatePDGContexts();
 
 	void ProcessWorkItemResults();
 
+	// Start (or restart) the commandlet process for the given worker
+	bool StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker);
+
+	// Restart crashed workers and re-queue the imports they had in flight
+	void RestartCrashedBGEOCommandletWorkers();
+
+	// Send queued imports to the least loaded connected workers
+	void DispatchQueuedBGEOImports();
+
+	// Set the work result objects of the given import requests back to ToLoad, so that they are loaded
+	// in-process on the next update
+	void ReleaseBGEOImportsToLocalLoad(const TArray<FHoudiniPDGImportBGEOMessage>& InImports);
+
+	// Find the work result object targeted by an import message. Returns null if it could not be found.
+	FTOPWorkResultObject* FindWorkResultObjectForImport(const FHoudiniPDGImportBGEOMessage& InMessage);
+
 	void ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_EventInfo& EventInfo);
 
 	static void ResetPDGEventInfo(HAPI_PDG_EventInfo& InEventInfo);
@@ -206,10 +268,13 @@ private:
 	int32 MaxNumberOPDGContexts = 20;
 
 	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> BGEOCommandletEndpoint;
-	FMessageAddress BGEOCommandletAddress;
-	FProcHandle BGEOCommandletProcHandle;
-	FGuid BGEOCommandletGuid;
-	uint32 BGEOCommandletProcessId;
-	// Keep track of the BGEO commandlet status
-	EHoudiniBGEOCommandletStatus BGEOCommandletStatus;
+	// The BGEO commandlet worker pool
+	TArray<FHoudiniBGEOCommandletWorker> BGEOCommandletWorkers;
+	// Imports waiting for a worker to become available
+	TArray<FHoudiniPDGImportBGEOMessage> QueuedBGEOImports;
+	// Number of imports completed by the workers, and the completion times of the recent ones (for throughput)
+	int32 NumCompletedBGEOImports = 0;
+	TArray<double> RecentBGEOImportCompletionTimes;
+	// Keep track of the aggregate BGEO commandlet status
+	EHoudiniBGEOCommandletStatus BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 };
\ No newline at end of file
@@ -78,8 +78,9 @@ FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
 
 	FHoudiniEngine::Get().CreateTaskSlateNotification(LOCTEXT("LoadPDGBGEO", "Loading PDG Output BGEO File..."));
 	
+	const double StartTime = FPlatformTime::Seconds();
 	bool bResult = false;
-	// Create a new file node in HAPI for the bgeo and cook it
+	// Load the bgeo in the importer's file node in HAPI and cook it
 	HAPI_NodeId FileNodeId = -1;
 	bResult = UHoudiniGeoImporter::OpenBGEOFile(InWorkResultObject.FilePath, FileNodeId);
 	if (bResult)
@@ -173,6 +174,10 @@ FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
 		FileNodeId = -1;
 	}
 
+	HOUDINI_PDG_MESSAGE(
+		TEXT("[FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem]: Imported %s in %.3f ms."),
+		*InWorkResultObject.FilePath, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
 	return bResult;
 }
 
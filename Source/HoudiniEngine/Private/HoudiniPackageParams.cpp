@@ -36,6 +36,176 @@
 #include "ObjectTools.h"
 #include "Engine/StaticMesh.h"
 #include "UObject/MetaData.h"
+#include "AssetRegistryModule.h"
+#include "Misc/ScopeLock.h"
+
+// Index of the package names used in each content folder.
+// A folder is indexed from the asset registry the first time a package is created in it,
+// and is then kept up to date with the packages we create and the registry's notifications.
+// Also remembers, for each base package name, the range of bake counters known to be used,
+// so that successive bakes don't have to walk through all the previous bake counters again.
+class FHoudiniPackageNameIndex
+{
+public:
+
+	static FHoudiniPackageNameIndex& Get()
+	{
+		static FHoudiniPackageNameIndex Instance;
+		return Instance;
+	}
+
+	// The index can't be trusted while the asset registry is still discovering assets
+	bool IsAvailable()
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		if (AssetRegistry.IsLoadingAssets())
+			return false;
+
+		FScopeLock ScopeLock(&Mutex);
+		if (!bRegistryDelegatesBound)
+		{
+			OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FHoudiniPackageNameIndex::OnAssetAdded);
+			OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FHoudiniPackageNameIndex::OnAssetRemoved);
+			OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FHoudiniPackageNameIndex::OnAssetRenamed);
+			bRegistryDelegatesBound = true;
+		}
+
+		return true;
+	}
+
+	bool IsPackageNameUsed(const FString& InPackageName)
+	{
+		FScopeLock ScopeLock(&Mutex);
+		return FindOrIndexFolder(FPackageName::GetLongPackagePath(InPackageName)).Contains(InPackageName);
+	}
+
+	void AddPackageName(const FString& InPackageName)
+	{
+		FScopeLock ScopeLock(&Mutex);
+		FindOrIndexFolder(FPackageName::GetLongPackagePath(InPackageName)).Add(InPackageName);
+	}
+
+	// Returns the first bake counter, starting at InCounterStart, that isn't known to be used for InBasePackageName
+	int32 GetBakeCounterStart(const FString& InBasePackageName, int32 InCounterStart)
+	{
+		FScopeLock ScopeLock(&Mutex);
+		const FBakeCounterRange* Range = UsedBakeCounters.Find(InBasePackageName);
+		if (Range && InCounterStart >= Range->Start)
+			return FMath::Max(InCounterStart, Range->End);
+
+		return InCounterStart;
+	}
+
+	// Records that all the bake counters in [InCounterStart, InCounterEnd) are used for InBasePackageName
+	void SetUsedBakeCounters(const FString& InBasePackageName, int32 InCounterStart, int32 InCounterEnd)
+	{
+		FScopeLock ScopeLock(&Mutex);
+		FBakeCounterRange& Range = UsedBakeCounters.FindOrAdd(InBasePackageName, { InCounterStart, InCounterEnd });
+		if (InCounterStart < Range.Start || InCounterStart > Range.End)
+			Range.Start = InCounterStart;
+		Range.End = InCounterEnd;
+	}
+
+	// Clears the index and stops listening to the asset registry, until the index is used again
+	void Reset()
+	{
+		FScopeLock ScopeLock(&Mutex);
+		PackageNamesPerFolder.Empty();
+		UsedBakeCounters.Empty();
+
+		if (bRegistryDelegatesBound)
+		{
+			// The asset registry might already have been unloaded on shutdown
+			FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+			if (AssetRegistryModule)
+			{
+				IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+				AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+				AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+				AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+			}
+			OnAssetAddedHandle.Reset();
+			OnAssetRemovedHandle.Reset();
+			OnAssetRenamedHandle.Reset();
+			bRegistryDelegatesBound = false;
+		}
+	}
+
+private:
+
+	// Must be called with the mutex locked
+	TSet<FString>& FindOrIndexFolder(const FString& InFolder)
+	{
+		if (TSet<FString>* Found = PackageNamesPerFolder.Find(InFolder))
+			return *Found;
+
+		TSet<FString>& PackageNames = PackageNamesPerFolder.Add(InFolder);
+
+		// Gather both the assets on disk and the ones that only exist in memory
+		TArray<FAssetData> AssetDatas;
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.GetAssetsByPath(FName(*InFolder), AssetDatas, false, false);
+		for (const FAssetData& AssetData : AssetDatas)
+			PackageNames.Add(AssetData.PackageName.ToString());
+
+		return PackageNames;
+	}
+
+	// A freed package name can be reused: forget the known bake counters of its base package name.
+	// Must be called with the mutex locked
+	void InvalidateBakeCounters(const FString& InPackageName)
+	{
+		// Counter 0 uses the base package name itself
+		UsedBakeCounters.Remove(InPackageName);
+
+		int32 SeparatorIdx = INDEX_NONE;
+		if (InPackageName.FindLastChar(TEXT('_'), SeparatorIdx) && InPackageName.RightChop(SeparatorIdx + 1).IsNumeric())
+			UsedBakeCounters.Remove(InPackageName.Left(SeparatorIdx));
+	}
+
+	void OnAssetAdded(const FAssetData& InAssetData)
+	{
+		FScopeLock ScopeLock(&Mutex);
+		if (TSet<FString>* PackageNames = PackageNamesPerFolder.Find(InAssetData.PackagePath.ToString()))
+			PackageNames->Add(InAssetData.PackageName.ToString());
+	}
+
+	void OnAssetRemoved(const FAssetData& InAssetData)
+	{
+		FScopeLock ScopeLock(&Mutex);
+		if (TSet<FString>* PackageNames = PackageNamesPerFolder.Find(InAssetData.PackagePath.ToString()))
+			PackageNames->Remove(InAssetData.PackageName.ToString());
+
+		InvalidateBakeCounters(InAssetData.PackageName.ToString());
+	}
+
+	void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+	{
+		const FString OldPackageName = FPackageName::ObjectPathToPackageName(InOldObjectPath);
+
+		FScopeLock ScopeLock(&Mutex);
+		if (TSet<FString>* OldPackageNames = PackageNamesPerFolder.Find(FPackageName::GetLongPackagePath(OldPackageName)))
+			OldPackageNames->Remove(OldPackageName);
+		if (TSet<FString>* PackageNames = PackageNamesPerFolder.Find(InAssetData.PackagePath.ToString()))
+			PackageNames->Add(InAssetData.PackageName.ToString());
+
+		InvalidateBakeCounters(OldPackageName);
+	}
+
+	struct FBakeCounterRange
+	{
+		int32 Start;
+		int32 End;
+	};
+
+	FCriticalSection Mutex;
+	TMap<FString, TSet<FString>> PackageNamesPerFolder;
+	TMap<FString, FBakeCounterRange> UsedBakeCounters;
+	bool bRegistryDelegatesBound = false;
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+};
 
 //
 FHoudiniPackageParams::FHoudiniPackageParams()
@@ -295,6 +465,17 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 	// Get the appropriate package path/name for this object
 	FString PackageName = GetPackageName();
 	FString PackagePath = GetPackagePath();
+
+	// When creating new assets, use the package name index instead of looking for each candidate on disk
+	FHoudiniPackageNameIndex& NameIndex = FHoudiniPackageNameIndex::Get();
+	const bool bUseNameIndex = ReplaceMode == EPackageReplaceMode::CreateNewAssets
+		&& NameIndex.IsAvailable();
+
+	// Skip the bake counters that we already know are used
+	const FString BasePackageName = UPackageTools::SanitizePackageName(PackagePath + TEXT("/") + PackageName);
+	if (bUseNameIndex && PackageMode == EPackageMode::Bake)
+		BakeCounter = NameIndex.GetBakeCounterStart(BasePackageName, InBakeCounterStart);
+	const int32 BakeCounterSearchStart = BakeCounter;
 	   
 	// Iterate until we find a suitable name for the package
 	UPackage * NewPackage = nullptr;
@@ -331,13 +512,17 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		if (ReplaceMode == EPackageReplaceMode::CreateNewAssets)
 		{
 			UPackage* FoundPackage = FindPackage(PackageOuter, *FinalPackageName);
+			bool bNameUsed = false;
 			if (FoundPackage == nullptr)
 			{
 				// Package might not be in memory, check if it exists on disk
-				FoundPackage = LoadPackage(nullptr, *FinalPackageName, LOAD_Verify | LOAD_NoWarn);
+				if (bUseNameIndex)
+					bNameUsed = NameIndex.IsPackageNameUsed(FinalPackageName);
+				else
+					FoundPackage = LoadPackage(nullptr, *FinalPackageName, LOAD_Verify | LOAD_NoWarn);
 			}
 			
-			if (FoundPackage && !FoundPackage->IsPendingKill())
+			if (bNameUsed || (FoundPackage && !FoundPackage->IsPendingKill()))
 			{
 				// we need to generate a new name for it
 				CurrentGuid = FGuid::NewGuid();
@@ -350,6 +535,13 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		NewPackage = CreatePackage(*FinalPackageName);
 		if (IsValid(NewPackage))
 		{
+			if (bUseNameIndex)
+			{
+				NameIndex.AddPackageName(FinalPackageName);
+				if (PackageMode == EPackageMode::Bake)
+					NameIndex.SetUsedBakeCounters(BasePackageName, BakeCounterSearchStart, BakeCounter + 1);
+			}
+
 			// Record bake counter / temp GUID in package metadata
 			UMetaData* MetaData = NewPackage->GetMetaData();
 			if (IsValid(MetaData))
@@ -375,6 +567,12 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 	return NewPackage;
 }
 
+void
+FHoudiniPackageParams::ResetPackageNameIndex()
+{
+	FHoudiniPackageNameIndex::Get().Reset();
+}
+
 
 // Fixes link error with the template function under
 void TemplateFixer()
@@ -96,6 +96,10 @@ public:
 	// Helper function to create a Package for a given object
 	UPackage* CreatePackageForObject(FString& OutPackageName, int32 InBakeCounterStart=0) const;
 
+	// Clears the index of existing package names used by CreatePackageForObject when creating new assets,
+	// and unbinds it from the asset registry (it is bound again the next time it is used)
+	static void ResetPackageNameIndex();
+
 	// Helper function to create an object and its package
 	template<typename T> T* CreateObjectAndPackage();
 
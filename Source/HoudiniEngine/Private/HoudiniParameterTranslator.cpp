@@ -387,6 +387,20 @@ FHoudiniParameterTranslator::BuildAllParameters(
 				FHoudiniEngine::Get().GetSession(), AssetLibraryId, TCHAR_TO_UTF8(*HoudiniAssetName), &ParmInfos[0], 0, ParmCount), false);
 	}
 
+	// Resolve the names, labels and help of all parameters at once
+	{
+		TArray<int32> ParmStringHandles;
+		ParmStringHandles.Reserve(ParmCount * 3);
+		for (const HAPI_ParmInfo& ParmInfo : ParmInfos)
+		{
+			ParmStringHandles.Add(ParmInfo.nameSH);
+			ParmStringHandles.Add(ParmInfo.labelSH);
+			if (ParmInfo.helpSH > 0)
+				ParmStringHandles.Add(ParmInfo.helpSH);
+		}
+		FHoudiniEngineString::PrefetchStrings(ParmStringHandles);
+	}
+
 	// Create a name lookup cache for the current parameters
 	// Use an array has in some cases, multiple parameters can have the same name!
 	TMap<FString, TArray<UHoudiniParameter*>> CurrentParametersByName;
@@ -30,10 +30,258 @@
 
 #include "HoudiniEnginePrivatePCH.h"
 #include "HAL/FileManager.h"
+#include "Misc/ScopeLock.h"
+
+// Caches shared by all the string resolvers:
+// - the token sets, so that resolvers created with the same tokens share them,
+// - the parsed strings (list of literals and tokens),
+// - the resolved strings, for each string and token set.
+class FHoudiniStringResolverCache
+{
+public:
+
+	static FHoudiniStringResolverCache& Get()
+	{
+		static FHoudiniStringResolverCache Instance;
+		return Instance;
+	}
+
+	// Returns the empty token set
+	const TSharedRef<const FHoudiniStringResolverTokens, ESPMode::ThreadSafe>& GetEmptyTokens() const { return EmptyTokens; }
+
+	// Returns a token set with the (sanitized) tokens, reusing an existing one with the same tokens if possible
+	TSharedRef<const FHoudiniStringResolverTokens, ESPMode::ThreadSafe> FindOrAddTokens(const TMap<FString, FString>& InTokens)
+	{
+		if (InTokens.Num() <= 0)
+			return EmptyTokens;
+
+		// Order independent, case sensitive hash of the tokens
+		uint32 Hash = 0;
+		for (const auto& Elem : InTokens)
+			Hash += HashCombine(GetTypeHash(Elem.Key), FCrc::StrCrc32(*Elem.Value));
+
+		FScopeLock ScopeLock(&CriticalSection);
+		for (const FSharedTokens& Shared : SharedTokens.FindOrAdd(Hash))
+		{
+			if (AreTokensEqual(Shared.SourceTokens, InTokens))
+				return Shared.Tokens.ToSharedRef();
+		}
+
+		if (NumSharedTokens >= MaxSharedTokens)
+		{
+			SharedTokens.Empty();
+			NumSharedTokens = 0;
+		}
+
+		FSharedTokens& Shared = SharedTokens.FindOrAdd(Hash).AddDefaulted_GetRef();
+		Shared.SourceTokens = InTokens;
+		TSharedRef<FHoudiniStringResolverTokens, ESPMode::ThreadSafe> NewTokens = CreateTokens();
+		for (const auto& Elem : InTokens)
+			NewTokens->Tokens.Add(Elem.Key, FHoudiniStringResolver::SanitizeTokenValue(Elem.Value));
+		Shared.Tokens = NewTokens;
+		NumSharedTokens++;
+
+		return NewTokens;
+	}
+
+	// Creates a new token set with a unique id
+	TSharedRef<FHoudiniStringResolverTokens, ESPMode::ThreadSafe> CreateTokens()
+	{
+		TSharedRef<FHoudiniStringResolverTokens, ESPMode::ThreadSafe> NewTokens = MakeShared<FHoudiniStringResolverTokens, ESPMode::ThreadSafe>();
+		NewTokens->Id = ++LastTokensId;
+		return NewTokens;
+	}
+
+	FString Resolve(const FString& InString, const FHoudiniStringResolverTokens& InTokens)
+	{
+		const FResolvedKey ResolvedKey(InString, InTokens.Id);
+		TSharedPtr<const FParsedString, ESPMode::ThreadSafe> Parsed;
+		{
+			FScopeLock ScopeLock(&CriticalSection);
+			if (const FString* Resolved = ResolvedStrings.Find(ResolvedKey))
+				return *Resolved;
+
+			const FResolvedKey ParsedKey(InString, 0);
+			if (const TSharedPtr<const FParsedString, ESPMode::ThreadSafe>* FoundParsed = ParsedStrings.Find(ParsedKey))
+			{
+				Parsed = *FoundParsed;
+			}
+			else
+			{
+				if (ParsedStrings.Num() >= MaxParsedStrings)
+					ParsedStrings.Empty();
+				Parsed = ParseString(InString);
+				ParsedStrings.Add(ParsedKey, Parsed);
+			}
+		}
+
+		FString Result;
+		if (Parsed->bUseFormat)
+		{
+			Result = FString::Format(*InString, InTokens.Tokens);
+		}
+		else
+		{
+			Result.Reserve(InString.Len());
+			for (const FParsedString::FSegment& Segment : Parsed->Segments)
+			{
+				if (!Segment.bIsToken)
+				{
+					Result.Append(Segment.Text);
+					continue;
+				}
+
+				// Unknown tokens are left as is, like FString::Format does
+				const FStringFormatArg* Token = InTokens.Tokens.Find(Segment.Text);
+				if (Token && Token->Type == FStringFormatArg::String)
+					Result.Append(Token->StringValue);
+				else
+					Result.Append(TEXT("{")).Append(Segment.Text).Append(TEXT("}"));
+			}
+		}
+
+		FScopeLock ScopeLock(&CriticalSection);
+		if (ResolvedStrings.Num() >= MaxResolvedStrings)
+			ResolvedStrings.Empty();
+		ResolvedStrings.Add(ResolvedKey, Result);
+
+		return Result;
+	}
+
+	void Reset()
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		SharedTokens.Empty();
+		NumSharedTokens = 0;
+		ParsedStrings.Empty();
+		ResolvedStrings.Empty();
+	}
+
+private:
+
+	FHoudiniStringResolverCache()
+		: EmptyTokens(MakeShared<FHoudiniStringResolverTokens, ESPMode::ThreadSafe>())
+	{
+	}
+
+	// A string split into literals and {token} names
+	struct FParsedString
+	{
+		struct FSegment
+		{
+			FString Text;
+			bool bIsToken = false;
+		};
+
+		TArray<FSegment> Segments;
+
+		// The string uses escaped braces, leave its resolution to FString::Format
+		bool bUseFormat = false;
+	};
+
+	// Key of the parsed/resolved strings. Unlike FString's, its comparison is case sensitive.
+	struct FResolvedKey
+	{
+		FResolvedKey() : TokensId(0) {}
+		FResolvedKey(const FString& InString, uint64 InTokensId) : String(InString), TokensId(InTokensId) {}
+
+		bool operator==(const FResolvedKey& InOther) const
+		{
+			return TokensId == InOther.TokensId && String.Equals(InOther.String, ESearchCase::CaseSensitive);
+		}
+
+		friend uint32 GetTypeHash(const FResolvedKey& InKey)
+		{
+			return HashCombine(FCrc::StrCrc32(*InKey.String), GetTypeHash(InKey.TokensId));
+		}
+
+		FString String;
+		uint64 TokensId;
+	};
+
+	struct FSharedTokens
+	{
+		TMap<FString, FString> SourceTokens;
+		TSharedPtr<const FHoudiniStringResolverTokens, ESPMode::ThreadSafe> Tokens;
+	};
+
+	static bool AreTokensEqual(const TMap<FString, FString>& InA, const TMap<FString, FString>& InB)
+	{
+		if (InA.Num() != InB.Num())
+			return false;
+
+		for (const auto& Elem : InA)
+		{
+			const FString* Value = InB.Find(Elem.Key);
+			if (!Value || !Value->Equals(Elem.Value, ESearchCase::CaseSensitive))
+				return false;
+		}
+
+		return true;
+	}
+
+	static TSharedPtr<const FParsedString, ESPMode::ThreadSafe> ParseString(const FString& InString)
+	{
+		TSharedPtr<FParsedString, ESPMode::ThreadSafe> Parsed = MakeShared<FParsedString, ESPMode::ThreadSafe>();
+
+		// FString::Format uses ` to escape braces
+		int32 EscapeIndex = INDEX_NONE;
+		if (InString.FindChar(TEXT('`'), EscapeIndex))
+		{
+			Parsed->bUseFormat = true;
+			return Parsed;
+		}
+
+		int32 Start = 0;
+		while (Start < InString.Len())
+		{
+			const int32 OpenIndex = InString.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+			const int32 CloseIndex = OpenIndex != INDEX_NONE
+				? InString.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, OpenIndex + 1)
+				: INDEX_NONE;
+			if (CloseIndex == INDEX_NONE)
+			{
+				// No more tokens
+				Parsed->Segments.Add({ InString.Mid(Start), false });
+				break;
+			}
+
+			if (OpenIndex > Start)
+				Parsed->Segments.Add({ InString.Mid(Start, OpenIndex - Start), false });
+			Parsed->Segments.Add({ InString.Mid(OpenIndex + 1, CloseIndex - OpenIndex - 1), true });
+			Start = CloseIndex + 1;
+		}
+
+		return Parsed;
+	}
+
+	static const int32 MaxSharedTokens = 4096;
+	static const int32 MaxParsedStrings = 4096;
+	static const int32 MaxResolvedStrings = 65536;
+
+	TSharedRef<const FHoudiniStringResolverTokens, ESPMode::ThreadSafe> EmptyTokens;
+
+	FCriticalSection CriticalSection;
+	TMap<uint32, TArray<FSharedTokens>> SharedTokens;
+	int32 NumSharedTokens = 0;
+	TMap<FResolvedKey, TSharedPtr<const FParsedString, ESPMode::ThreadSafe>> ParsedStrings;
+	TMap<FResolvedKey, FString> ResolvedStrings;
+	TAtomic<uint64> LastTokensId { 0 };
+};
+
+const TMap<FString, FStringFormatArg>& FHoudiniStringResolver::GetCachedTokens() const
+{
+	return CachedTokens.IsValid() ? CachedTokens->Tokens : FHoudiniStringResolverCache::Get().GetEmptyTokens()->Tokens;
+}
+
+void FHoudiniStringResolver::ResetCaches()
+{
+	FHoudiniStringResolverCache::Get().Reset();
+}
 
 void FHoudiniStringResolver::GetTokensAsStringMap(TMap<FString,FString>& OutTokens) const
 {
-	for (auto& Elem : CachedTokens)
+	for (auto& Elem : GetCachedTokens())
 	{
 		OutTokens.Add(Elem.Key, Elem.Value.StringValue);
 	}
@@ -51,20 +299,35 @@ FString FHoudiniStringResolver::SanitizeTokenValue(const FString& InValue)
 
 void FHoudiniStringResolver::SetToken(const FString& InName, const FString& InValue)
 {
-	CachedTokens.Add(InName, SanitizeTokenValue(InValue));
+	const FString SanitizedValue = SanitizeTokenValue(InValue);
+	const FStringFormatArg* CurrentValue = GetCachedTokens().Find(InName);
+	if (CurrentValue && CurrentValue->Type == FStringFormatArg::String
+		&& CurrentValue->StringValue.Equals(SanitizedValue, ESearchCase::CaseSensitive))
+		return;
+
+	// Copy the shared token set before modifying it
+	TSharedRef<FHoudiniStringResolverTokens, ESPMode::ThreadSafe> NewTokens = FHoudiniStringResolverCache::Get().CreateTokens();
+	NewTokens->Tokens = GetCachedTokens();
+	NewTokens->Tokens.Add(InName, SanitizedValue);
+	CachedTokens = NewTokens;
 }
 
 void FHoudiniStringResolver::SetTokensFromStringMap(const TMap<FString, FString>& InTokens, bool bClearTokens)
 {
-	if (bClearTokens)
+	if (bClearTokens || GetCachedTokens().Num() <= 0)
 	{
-		CachedTokens.Empty();
+		// Share the token set with the other resolvers using the same tokens
+		CachedTokens = FHoudiniStringResolverCache::Get().FindOrAddTokens(InTokens);
+		return;
 	}
 
+	TSharedRef<FHoudiniStringResolverTokens, ESPMode::ThreadSafe> NewTokens = FHoudiniStringResolverCache::Get().CreateTokens();
+	NewTokens->Tokens = GetCachedTokens();
 	for (auto& Elem : InTokens)
 	{
-		CachedTokens.Add(Elem.Key, SanitizeTokenValue(Elem.Value));
+		NewTokens->Tokens.Add(Elem.Key, SanitizeTokenValue(Elem.Value));
 	}
+	CachedTokens = NewTokens;
 }
 
 
@@ -72,8 +335,8 @@ void FHoudiniStringResolver::SetTokensFromStringMap(const TMap<FString, FString>
 FString FHoudiniStringResolver::ResolveString(
 	const FString& InString) const
 {
-	const FString Result = FString::Format(*InString, CachedTokens);
-	return Result;
+	const FHoudiniStringResolverTokens& Tokens = CachedTokens.IsValid() ? *CachedTokens : *FHoudiniStringResolverCache::Get().GetEmptyTokens();
+	return FHoudiniStringResolverCache::Get().Resolve(InString, Tokens);
 }
 
 //void FHoudiniStringResolver::SetCurrentWorld(UWorld* InWorld)
@@ -139,7 +402,7 @@ FString FHoudiniAttributeResolver::ResolveFullLevelPath() const
 {
 	FString OutputFolder = TEXT("/Game/Content/HoudiniEngine/Temp");
 
-	const FStringFormatArg* BaseDir = CachedTokens.Find(TEXT("out_basedir"));
+	const FStringFormatArg* BaseDir = GetCachedTokens().Find(TEXT("out_basedir"));
 	if (BaseDir)
 		OutputFolder = BaseDir->StringValue;
 
@@ -210,7 +473,7 @@ void FHoudiniAttributeResolver::LogCachedAttributesAndTokens() const
 	Lines.Add(TEXT("=============="));
 	Lines.Add(TEXT("Cached Tokens:"));
 	Lines.Add(TEXT("=============="));
-	for (const auto& Entry : CachedTokens)
+	for (const auto& Entry : GetCachedTokens())
 	{
 		Lines.Add(FString::Printf(TEXT("%s: %s"), *(Entry.Key), *(Entry.Value.StringValue)));
 	}
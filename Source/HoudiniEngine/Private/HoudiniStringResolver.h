@@ -30,6 +30,16 @@
 
 #include "HoudiniStringResolver.generated.h"
 
+// An immutable set of sanitized tokens.
+// Resolvers created with the same tokens (ie, for all the output objects of a part) share the same token set.
+struct HOUDINIENGINE_API FHoudiniStringResolverTokens
+{
+	TMap<FString, FStringFormatArg> Tokens;
+
+	// Unique id of this token set, used to cache the strings resolved with it
+	uint64 Id = 0;
+};
+
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniStringResolver
 {
@@ -39,7 +49,8 @@ struct HOUDINIENGINE_API FHoudiniStringResolver
 protected:
 
 	// Named arguments that will be substituted into attribute values upon retrieval.
-	TMap<FString, FStringFormatArg> CachedTokens;
+	// Copy on write: the token set can be shared with other resolvers.
+	TSharedPtr<const FHoudiniStringResolverTokens, ESPMode::ThreadSafe> CachedTokens;
 
 
 public:
@@ -47,7 +58,7 @@ public:
 	// Named argument accessors
 	// ----------------------------------
 
-	TMap<FString, FStringFormatArg>& GetCachedTokens() { return CachedTokens; }
+	const TMap<FString, FStringFormatArg>& GetCachedTokens() const;
 
 
 	// Set a named argument that will be used for argument replacement during GetAttribute calls.
@@ -61,8 +72,12 @@ public:
 	void SetTokensFromStringMap(const TMap<FString, FString>& InValue, bool bClearTokens=true);
 
 	// Resolve a string by substituting `Tokens` as named arguments during string formatting.
+	// Strings are parsed once into literals and tokens, and resolved strings are cached per token set.
 	FString ResolveString(const FString& InStr) const;
 
+	// Empty the parsed strings, resolved strings and shared token sets caches.
+	static void ResetCaches();
+
 };
 
 
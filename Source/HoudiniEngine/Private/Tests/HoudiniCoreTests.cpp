@@ -1,5 +1,29 @@
-﻿#include "../HoudiniEngine.h"
+﻿#include "HoudiniCoreTests.h"
+#include "../HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniLegacyConversionCommandlet.h"
+#include "HoudiniMaterialTranslator.h"
+#include "HoudiniMeshTranslator.h"
+#include "HoudiniOutput.h"
+#include "HoudiniPackageParams.h"
+#include "HoudiniPDGManager.h"
+#include "HoudiniPluginSerializationVersion.h"
+#include "HoudiniStringResolver.h"
+#include "UnrealLandscapeTranslator.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "InstancedFoliageActor.h"
+#include "FoliageType.h"
+#include "ImageUtils.h"
 #include "Misc/AutomationTest.h"
+#include "PackageTools.h"
+#include "Serialization/CustomVersion.h"
+#include "UObject/PackageFileSummary.h"
+#include "UObject/UObjectHash.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -10,4 +34,624 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniPackageNameIndexBenchmark, "Houdini.Core.PackageNameIndexBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniPackageNameIndexBenchmark::RunTest(const FString & Parameters)
+{
+	// Bake NumOutputs outputs in a folder that already contains NumPriorBakes bakes of each of them
+	const int32 NumPriorBakes = 50;
+	const int32 NumOutputs = 20;
+
+	// The baseline looks for each candidate package in memory and on disk, like CreatePackageForObject did before the index
+	auto CreatePackageWithoutIndex = [](const FHoudiniPackageParams& InPackageParams)
+	{
+		const FString PackageName = InPackageParams.GetPackageName();
+		const FString PackagePath = InPackageParams.GetPackagePath();
+		for (int32 BakeCounter = 0; ; BakeCounter++)
+		{
+			FString FinalPackageName = PackagePath + TEXT("/") + PackageName;
+			if (BakeCounter > 0)
+				FinalPackageName += TEXT("_") + FString::FromInt(BakeCounter);
+			FinalPackageName = UPackageTools::SanitizePackageName(FinalPackageName);
+
+			UPackage* FoundPackage = FindPackage(nullptr, *FinalPackageName);
+			if (!FoundPackage)
+				FoundPackage = LoadPackage(nullptr, *FinalPackageName, LOAD_Verify | LOAD_NoWarn);
+
+			if (!FoundPackage || FoundPackage->IsPendingKill())
+				return CreatePackage(*FinalPackageName);
+		}
+	};
+
+	const bool bSuccess = FHoudiniBenchmarkTestUtils::RunBenchmarkPasses(
+		this, nullptr,
+		FString::Printf(TEXT("Package name index (%d outputs over %d prior bakes)"), NumOutputs, NumPriorBakes),
+		[&](bool bUseIndex)
+		{
+			FHoudiniPackageParams::ResetPackageNameIndex();
+
+			FHoudiniPackageParams PackageParams;
+			PackageParams.PackageMode = EPackageMode::Bake;
+			PackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+			PackageParams.BakeFolder = FString::Printf(TEXT("/Temp/HoudiniEngine/PackageNameIndexBenchmark_%d"), bUseIndex ? 1 : 0);
+
+			TArray<UPackage*> Packages;
+			TSet<FString> PackageNames;
+			double BakeTime = 0.0;
+			for (int32 Bake = 0; Bake <= NumPriorBakes; Bake++)
+			{
+				// Only the last bake is timed
+				const double BakeStartTime = FPlatformTime::Seconds();
+				for (int32 Output = 0; Output < NumOutputs; Output++)
+				{
+					PackageParams.ObjectName = FString::Printf(TEXT("Output_%d"), Output);
+					FString PackageName;
+					UPackage* Package = bUseIndex
+						? PackageParams.CreatePackageForObject(PackageName)
+						: CreatePackageWithoutIndex(PackageParams);
+					if (!TestNotNull(TEXT("Created package"), Package))
+						break;
+
+					TestFalse(TEXT("Package name is unique"), PackageNames.Contains(Package->GetName()));
+					PackageNames.Add(Package->GetName());
+					Packages.Add(Package);
+				}
+				BakeTime = FPlatformTime::Seconds() - BakeStartTime;
+			}
+
+			for (UPackage* Package : Packages)
+			{
+				Package->ClearFlags(RF_Standalone);
+				Package->MarkPendingKill();
+			}
+
+			return BakeTime;
+		});
+
+	FHoudiniPackageParams::ResetPackageNameIndex();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return bSuccess;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniStringResolverBenchmark, "Houdini.Core.StringResolverBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniStringResolverBenchmark::RunTest(const FString & Parameters)
+{
+	// Resolve the bake paths of NumOutputObjects output objects, split over NumParts parts
+	const int32 NumOutputObjects = 100000;
+	const int32 NumParts = 100;
+	const int32 NumResultsPerObject = 4;
+
+	// Tokens and attributes shared by the output objects of each part
+	TArray<TMap<FString, FString>> PartTokens;
+	TArray<TMap<FString, FString>> PartAttributes;
+	for (int32 Part = 0; Part < NumParts; Part++)
+	{
+		TMap<FString, FString>& Tokens = PartTokens.AddDefaulted_GetRef();
+		Tokens.Add(TEXT("temp"), TEXT("/Game/HoudiniEngine/Temp"));
+		Tokens.Add(TEXT("bake"), TEXT("/Game/HoudiniEngine/Bake"));
+		Tokens.Add(TEXT("out_basedir"), TEXT("/Game/HoudiniEngine/Bake"));
+		Tokens.Add(TEXT("out"), TEXT("/Game/HoudiniEngine/Bake/Asset"));
+		Tokens.Add(TEXT("hda_name"), TEXT("Asset"));
+		Tokens.Add(TEXT("geo"), FString::Printf(TEXT("%d"), Part / 10));
+		Tokens.Add(TEXT("part"), FString::Printf(TEXT("%d"), Part));
+
+		TMap<FString, FString>& Attributes = PartAttributes.AddDefaulted_GetRef();
+		Attributes.Add(TEXT("unreal_bake_folder"), TEXT("{bake}/{hda_name}/geo_{geo}"));
+		Attributes.Add(TEXT("unreal_level_path"), TEXT("{out}/Level_{geo}"));
+		Attributes.Add(TEXT("unreal_bake_actor"), TEXT("{hda_name}_{geo}_{part}"));
+	}
+
+	// The baseline formats each string with FString::Format, the resolver's results must be identical
+	TArray<FString> ReferenceResults;
+	int32 NumMismatches = 0;
+	const bool bSuccess = FHoudiniBenchmarkTestUtils::RunBenchmarkPasses(
+		this, nullptr,
+		FString::Printf(TEXT("Memoized string resolver (%d output objects)"), NumOutputObjects),
+		[&](bool bMemoize)
+		{
+			FHoudiniStringResolver::ResetCaches();
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumOutputObjects; Index++)
+			{
+				const int32 Part = Index % NumParts;
+
+				FHoudiniAttributeResolver Resolver;
+				Resolver.SetCachedAttributes(PartAttributes[Part]);
+				Resolver.SetTokensFromStringMap(PartTokens[Part]);
+
+				const FString Strings[NumResultsPerObject] = {
+					PartAttributes[Part].FindChecked(TEXT("unreal_bake_folder")),
+					PartAttributes[Part].FindChecked(TEXT("unreal_level_path")),
+					PartAttributes[Part].FindChecked(TEXT("unreal_bake_actor")),
+					FString::Printf(TEXT("{bake}/Mesh_%d"), Index % 1000)
+				};
+
+				for (int32 ResultIndex = 0; ResultIndex < NumResultsPerObject; ResultIndex++)
+				{
+					if (!bMemoize)
+						ReferenceResults.Add(FString::Format(*Strings[ResultIndex], Resolver.GetCachedTokens()));
+					else if (!Resolver.ResolveString(Strings[ResultIndex]).Equals(ReferenceResults[Index * NumResultsPerObject + ResultIndex], ESearchCase::CaseSensitive))
+						NumMismatches++;
+				}
+			}
+
+			return FPlatformTime::Seconds() - StartTime;
+		});
+
+	TestEqual(TEXT("Strings resolved differently from FString::Format"), NumMismatches, 0);
+	FHoudiniStringResolver::ResetCaches();
+
+	return bSuccess;
+}
+
+
+// Adds the instances of a synthetic 1M points instancer to the foliage, one by one and in bulk.
+// Can be run headless with:
+// UE4Editor-Cmd <Project> -ExecCmds="Automation RunTests Houdini.Core.BulkFoliageInsertionBenchmark;Quit" -unattended -nullrhi
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniBulkFoliageInsertionBenchmark, "Houdini.Core.BulkFoliageInsertionBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniBulkFoliageInsertionBenchmark::RunTest(const FString & Parameters)
+{
+	const int32 NumInstances = 1000000;
+	const int32 GridSize = 1000;
+
+	UStaticMesh* StaticMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube static mesh"), StaticMesh))
+		return false;
+
+	// The synthetic instancer: a grid of randomly rotated and scaled instances
+	FRandomStream RandomStream(0);
+	TArray<FFoliageInstance> FoliageInstances;
+	FoliageInstances.SetNum(NumInstances);
+	for (int32 Index = 0; Index < NumInstances; Index++)
+	{
+		FFoliageInstance& FoliageInstance = FoliageInstances[Index];
+		FoliageInstance.Location = FVector((Index % GridSize) * 100.0f, (Index / GridSize) * 100.0f, 0.0f);
+		FoliageInstance.Rotation = FRotator(0.0f, RandomStream.FRandRange(0.0f, 360.0f), 0.0f);
+		FoliageInstance.DrawScale3D = FVector(RandomStream.FRandRange(0.5f, 1.5f));
+	}
+
+	// The baseline adds the instances one by one, both must produce the same foliage instances
+	const bool bSuccess = FHoudiniBenchmarkTestUtils::RunBenchmarkPasses(
+		this, nullptr,
+		FString::Printf(TEXT("Bulk foliage insertion (%d instances)"), NumInstances),
+		[&](bool bBulk)
+		{
+			UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+			if (!TestNotNull(TEXT("Test world"), World))
+				return 0.0;
+
+			AInstancedFoliageActor* InstancedFoliageActor = AInstancedFoliageActor::GetInstancedFoliageActorForLevel(World->PersistentLevel, true);
+			UFoliageType* FoliageType = nullptr;
+			InstancedFoliageActor->AddMesh(StaticMesh, &FoliageType);
+			FFoliageInfo* FoliageInfo = InstancedFoliageActor->FindOrAddMesh(FoliageType);
+
+			const double StartTime = FPlatformTime::Seconds();
+			if (bBulk)
+			{
+				FHoudiniEngineUtils::AddFoliageInstances(InstancedFoliageActor, FoliageType, FoliageInfo, FoliageInstances);
+			}
+			else
+			{
+				for (const FFoliageInstance& FoliageInstance : FoliageInstances)
+					FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
+			}
+			if (FoliageInfo->GetComponent())
+				FoliageInfo->GetComponent()->BuildTreeIfOutdated(false, true);
+			const double AddTime = FPlatformTime::Seconds() - StartTime;
+
+			int32 NumMismatches = 0;
+			if (TestEqual(TEXT("Number of foliage instances"), FoliageInfo->Instances.Num(), NumInstances))
+			{
+				for (int32 Index = 0; Index < NumInstances; Index++)
+				{
+					const FFoliageInstance& Added = FoliageInfo->Instances[Index];
+					const FFoliageInstance& Source = FoliageInstances[Index];
+					if (!Added.Location.Equals(Source.Location) || !Added.Rotation.Equals(Source.Rotation) || !Added.DrawScale3D.Equals(Source.DrawScale3D))
+						NumMismatches++;
+				}
+			}
+			TestEqual(TEXT("Foliage instances that differ from the instancer"), NumMismatches, 0);
+
+			World->DestroyWorld(false);
+			World->RemoveFromRoot();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+			return AddTime;
+		});
+
+	return bSuccess;
+}
+
+// Checks which heightfield rows are sent again when some landscape components are modified.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniLandscapeModifiedRowsTest, "Houdini.Core.LandscapeModifiedRows", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniLandscapeModifiedRowsTest::RunTest(const FString & Parameters)
+{
+	// Three components of 4 quads along X: 13 rows, the rows shared by two components belong to both
+	const int32 ComponentSizeQuads = 4;
+	const int32 XSize = 3 * ComponentSizeQuads + 1;
+	TMap<FIntPoint, uint32> PreviousFingerprints;
+	PreviousFingerprints.Add(FIntPoint(0, 0), 1);
+	PreviousFingerprints.Add(FIntPoint(1, 0), 2);
+	PreviousFingerprints.Add(FIntPoint(2, 0), 3);
+
+	TArray<bool> ModifiedRows;
+	TestFalse(TEXT("Unchanged components are not modified"), FUnrealLandscapeTranslator::GetModifiedHeightfieldRows(
+		PreviousFingerprints, PreviousFingerprints, 0, XSize, ComponentSizeQuads, ModifiedRows));
+	TestEqual(TEXT("One flag per row"), ModifiedRows.Num(), XSize);
+	TestFalse(TEXT("No modified rows"), ModifiedRows.Contains(true));
+
+	TMap<FIntPoint, uint32> NewFingerprints = PreviousFingerprints;
+	NewFingerprints[FIntPoint(1, 0)] = 20;
+	TestTrue(TEXT("Modified component"), FUnrealLandscapeTranslator::GetModifiedHeightfieldRows(
+		PreviousFingerprints, NewFingerprints, 0, XSize, ComponentSizeQuads, ModifiedRows));
+	for (int32 RowIdx = 0; RowIdx < XSize; RowIdx++)
+		TestEqual(FString::Printf(TEXT("Row %d modified"), RowIdx), ModifiedRows[RowIdx], RowIdx >= 4 && RowIdx <= 8);
+
+	// Offset extents only cover part of the first component
+	TestTrue(TEXT("Modified first component"), FUnrealLandscapeTranslator::GetModifiedHeightfieldRows(
+		TMap<FIntPoint, uint32>(), PreviousFingerprints, 2, XSize - 2, ComponentSizeQuads, ModifiedRows));
+	TestFalse(TEXT("New components are modified"), ModifiedRows.Contains(false));
+
+	auto GetRuns = [](const TArray<bool>& InModifiedRows)
+	{
+		TArray<FIntPoint> RowRuns;
+		FUnrealLandscapeTranslator::GetHeightfieldRowRuns(InModifiedRows, RowRuns);
+		return RowRuns;
+	};
+
+	TestEqual(TEXT("No runs"), GetRuns({ false, false, false }).Num(), 0);
+	TestTrue(TEXT("Consecutive rows"), GetRuns({ true, true, false, true, true }) == TArray<FIntPoint>({ FIntPoint(0, 1), FIntPoint(3, 4) }));
+	TestTrue(TEXT("Single row extended forward"), GetRuns({ false, true, false, false }) == TArray<FIntPoint>({ FIntPoint(1, 2) }));
+	TestTrue(TEXT("Last single row extended backward"), GetRuns({ false, false, true }) == TArray<FIntPoint>({ FIntPoint(1, 2) }));
+	TestTrue(TEXT("Single row heightfield stays in range"), GetRuns({ true }) == TArray<FIntPoint>({ FIntPoint(0, 0) }));
+
+	return true;
+}
+// Checks how queued BGEO imports are balanced over the commandlet workers, and the aggregate status of the pool.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniBGEOCommandletPoolTest, "Houdini.Core.BGEOCommandletPool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniBGEOCommandletPoolTest::RunTest(const FString & Parameters)
+{
+	TArray<FHoudiniBGEOCommandletWorker> Workers;
+	TestEqual(TEXT("Empty pool is not started"), FHoudiniPDGManager::GetBGEOCommandletPoolStatus(Workers), EHoudiniBGEOCommandletStatus::NotStarted);
+	TestEqual(TEXT("No worker in an empty pool"), FHoudiniPDGManager::FindLeastLoadedBGEOCommandletWorker(Workers, 2), (int32)INDEX_NONE);
+
+	Workers.SetNum(3);
+	Workers[0].Status = EHoudiniBGEOCommandletStatus::Crashed;
+	TestEqual(TEXT("Crashed pool"), FHoudiniPDGManager::GetBGEOCommandletPoolStatus(Workers), EHoudiniBGEOCommandletStatus::Crashed);
+	Workers[1].Status = EHoudiniBGEOCommandletStatus::Running;
+	TestEqual(TEXT("Running pool"), FHoudiniPDGManager::GetBGEOCommandletPoolStatus(Workers), EHoudiniBGEOCommandletStatus::Running);
+	TestEqual(TEXT("Workers that are not connected don't get imports"), FHoudiniPDGManager::FindLeastLoadedBGEOCommandletWorker(Workers, 2), (int32)INDEX_NONE);
+	Workers[1].Status = EHoudiniBGEOCommandletStatus::Connected;
+	Workers[2].Status = EHoudiniBGEOCommandletStatus::Connected;
+	TestEqual(TEXT("Connected pool"), FHoudiniPDGManager::GetBGEOCommandletPoolStatus(Workers), EHoudiniBGEOCommandletStatus::Connected);
+
+	// Dispatch imports like DispatchQueuedBGEOImports: they alternate between the two connected workers until both are full
+	const int32 MaxImportsPerWorker = 2;
+	TArray<int32> DispatchedWorkers;
+	for (int32 ImportIdx = 0; ImportIdx < 6; ++ImportIdx)
+	{
+		const int32 WorkerIdx = FHoudiniPDGManager::FindLeastLoadedBGEOCommandletWorker(Workers, MaxImportsPerWorker);
+		if (WorkerIdx == INDEX_NONE)
+			break;
+
+		FHoudiniPDGImportBGEOMessage Import;
+		Import.WorkItemId = ImportIdx;
+		Workers[WorkerIdx].InFlightImports.Add(Import);
+		DispatchedWorkers.Add(WorkerIdx);
+	}
+	TestTrue(TEXT("Imports are balanced over the connected workers"), DispatchedWorkers == TArray<int32>({ 1, 2, 1, 2 }));
+	TestEqual(TEXT("Crashed worker has no imports"), Workers[0].InFlightImports.Num(), 0);
+
+	// A completed import frees its worker
+	Workers[2].InFlightImports.RemoveAt(0);
+	TestEqual(TEXT("Worker with a completed import gets the next one"), FHoudiniPDGManager::FindLeastLoadedBGEOCommandletWorker(Workers, MaxImportsPerWorker), 2);
+
+	return true;
+}
+
+// Checks that partitioning the faces between more split groups than fit in a single pass
+// gives each group the same faces and vertices as looking at each group on its own.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniMeshSplitPartitionTest, "Houdini.Core.MeshSplitPartition", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniMeshSplitPartitionTest::RunTest(const FString & Parameters)
+{
+	const int32 NumSplits = 70;
+	const int32 FaceCount = 10;
+	TArray<int32> PartVertexList;
+	for (int32 VertexIdx = 0; VertexIdx < FaceCount * 3; VertexIdx++)
+		PartVertexList.Add(1000 + VertexIdx);
+
+	// Group 5 contains all the faces, 6 none of them (both sent as a single value), 67 is empty and 68 can't be fetched
+	auto IsFaceInGroup = [](const int32& InSplitIdx, const int32& InFaceIdx)
+	{
+		if (InSplitIdx == 5)
+			return true;
+		if (InSplitIdx == 6 || InSplitIdx == 67 || InSplitIdx == 68)
+			return false;
+		return (InFaceIdx + InSplitIdx) % 3 == 0 || InSplitIdx % 11 == InFaceIdx;
+	};
+
+	TArray<FHoudiniMeshSplit> Splits;
+	TArray<bool> FaceInAnyGroup;
+	FHoudiniMeshTranslator::PartitionFacesIntoSplits(
+		NumSplits, FaceCount, PartVertexList,
+		[&](const int32& InSplitIdx, TArray<int32>& OutGroupMembership, bool& bOutAllEquals)
+		{
+			if (InSplitIdx == 68)
+				return false;
+
+			bOutAllEquals = InSplitIdx == 5 || InSplitIdx == 6;
+			OutGroupMembership.SetNum(bOutAllEquals ? 1 : FaceCount);
+			for (int32 FaceIdx = 0; FaceIdx < OutGroupMembership.Num(); FaceIdx++)
+				OutGroupMembership[FaceIdx] = IsFaceInGroup(InSplitIdx, FaceIdx) ? 1 : 0;
+			return true;
+		},
+		Splits, FaceInAnyGroup);
+
+	if (!TestEqual(TEXT("One split per group"), Splits.Num(), NumSplits))
+		return false;
+
+	for (int32 SplitIdx = 0; SplitIdx < NumSplits; SplitIdx++)
+	{
+		TArray<int32> ExpectedFaceIndices;
+		TArray<int32> ExpectedVertexList;
+		for (int32 FaceIdx = 0; FaceIdx < FaceCount; FaceIdx++)
+		{
+			if (IsFaceInGroup(SplitIdx, FaceIdx))
+				ExpectedFaceIndices.Add(FaceIdx);
+		}
+		if (ExpectedFaceIndices.Num() > 0)
+		{
+			ExpectedVertexList.Init(-1, PartVertexList.Num());
+			for (const int32 FaceIdx : ExpectedFaceIndices)
+			{
+				for (int32 VertexIdx = FaceIdx * 3; VertexIdx < FaceIdx * 3 + 3; VertexIdx++)
+					ExpectedVertexList[VertexIdx] = PartVertexList[VertexIdx];
+			}
+		}
+
+		const FHoudiniMeshSplit& Split = Splits[SplitIdx];
+		TestTrue(FString::Printf(TEXT("Split %d faces"), SplitIdx), Split.FaceIndices == ExpectedFaceIndices);
+		TestTrue(FString::Printf(TEXT("Split %d vertices"), SplitIdx), Split.VertexList == ExpectedVertexList);
+		TestEqual(FString::Printf(TEXT("Split %d vertex count"), SplitIdx), Split.VertexCount, ExpectedFaceIndices.Num() * 3);
+		if (ExpectedFaceIndices.Num() > 0)
+		{
+			TestEqual(FString::Printf(TEXT("Split %d first prim"), SplitIdx), Split.FirstValidPrimIndex, ExpectedFaceIndices[0]);
+			TestEqual(FString::Printf(TEXT("Split %d first vertex"), SplitIdx), Split.FirstValidVertexIndex, ExpectedFaceIndices[0] * 3);
+		}
+	}
+
+	// Group 5 contains all the faces
+	TestEqual(TEXT("One flag per face"), FaceInAnyGroup.Num(), FaceCount);
+	TestFalse(TEXT("All faces are in a group"), FaceInAnyGroup.Contains(false));
+
+	// Without any group containing the faces, none are flagged
+	FHoudiniMeshTranslator::PartitionFacesIntoSplits(
+		2, FaceCount, PartVertexList,
+		[&](const int32& InSplitIdx, TArray<int32>& OutGroupMembership, bool& bOutAllEquals)
+		{
+			bOutAllEquals = true;
+			OutGroupMembership.Init(0, 1);
+			return true;
+		},
+		Splits, FaceInAnyGroup);
+	TestEqual(TEXT("Empty splits"), Splits[0].VertexCount + Splits[1].VertexCount, 0);
+	TestFalse(TEXT("No face is in a group"), FaceInAnyGroup.Contains(true));
+
+	return true;
+}
+
+// Checks that textures created from extracted images are converted to BGRA, and that updating an existing
+// texture with the same image is skipped while a different image still updates it.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniTextureUpdateTest, "Houdini.Core.TextureUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniTextureUpdateTest::RunTest(const FString & Parameters)
+{
+	// A 2x2 RGB image, Houdini's rows are stored bottom to top
+	HAPI_ImageInfo ImageInfo;
+	FMemory::Memzero(ImageInfo);
+	ImageInfo.xRes = 2;
+	ImageInfo.yRes = 2;
+	ImageInfo.packing = HAPI_IMAGE_PACKING_RGB;
+	TArray<char> ImageBuffer;
+	for (int32 Value = 10; Value <= 120; Value += 10)
+		ImageBuffer.Add((char)Value);
+
+	FCreateTexture2DParameters TextureParameters;
+	TextureParameters.bUseAlpha = false;
+
+	const FString Hash = FHoudiniMaterialTranslator::ComputeImageHash(ImageInfo, ImageBuffer, TextureParameters);
+	TestEqual(TEXT("Same image has the same hash"), FHoudiniMaterialTranslator::ComputeImageHash(ImageInfo, ImageBuffer, TextureParameters), Hash);
+	FCreateTexture2DParameters AlphaTextureParameters = TextureParameters;
+	AlphaTextureParameters.bUseAlpha = true;
+	TestNotEqual(TEXT("Texture parameters change the hash"), FHoudiniMaterialTranslator::ComputeImageHash(ImageInfo, ImageBuffer, AlphaTextureParameters), Hash);
+
+	UPackage* Package = CreatePackage(TEXT("/Game/HoudiniEngineTests/TextureUpdate/Texture"));
+	auto CreateTexture = [&](UTexture2D* InExistingTexture, const TArray<char>& InImageBuffer, bool& bOutTextureUpdated)
+	{
+		return FHoudiniMaterialTranslator::CreateUnrealTexture(
+			InExistingTexture, ImageInfo, Package, TEXT("Texture"), InImageBuffer, TextureParameters,
+			TEXTUREGROUP_World, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE, TEXT("/obj/test"), bOutTextureUpdated);
+	};
+
+	bool bTextureUpdated = false;
+	UTexture2D* Texture = CreateTexture(nullptr, ImageBuffer, bTextureUpdated);
+	if (!TestNotNull(TEXT("Created the texture"), Texture))
+		return false;
+	TestTrue(TEXT("New texture is updated"), bTextureUpdated);
+
+	const uint8* MipData = Texture->Source.LockMip(0);
+	const TArray<uint8> Pixels(MipData, 16);
+	Texture->Source.UnlockMip(0);
+	TestTrue(TEXT("Rows are flipped and converted to BGRA"), Pixels == TArray<uint8>({ 90, 80, 70, 255, 120, 110, 100, 255, 30, 20, 10, 255, 60, 50, 40, 255 }));
+
+	TestEqual(TEXT("Same image reuses the texture"), CreateTexture(Texture, ImageBuffer, bTextureUpdated), Texture);
+	TestFalse(TEXT("Same image doesn't update the texture"), bTextureUpdated);
+
+	TArray<char> ModifiedImageBuffer = ImageBuffer;
+	ModifiedImageBuffer[0] = 11;
+	TestEqual(TEXT("Modified image reuses the texture"), CreateTexture(Texture, ModifiedImageBuffer, bTextureUpdated), Texture);
+	TestTrue(TEXT("Modified image updates the texture"), bTextureUpdated);
+
+	TestNull(TEXT("Image smaller than its resolution is rejected"), CreateTexture(nullptr, TArray<char>({ 0, 0, 0 }), bTextureUpdated));
+
+	ForEachObjectWithPackage(Package, [](UObject* Object)
+	{
+		Object->ClearFlags(RF_Standalone);
+		return true;
+	});
+	Package->MarkPendingKill();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return true;
+}
+
+// Checks that an instanced part reuses the meshes registered for an identical part of the same HAC,
+// and that the registered source is invalidated once its meshes no longer match the fingerprint.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniInstancedMeshDeduplicationTest, "Houdini.Core.InstancedMeshDeduplication", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniInstancedMeshDeduplicationTest::RunTest(const FString & Parameters)
+{
+	const FString Fingerprint = TEXT("InstancedMeshDeduplicationTest");
+
+	UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>();
+	UHoudiniOutput* SourceOutput = NewObject<UHoudiniOutput>(HAC);
+	UHoudiniOutput* OtherOutput = NewObject<UHoudiniOutput>(HAC);
+	UStaticMesh* SourceMesh = NewObject<UStaticMesh>(HAC);
+
+	FHoudiniGeoPartObject SourceHGPO;
+	SourceHGPO.ObjectId = 1;
+	SourceHGPO.GeoId = 2;
+	SourceHGPO.PartId = 3;
+	FHoudiniGeoPartObject OtherHGPO = SourceHGPO;
+	OtherHGPO.PartId = 4;
+
+	// The source part's mesh, tagged with its fingerprint
+	FHoudiniOutputObject SourceOutputObject;
+	SourceOutputObject.OutputObject = SourceMesh;
+	SourceOutputObject.CachedAttributes.Add(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT, Fingerprint);
+	const FHoudiniOutputObjectIdentifier SourceIdentifier(SourceHGPO.ObjectId, SourceHGPO.GeoId, SourceHGPO.PartId, TEXT("main"));
+	SourceOutput->GetOutputObjects().Add(SourceIdentifier, SourceOutputObject);
+	FHoudiniMeshTranslator::RegisterDeduplicatedMeshSource(SourceHGPO, Fingerprint, SourceOutput, 2.0);
+
+	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> NoOutputObjects;
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> FoundOutputObjects;
+	double SavedTime = 0.0;
+
+	// An identical part of another output of the HAC reuses the source's mesh
+	TestTrue(TEXT("Identical part reuses the source meshes"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		OtherHGPO, Fingerprint, OtherOutput, NoOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+	const FHoudiniOutputObject* FoundOutputObject = FoundOutputObjects.Find(
+		FHoudiniOutputObjectIdentifier(OtherHGPO.ObjectId, OtherHGPO.GeoId, OtherHGPO.PartId, TEXT("main")));
+	if (TestNotNull(TEXT("Output object added for the identical part"), FoundOutputObject))
+		TestEqual(TEXT("Identical part uses the source mesh"), FoundOutputObject->OutputObject, (UObject*)SourceMesh);
+	TestEqual(TEXT("Saved build time"), SavedTime, 2.0);
+
+	// A part of the source's output is processed before the output's objects are updated
+	FoundOutputObjects.Empty();
+	TestTrue(TEXT("Part of the same output reuses the meshes being processed"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		OtherHGPO, Fingerprint, SourceOutput, NoOutputObjects, SourceOutput->GetOutputObjects(), FoundOutputObjects, SavedTime));
+
+	// The unchanged source part keeps its own meshes, and other fingerprints have no source
+	FoundOutputObjects.Empty();
+	TestFalse(TEXT("Unchanged source part"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		SourceHGPO, Fingerprint, SourceOutput, NoOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+	TestFalse(TEXT("Different fingerprint"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		OtherHGPO, Fingerprint + TEXT("_other"), OtherOutput, NoOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+
+	// A changed part with an identical geometry reuses the meshes of its previous cook
+	FHoudiniGeoPartObject ChangedHGPO = SourceHGPO;
+	ChangedHGPO.PartId = 5;
+	ChangedHGPO.bHasPartChanged = true;
+	const FString PreviousFingerprint = Fingerprint + TEXT("_previous");
+	FHoudiniOutputObject PreviousOutputObject = SourceOutputObject;
+	PreviousOutputObject.CachedAttributes.Add(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT, PreviousFingerprint);
+	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> PreviousOutputObjects;
+	PreviousOutputObjects.Add(FHoudiniOutputObjectIdentifier(ChangedHGPO.ObjectId, ChangedHGPO.GeoId, ChangedHGPO.PartId, TEXT("main")), PreviousOutputObject);
+	TestTrue(TEXT("Changed part with an identical geometry reuses its previous meshes"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		ChangedHGPO, PreviousFingerprint, OtherOutput, PreviousOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+	TestFalse(TEXT("Changed part with a different geometry is rebuilt"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		ChangedHGPO, Fingerprint + TEXT("_other"), OtherOutput, PreviousOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+
+	// The source was rebuilt for another fingerprint: its meshes can't be reused anymore
+	SourceOutput->GetOutputObjects()[SourceIdentifier].CachedAttributes.Add(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT, TEXT("Modified"));
+	FoundOutputObjects.Empty();
+	TestFalse(TEXT("Modified source is not reused"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		OtherHGPO, Fingerprint, OtherOutput, NoOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+	SourceOutput->GetOutputObjects()[SourceIdentifier].CachedAttributes.Add(HAPI_UNREAL_OUTPUT_META_GEOMETRY_FINGERPRINT, Fingerprint);
+	TestFalse(TEXT("Invalidated source is forgotten"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		OtherHGPO, Fingerprint, OtherOutput, NoOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+
+	// Clearing the HAC's sources
+	FHoudiniMeshTranslator::RegisterDeduplicatedMeshSource(SourceHGPO, Fingerprint, SourceOutput, 2.0);
+	FHoudiniMeshTranslator::ClearDeduplicatedMeshSources(HAC);
+	TestFalse(TEXT("Cleared source is forgotten"), FHoudiniMeshTranslator::FindDeduplicatedMeshes(
+		OtherHGPO, Fingerprint, OtherOutput, NoOutputObjects, NoOutputObjects, FoundOutputObjects, SavedTime));
+
+	return true;
+}
+
+// Checks the legacy conversion commandlet's detection of the maps saved with v1 Houdini data,
+// and its count of the components that were converted when a map was loaded.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniLegacyConversionTest, "Houdini.Core.LegacyConversion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniLegacyConversionTest::RunTest(const FString & Parameters)
+{
+	// Only the Houdini custom version of the package summary is looked at
+	auto HasLegacyData = [](const int32 InHoudiniVersion)
+	{
+		FCustomVersionContainer Versions;
+		if (InHoudiniVersion >= 0)
+			Versions.SetVersion(FHoudiniCustomSerializationVersion::GUID, InHoudiniVersion, TEXT("HoudiniEngine"));
+
+		FPackageFileSummary Summary;
+		Summary.SetCustomVersionContainer(Versions);
+		return UHoudiniLegacyConversionCommandlet::HasLegacyHoudiniData(Summary);
+	};
+
+	TestFalse(TEXT("Map without Houdini data"), HasLegacyData(-1));
+	TestFalse(TEXT("Version older than v1"), HasLegacyData(VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BASE - 1));
+	TestTrue(TEXT("First v1 version"), HasLegacyData(VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BASE));
+	TestTrue(TEXT("Last v1 version"), HasLegacyData(VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_BASE - 1));
+	TestFalse(TEXT("First v2 version"), HasLegacyData(VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_BASE));
+	TestFalse(TEXT("Current version"), HasLegacyData(VER_HOUDINI_PLUGIN_SERIALIZATION_AUTOMATIC_VERSION));
+
+	// Components without legacy data are neither converted nor failed
+	UPackage* Package = CreatePackage(TEXT("/Game/HoudiniEngineTests/LegacyConversion/Map"));
+	UHoudiniAssetComponent* ConvertedHAC = NewObject<UHoudiniAssetComponent>(Package);
+	UHoudiniAssetComponent* OtherHAC = NewObject<UHoudiniAssetComponent>(Package);
+	TestFalse(TEXT("Component without legacy data isn't converted"), OtherHAC->ConvertLegacyData());
+
+	int32 NumConverted = -1;
+	int32 NumFailed = -1;
+	UHoudiniLegacyConversionCommandlet::CountLegacyComponents(Package, NumConverted, NumFailed);
+	TestEqual(TEXT("No converted components"), NumConverted, 0);
+	TestEqual(TEXT("No failed components"), NumFailed, 0);
+
+	// The conversion done in PostLoad flags the converted components
+	FBoolProperty* ConvertedProperty = FindFProperty<FBoolProperty>(UHoudiniAssetComponent::StaticClass(), TEXT("bConvertedFromLegacyData"));
+	if (TestNotNull(TEXT("Converted flag"), ConvertedProperty))
+	{
+		ConvertedProperty->SetPropertyValue_InContainer(ConvertedHAC, true);
+		UHoudiniLegacyConversionCommandlet::CountLegacyComponents(Package, NumConverted, NumFailed);
+		TestEqual(TEXT("Converted components"), NumConverted, 1);
+		TestEqual(TEXT("Failed components"), NumFailed, 0);
+	}
+
+	UHoudiniLegacyConversionCommandlet::CountLegacyComponents(nullptr, NumConverted, NumFailed);
+	TestEqual(TEXT("Invalid package has no converted components"), NumConverted, 0);
+
+	Package->MarkPendingKill();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return true;
+}
+
 #endif
\ No newline at end of file
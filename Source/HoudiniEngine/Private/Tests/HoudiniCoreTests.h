@@ -2,6 +2,50 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 #include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
 
-#endif
+class FHoudiniBenchmarkTestUtils
+{
+public:
+	// Runs InRunPass with an optimization disabled, then enabled, and reports the duration returned by each pass.
+	// If InCVarName is set, that console variable toggles the optimization and is restored afterwards.
+	// Otherwise, InRunPass runs the baseline code itself when bOptimized is false.
+	static bool RunBenchmarkPasses(
+		FAutomationTestBase* InTest,
+		const TCHAR* InCVarName,
+		const FString& InBenchmarkName,
+		TFunctionRef<double(bool bOptimized)> InRunPass)
+	{
+		IConsoleVariable* CVar = nullptr;
+		if (InCVarName)
+		{
+			CVar = IConsoleManager::Get().FindConsoleVariable(InCVarName);
+			if (!InTest->TestNotNull(InCVarName, CVar))
+				return false;
+		}
+
+		const int32 PreviousValue = CVar ? CVar->GetInt() : 0;
+		double PassTimes[2] = { 0.0, 0.0 };
+		for (int32 Pass = 0; Pass < 2; Pass++)
+		{
+			if (CVar)
+				CVar->Set(Pass, ECVF_SetByCode);
+
+			PassTimes[Pass] = InRunPass(Pass > 0);
+			InTest->AddInfo(FString::Printf(
+				TEXT("%s %s: %.3f ms"),
+				*InBenchmarkName, Pass > 0 ? TEXT("enabled") : TEXT("disabled"), PassTimes[Pass] * 1000.0));
+		}
+
+		if (CVar)
+			CVar->Set(PreviousValue, ECVF_SetByCode);
 
+		if (PassTimes[1] > 0.0)
+			InTest->AddInfo(FString::Printf(TEXT("%s speedup: %.2fx"), *InBenchmarkName, PassTimes[0] / PassTimes[1]));
+
+		return true;
+	}
+};
+
+#endif
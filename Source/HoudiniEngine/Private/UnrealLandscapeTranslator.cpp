@@ -36,11 +36,60 @@
 #include "HoudiniGeoPartObject.h"
 
 #include "Landscape.h"
+#include "LandscapeComponent.h"
 #include "LandscapeDataAccess.h"
 #include "LandscapeEdit.h"
+#include "Engine/Texture2D.h"
 #include "LightMap.h"
 #include "Engine/MapBuildDataRegistry.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Misc/Crc.h"
+
+// What was sent for each landscape heightfield input node
+static TMap<HAPI_NodeId, FHoudiniLandscapeUploadCache> LandscapeUploadCaches;
+
+// The landscape's data is stored in textures, whose source id changes every time their data is modified.
+// Hashing the ids of the textures a volume is read from lets us find the modified components without extracting
+// the landscape's data. Textures can be shared by neighbouring components, which are then flagged as well.
+static uint32
+HashLandscapeTextureId(const UTexture2D* InTexture, const uint32& InHash)
+{
+	if (!IsValid(InTexture))
+		return InHash;
+
+	const FGuid TextureId = InTexture->Source.GetId();
+	return FCrc::MemCrc32(&TextureId, sizeof(FGuid), InHash);
+}
+
+static uint32
+GetLandscapeComponentHeightFingerprint(ULandscapeComponent* InComponent)
+{
+	return HashLandscapeTextureId(InComponent->GetHeightmap(), 0);
+}
+
+static uint32
+GetLandscapeComponentPaintLayerFingerprint(ULandscapeComponent* InComponent, const ULandscapeLayerInfoObject* InLayerInfo)
+{
+	uint32 Hash = 0;
+	const TArray<UTexture2D*>& WeightmapTextures = InComponent->GetWeightmapTextures();
+	for (const FWeightmapLayerAllocationInfo& Allocation : InComponent->GetWeightmapLayerAllocations())
+	{
+		if (Allocation.LayerInfo != InLayerInfo || !WeightmapTextures.IsValidIndex(Allocation.WeightmapTextureIndex))
+			continue;
+
+		Hash = FCrc::MemCrc32(&Allocation.WeightmapTextureChannel, sizeof(Allocation.WeightmapTextureChannel), Hash);
+		Hash = HashLandscapeTextureId(WeightmapTextures[Allocation.WeightmapTextureIndex], Hash);
+	}
+
+	return Hash;
+}
+
+static uint32
+GetLandscapeComponentEditLayerFingerprint(ULandscapeComponent* InComponent, const FGuid& InLayerGuid)
+{
+	const FLandscapeLayerComponentData* LayerData = InComponent->GetLayerData(InLayerGuid);
+	return LayerData ? HashLandscapeTextureId(LayerData->HeightmapData.Texture, 0) : 0;
+}
 
 
 bool 
@@ -137,8 +186,9 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 	TArray<FVector> LandscapeUVArray;
 	// Array for the vertex index of each point in its component
 	TArray<FIntPoint> LandscapeComponentVertexIndicesArray;
-	// Array for the tile names per point
-	TArray<const char *> LandscapeComponentNameArray;
+	// Array for the tile index per point, and the names of the tiles
+	TArray<int32> LandscapeComponentIndexArray;
+	TArray<FString> LandscapeComponentNames;
 	// Array for the lightmap values
 	TArray<FLinearColor> LandscapeLightmapValues;
 	// Selected components set to all components in current landscape proxy
@@ -151,7 +201,7 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 		bExportLighting, bExportTileUVs, bExportNormalizedUVs,
 		LandscapePositionArray, LandscapeNormalArray,
 		LandscapeUVArray, LandscapeComponentVertexIndicesArray,
-		LandscapeComponentNameArray, LandscapeLightmapValues))
+		LandscapeComponentIndexArray, LandscapeComponentNames, LandscapeLightmapValues))
 		return false;
 
 	//--------------------------------------------------------------------------------------------------
@@ -175,7 +225,7 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 		return false;
 
 	// Create point attribute containing landscape component name.
-	if (!AddLandscapeComponentNameAttribute(DisplayGeoInfo.nodeId, LandscapeComponentNameArray))
+	if (!AddLandscapeComponentNameAttribute(DisplayGeoInfo.nodeId, LandscapeComponentIndexArray, LandscapeComponentNames))
 		return false;
 
 	// Create point attribute info containing lightmap information.
@@ -328,6 +378,33 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	if (!SetHeightfieldData(HeightId, PartId, HeightfieldFloatValues, HeightfieldVolumeInfo, TEXT("height")))
 		return false;
 
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	// Keep track of what we've sent, so the next updates only need to send the modified components
+	FHoudiniLandscapeUploadCache UploadCache;
+	UploadCache.LandscapeProxy = LandscapeProxy;
+	UploadCache.ComponentSizeQuads = LandscapeProxy->ComponentSizeQuads;
+	UploadCache.LandscapeTransform = LandscapeTransform;
+	GetLandscapeProxyExtent(LandscapeProxy, UploadCache.MinX, UploadCache.MinY, UploadCache.MaxX, UploadCache.MaxY);
+
+	auto CacheUploadedVolume = [&UploadCache, LandscapeInfo](
+		const FString& InVolumeName,
+		const HAPI_NodeId& InNodeId,
+		const bool& bInSendAllRowsIfModified,
+		TFunctionRef<uint32(ULandscapeComponent*)> InGetFingerprint)
+	{
+		FHoudiniLandscapeUploadCache::FVolume& Volume = UploadCache.Volumes.Add(InVolumeName);
+		Volume.NodeId = InNodeId;
+		Volume.bSendAllRowsIfModified = bInSendAllRowsIfModified;
+		ComputeLandscapeComponentFingerprints(
+			LandscapeInfo, UploadCache.MinX, UploadCache.MinY, UploadCache.MaxX, UploadCache.MaxY,
+			UploadCache.ComponentSizeQuads, InGetFingerprint, Volume.ComponentFingerprints);
+	};
+
+	CacheUploadedVolume(TEXT("height"), HeightId, false, &GetLandscapeComponentHeightFingerprint);
+
 	// Apply attributes to the heightfield
 	ApplyAttributesToHeightfieldNode(HeightId, PartId, LandscapeProxy);
 
@@ -338,10 +415,6 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	//--------------------------------------------------------------------------------------------------
     // 5. Extract and convert all the layers
     //--------------------------------------------------------------------------------------------------
-	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
-	if (!LandscapeInfo)
-		return false;
-
 	bool MaskInitialized = false;
 	int32 MergeInputIndex = 2;
 
@@ -413,6 +486,12 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		if (!SetHeightfieldData(LayerVolumeNodeId, PartId, CurrentLayerFloatData, CurrentLayerVolumeInfo, LayerName))
 			continue;
 
+		// Layers coming from Houdini are converted using the min/max values of the whole layer
+		const ULandscapeLayerInfoObject* LayerInfoObj = LandscapeInfo->Layers[n].LayerInfoObj;
+		CacheUploadedVolume(
+			LayerName, LayerVolumeNodeId, IsLayerFromHoudini(LayerUsageDebugColor),
+			[LayerInfoObj](ULandscapeComponent* InComponent) { return GetLandscapeComponentPaintLayerFingerprint(InComponent, LayerInfoObj); });
+
 		// Get the physical material used by that layer
 		UPhysicalMaterial* LayerPhysicalMat = LandscapeProxy->DefaultPhysMaterial;
 		{
@@ -560,7 +639,13 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 				return false;
 
 			HAPI_PartId LayerPartId = 0;
-			SetHeightfieldData(LandscapeLayerNodeId, LayerPartId, LayerHeightFloatData, LayerVolumeInfo, LayerVolumeName);
+			if (SetHeightfieldData(LandscapeLayerNodeId, LayerPartId, LayerHeightFloatData, LayerVolumeInfo, LayerVolumeName))
+			{
+				const FGuid LayerGuid = Layer.Guid;
+				CacheUploadedVolume(
+					LayerVolumeName, LandscapeLayerNodeId, false,
+					[LayerGuid](ULandscapeComponent* InComponent) { return GetLandscapeComponentEditLayerFingerprint(InComponent, LayerGuid); });
+			}
 
 			// Apply attributes to the heightfield input node
 			ApplyAttributesToHeightfieldNode(LandscapeLayerNodeId, 0, LandscapeProxy);
@@ -571,20 +656,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		}
 	}
 
-	HAPI_TransformEuler HAPIObjectTransform;
-	FHoudiniApi::TransformEuler_Init(&HAPIObjectTransform);
-	//FMemory::Memzero< HAPI_TransformEuler >( HAPIObjectTransform );
-	LandscapeTransform.SetScale3D(FVector::OneVector);
-	FHoudiniEngineUtils::TranslateUnrealTransform(LandscapeTransform, HAPIObjectTransform);
-	HAPIObjectTransform.position[1] = 0.0f;
-
-	HAPI_NodeId ParentObjNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(HeightFieldId);
-	FHoudiniApi::SetObjectTransform(FHoudiniEngine::Get().GetSession(), ParentObjNodeId, &HAPIObjectTransform);
-
-	// Since HF are centered but landscape aren't, we need to set the HF's center parameter
-	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 0, CenterOffset.X);
-	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 1, 0.0);
-	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 2, CenterOffset.Y);
+	SetHeightfieldTransform(HeightFieldId, LandscapeTransform, CenterOffset);
 
 	// Finally, cook the Heightfield node
 	/*
@@ -597,9 +669,388 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	CreatedHeightfieldNodeId = HeightFieldId;
 
+	LandscapeUploadCaches.Add(HeightFieldId, MoveTemp(UploadCache));
+
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(ALandscapeProxy* LandscapeProxy, const HAPI_NodeId& HeightfieldNodeId)
+{
+	if (!IsValid(LandscapeProxy) || HeightfieldNodeId < 0)
+		return false;
+
+	FHoudiniLandscapeUploadCache* UploadCache = LandscapeUploadCaches.Find(HeightfieldNodeId);
+	if (!UploadCache)
+		return false;
+
+	if (UploadCache->LandscapeProxy.Get() != LandscapeProxy || !FHoudiniEngineUtils::IsHoudiniNodeValid(HeightfieldNodeId))
+	{
+		ClearLandscapeUploadCache(HeightfieldNodeId);
+		return false;
+	}
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	//--------------------------------------------------------------------------------------------------
+	// 1. Make sure the landscape's size, layout, rotation/scale and layers haven't changed
+	//--------------------------------------------------------------------------------------------------
+	FTransform LandscapeTM = LandscapeProxy->LandscapeActorToWorld();
+	FTransform ProxyRelativeTM(FVector(LandscapeProxy->LandscapeSectionOffset));
+	FTransform LandscapeTransform = ProxyRelativeTM * LandscapeTM;
+
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
+
+	if (MinX != UploadCache->MinX || MinY != UploadCache->MinY
+		|| MaxX != UploadCache->MaxX || MaxY != UploadCache->MaxY
+		|| LandscapeProxy->ComponentSizeQuads != UploadCache->ComponentSizeQuads)
+		return false;
+
+	// The rotation and scale are stored in the volumes' infos, only translations can be updated in place
+	if (!LandscapeTransform.GetRotation().Equals(UploadCache->LandscapeTransform.GetRotation())
+		|| !LandscapeTransform.GetScale3D().Equals(UploadCache->LandscapeTransform.GetScale3D()))
+		return false;
+
+	const bool bTransformChanged = !LandscapeTransform.Equals(UploadCache->LandscapeTransform);
+
+	// The landscape's Z position is applied to the height values when converting them
+	const bool bHeightOffsetChanged = !FMath::IsNearlyEqual(
+		LandscapeTransform.GetLocation().Z, UploadCache->LandscapeTransform.GetLocation().Z);
+
+	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
+
+	TArray<FString> VolumeNames;
+	VolumeNames.Add(TEXT("height"));
+	for (const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers)
+	{
+		if (LayerSettings.LayerInfoObj)
+			VolumeNames.Add(LayerSettings.GetLayerName().ToString());
+	}
+
+	if (IsValid(Landscape))
+	{
+		for (const FLandscapeLayer& Layer : Landscape->LandscapeLayers)
+			VolumeNames.Add(FString::Format(TEXT("landscapelayer_{0}"), { Layer.Name.ToString() }));
+	}
+
+	if (VolumeNames.Num() != UploadCache->Volumes.Num())
+		return false;
+
+	for (const FString& VolumeName : VolumeNames)
+	{
+		const FHoudiniLandscapeUploadCache::FVolume* Volume = UploadCache->Volumes.Find(VolumeName);
+		if (!Volume || !FHoudiniEngineUtils::IsHoudiniNodeValid(Volume->NodeId))
+			return false;
+	}
+
+	// A paint layer that has been replaced by one coming from Houdini (or vice versa) is converted differently
+	for (const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers)
+	{
+		if (!LayerSettings.LayerInfoObj)
+			continue;
+
+		const FHoudiniLandscapeUploadCache::FVolume* Volume = UploadCache->Volumes.Find(LayerSettings.GetLayerName().ToString());
+		if (Volume->bSendAllRowsIfModified != IsLayerFromHoudini(LayerSettings.LayerInfoObj->LayerUsageDebugColor))
+			return false;
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// 2. Extract and send the rows of the modified components for each volume
+	//--------------------------------------------------------------------------------------------------
+	const int32 XSize = MaxX - MinX + 1;
+	const int32 YSize = MaxY - MinY + 1;
+	const int32 ComponentSizeQuads = UploadCache->ComponentSizeQuads;
+
+	FVector Origin, Extent;
+	GetLandscapeProxyBounds(LandscapeProxy, Origin, Extent);
+	const FVector Min = Origin - Extent;
+	const FVector Max = Origin + Extent;
+
+	int32 NumSentRows = 0;
+	int32 NumVolumeRows = 0;
+
+	// Houdini heightfield rows are the landscape's columns (X), each row contains YSize values.
+	// InGetRows extracts and converts the landscape's data from column InFirstX to InLastX (included).
+	auto UpdateVolume = [&](
+		const FString& InVolumeName,
+		TMap<FIntPoint, uint32>& InNewFingerprints,
+		const bool& bInSendAllRows,
+		const bool& bForceCommit,
+		TFunctionRef<bool(const int32& InFirstX, const int32& InLastX, TArray<float>& OutFloatValues)> InGetRows)
+	{
+		FHoudiniLandscapeUploadCache::FVolume* Volume = UploadCache->Volumes.Find(InVolumeName);
+		if (!Volume)
+			return false;
+
+		NumVolumeRows += XSize;
+
+		TArray<bool> ModifiedRows;
+		bool bModified = GetModifiedHeightfieldRows(
+			Volume->ComponentFingerprints, InNewFingerprints, MinX, XSize, ComponentSizeQuads, ModifiedRows);
+
+		if (bInSendAllRows || (bModified && Volume->bSendAllRowsIfModified))
+		{
+			ModifiedRows.Init(true, XSize);
+			bModified = true;
+		}
+
+		// Only extract, convert and send each run of consecutive modified rows
+		TArray<FIntPoint> RowRuns;
+		GetHeightfieldRowRuns(ModifiedRows, RowRuns);
+		for (const FIntPoint& RowRun : RowRuns)
+		{
+			TArray<float> FloatValues;
+			if (!InGetRows(MinX + RowRun.X, MinX + RowRun.Y, FloatValues))
+				return false;
+
+			if (!SetHeightfieldDataRows(Volume->NodeId, 0, FloatValues, YSize, RowRun.X, InVolumeName))
+				return false;
+
+			NumSentRows += RowRun.Y - RowRun.X + 1;
+		}
+
+		if (bModified || bForceCommit)
+		{
+			// The landscape's materials/tags might have changed as well
+			ApplyAttributesToHeightfieldNode(Volume->NodeId, 0, LandscapeProxy);
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+				FHoudiniEngine::Get().GetSession(), Volume->NodeId), false);
+		}
+
+		Volume->ComponentFingerprints = MoveTemp(InNewFingerprints);
+		return true;
+	};
+
+	auto GetHeightRows = [&](const int32& InFirstX, const int32& InLastX, TArray<float>& OutFloatValues)
+	{
+		TArray<uint16> HeightData;
+		int32 RowsXSize, RowsYSize;
+		if (!GetLandscapeData(LandscapeInfo, InFirstX, MinY, InLastX, MaxY, HeightData, RowsXSize, RowsYSize))
+			return false;
+
+		HAPI_VolumeInfo RowsVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&RowsVolumeInfo);
+		FVector RowsCenterOffset = FVector::ZeroVector;
+		return ConvertLandscapeDataToHeightfieldData(
+			HeightData, RowsXSize, RowsYSize, Min, Max, LandscapeTransform,
+			OutFloatValues, RowsVolumeInfo, RowsCenterOffset);
+	};
+
+	// Height
+	{
+		TMap<FIntPoint, uint32> HeightFingerprints;
+		ComputeLandscapeComponentFingerprints(
+			LandscapeInfo, MinX, MinY, MaxX, MaxY, ComponentSizeQuads,
+			&GetLandscapeComponentHeightFingerprint, HeightFingerprints);
+
+		// Always commit the height volume to update its attributes
+		if (!UpdateVolume(TEXT("height"), HeightFingerprints, bHeightOffsetChanged, true, GetHeightRows))
+			return false;
+	}
+
+	// Paint layers
+	for (int32 LayerIdx = 0; LayerIdx < LandscapeInfo->Layers.Num(); LayerIdx++)
+	{
+		const ULandscapeLayerInfoObject* LayerInfoObj = LandscapeInfo->Layers[LayerIdx].LayerInfoObj;
+		if (!LayerInfoObj)
+			continue;
+
+		const FString LayerName = LandscapeInfo->Layers[LayerIdx].GetLayerName().ToString();
+
+		TMap<FIntPoint, uint32> LayerFingerprints;
+		ComputeLandscapeComponentFingerprints(
+			LandscapeInfo, MinX, MinY, MaxX, MaxY, ComponentSizeQuads,
+			[LayerInfoObj](ULandscapeComponent* InComponent) { return GetLandscapeComponentPaintLayerFingerprint(InComponent, LayerInfoObj); },
+			LayerFingerprints);
+
+		bool bSuccess = UpdateVolume(LayerName, LayerFingerprints, false, false,
+			[&](const int32& InFirstX, const int32& InLastX, TArray<float>& OutFloatValues)
+		{
+			TArray<uint8> LayerData;
+			FLinearColor LayerUsageDebugColor;
+			FString CurrentLayerName;
+			if (!GetLandscapeLayerData(LandscapeInfo, LayerIdx, InFirstX, MinY, InLastX, MaxY, LayerData, LayerUsageDebugColor, CurrentLayerName))
+				return false;
+
+			HAPI_VolumeInfo RowsVolumeInfo;
+			FHoudiniApi::VolumeInfo_Init(&RowsVolumeInfo);
+			return ConvertLandscapeLayerDataToHeightfieldData(
+				LayerData, InLastX - InFirstX + 1, YSize, LayerUsageDebugColor, OutFloatValues, RowsVolumeInfo);
+		});
+
+		if (!bSuccess)
+			return false;
+	}
+
+	// Edit layers
+	if (IsValid(Landscape))
+	{
+		for (FLandscapeLayer& Layer : Landscape->LandscapeLayers)
+		{
+			const FString LayerVolumeName = FString::Format(TEXT("landscapelayer_{0}"), { Layer.Name.ToString() });
+
+			const FGuid LayerGuid = Layer.Guid;
+			TMap<FIntPoint, uint32> LayerFingerprints;
+			ComputeLandscapeComponentFingerprints(
+				LandscapeInfo, MinX, MinY, MaxX, MaxY, ComponentSizeQuads,
+				[LayerGuid](ULandscapeComponent* InComponent) { return GetLandscapeComponentEditLayerFingerprint(InComponent, LayerGuid); },
+				LayerFingerprints);
+
+			FScopedSetLandscapeEditingLayer Scope(Landscape, Layer.Guid); // Scope landscape access to the current layer
+
+			if (!UpdateVolume(LayerVolumeName, LayerFingerprints, bHeightOffsetChanged, false, GetHeightRows))
+				return false;
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// 3. Send the new transform if the landscape has been moved
+	//--------------------------------------------------------------------------------------------------
+	if (bTransformChanged)
+	{
+		// Same center offset as ConvertLandscapeDataToHeightfieldData
+		const FVector CenterOffset = (Max - Min) / 100.0f * 0.5f;
+		SetHeightfieldTransform(HeightfieldNodeId, LandscapeTransform, CenterOffset);
+		UploadCache->LandscapeTransform = LandscapeTransform;
+	}
+
+	HOUDINI_LANDSCAPE_MESSAGE(
+		TEXT("[FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape] Sent %d of %d heightfield rows for %s."),
+		NumSentRows, NumVolumeRows, *LandscapeProxy->GetName());
+
+	// Cook the Heightfield node
+	return FHoudiniEngineUtils::HapiCookNode(HeightfieldNodeId, nullptr, true);
+}
+
+void
+FUnrealLandscapeTranslator::ClearLandscapeUploadCache(const HAPI_NodeId& HeightfieldNodeId)
+{
+	LandscapeUploadCaches.Remove(HeightfieldNodeId);
+}
+
+void
+FUnrealLandscapeTranslator::ClearAllLandscapeUploadCaches()
+{
+	LandscapeUploadCaches.Empty();
+}
+
+void
+FUnrealLandscapeTranslator::SetHeightfieldTransform(
+	const HAPI_NodeId& HeightfieldNodeId,
+	FTransform LandscapeTransform,
+	const FVector& CenterOffset)
+{
+	HAPI_TransformEuler HAPIObjectTransform;
+	FHoudiniApi::TransformEuler_Init(&HAPIObjectTransform);
+	//FMemory::Memzero< HAPI_TransformEuler >( HAPIObjectTransform );
+	LandscapeTransform.SetScale3D(FVector::OneVector);
+	FHoudiniEngineUtils::TranslateUnrealTransform(LandscapeTransform, HAPIObjectTransform);
+	HAPIObjectTransform.position[1] = 0.0f;
+
+	HAPI_NodeId ParentObjNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(HeightfieldNodeId);
+	FHoudiniApi::SetObjectTransform(FHoudiniEngine::Get().GetSession(), ParentObjNodeId, &HAPIObjectTransform);
+
+	// Since HF are centered but landscape aren't, we need to set the HF's center parameter
+	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightfieldNodeId, "t", 0, CenterOffset.X);
+	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightfieldNodeId, "t", 1, 0.0);
+	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightfieldNodeId, "t", 2, CenterOffset.Y);
+}
+
+void
+FUnrealLandscapeTranslator::ComputeLandscapeComponentFingerprints(
+	ULandscapeInfo* LandscapeInfo,
+	const int32& MinX, const int32& MinY,
+	const int32& MaxX, const int32& MaxY,
+	const int32& ComponentSizeQuads,
+	TFunctionRef<uint32(ULandscapeComponent*)> InGetFingerprint,
+	TMap<FIntPoint, uint32>& OutComponentFingerprints)
+{
+	OutComponentFingerprints.Empty();
+	if (!LandscapeInfo || ComponentSizeQuads <= 0)
+		return;
+
+	for (const auto& Pair : LandscapeInfo->XYtoComponentMap)
+	{
+		// Component keys are their section base divided by ComponentSizeQuads.
+		// Components share their border vertices with their neighbours.
+		const FIntPoint& ComponentKey = Pair.Key;
+		if ((ComponentKey.X + 1) * ComponentSizeQuads < MinX || ComponentKey.X * ComponentSizeQuads > MaxX
+			|| (ComponentKey.Y + 1) * ComponentSizeQuads < MinY || ComponentKey.Y * ComponentSizeQuads > MaxY)
+			continue;
+
+		ULandscapeComponent* Component = Pair.Value;
+		if (!IsValid(Component))
+			continue;
+
+		OutComponentFingerprints.Add(ComponentKey, InGetFingerprint(Component));
+	}
+}
+
+bool
+FUnrealLandscapeTranslator::GetModifiedHeightfieldRows(
+	const TMap<FIntPoint, uint32>& PreviousFingerprints,
+	const TMap<FIntPoint, uint32>& NewFingerprints,
+	const int32& MinX, const int32& XSize,
+	const int32& ComponentSizeQuads,
+	TArray<bool>& OutModifiedRows)
+{
+	OutModifiedRows.Init(false, XSize);
+
+	bool bModified = false;
+	for (const auto& Pair : NewFingerprints)
+	{
+		const uint32* PreviousFingerprint = PreviousFingerprints.Find(Pair.Key);
+		if (PreviousFingerprint && *PreviousFingerprint == Pair.Value)
+			continue;
+
+		const int32 StartX = FMath::Max(Pair.Key.X * ComponentSizeQuads - MinX, 0);
+		const int32 EndX = FMath::Min((Pair.Key.X + 1) * ComponentSizeQuads - MinX, XSize - 1);
+		for (int32 X = StartX; X <= EndX; X++)
+			OutModifiedRows[X] = true;
+
+		bModified = true;
+	}
+
+	return bModified;
+}
+
+void
+FUnrealLandscapeTranslator::GetHeightfieldRowRuns(const TArray<bool>& InModifiedRows, TArray<FIntPoint>& OutRowRuns)
+{
+	OutRowRuns.Empty();
+
+	const int32 NumRows = InModifiedRows.Num();
+	int32 RowIdx = 0;
+	while (RowIdx < NumRows)
+	{
+		if (!InModifiedRows[RowIdx])
+		{
+			RowIdx++;
+			continue;
+		}
+
+		int32 FirstRowIdx = RowIdx;
+		while (RowIdx < NumRows && InModifiedRows[RowIdx])
+			RowIdx++;
+
+		// The data can only be extracted/converted for at least 2 rows
+		if (RowIdx - FirstRowIdx < 2)
+		{
+			if (RowIdx < NumRows)
+				RowIdx++;
+			else if (FirstRowIdx > 0)
+				FirstRowIdx--;
+		}
+
+		OutRowRuns.Add(FIntPoint(FirstRowIdx, RowIdx - 1));
+	}
+}
+
 bool 
 FUnrealLandscapeTranslator::CreateInputNodeForLandscape(
 	ALandscapeProxy* LandscapeProxy,
@@ -652,6 +1103,13 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscape(
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::IsLayerFromHoudini(const FLinearColor& LayerUsageDebugColor)
+{
+	// The landscape translator sets the alpha value of the layers it creates to PI
+	return LayerUsageDebugColor.A == PI;
+}
+
 // Converts Unreal uint16 values to Houdini Float
 bool
 FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
@@ -688,10 +1146,9 @@ FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
 	float LayerMax = 1.0f;
 	float LayerSpacing = 1.0f / DigitRange;
 	
-	// If this layer came from Houdini, its alpha value should be PI
-	// This indicates that we can extract additional infos stored its debug usage color
+	// If this layer came from Houdini, we can extract additional infos stored its debug usage color
 	// so we can reconstruct the original source values (float) more accurately
-	if (LayerUsageDebugColor.A == PI)
+	if (IsLayerFromHoudini(LayerUsageDebugColor))
 	{
 		// We need the ZMin / ZMax uint8 values
 		IntMin = IntHeightData[0];
@@ -782,28 +1239,8 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 		return false;
 
 	// Get the landscape extents to get its size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
-	
-	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
-	if (LandscapeProxy == Landscape)
-	{
-		// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
-		// may have been moved to proxies and may not be present on this actor).
-		LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
-	}
-	else
-	{
-		// We only want to get the data for this landscape proxy.
-		// To handle streaming proxies correctly, get the extents via all the components,
-		// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-		for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-		{
-			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-		}
-	}
+	int32 MinX, MinY, MaxX, MaxY;
+	GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY);
 
 	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
 		return false;
@@ -848,6 +1285,42 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 }
 
 
+bool
+FUnrealLandscapeTranslator::GetLandscapeProxyExtent(
+	ALandscapeProxy* LandscapeProxy,
+	int32& MinX, int32& MinY,
+	int32& MaxX, int32& MaxY)
+{
+	MinX = MAX_int32;
+	MinY = MAX_int32;
+	MaxX = -MAX_int32;
+	MaxY = -MAX_int32;
+
+	ULandscapeInfo* LandscapeInfo = IsValid(LandscapeProxy) ? LandscapeProxy->GetLandscapeInfo() : nullptr;
+	if (!LandscapeInfo)
+		return false;
+
+	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
+	if (LandscapeProxy == Landscape)
+	{
+		// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
+		// may have been moved to proxies and may not be present on this actor).
+		LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
+	}
+	else
+	{
+		// We only want to get the data for this landscape proxy.
+		// To handle streaming proxies correctly, get the extents via all the components,
+		// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
+		for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+		{
+			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+		}
+	}
+
+	return !(MinX == MAX_int32 || MinY == MAX_int32 || MaxX == -MAX_int32 || MaxY == -MAX_int32);
+}
+
 void
 FUnrealLandscapeTranslator::GetLandscapeProxyBounds(
 	ALandscapeProxy* LandscapeProxy, FVector& Origin, FVector& Extents)
@@ -1123,6 +1596,30 @@ FUnrealLandscapeTranslator::SetHeightfieldData(
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::SetHeightfieldDataRows(
+	const HAPI_NodeId& VolumeNodeId,
+	const HAPI_PartId& PartId,
+	const TArray<float>& FloatValues,
+	const int32& RowSize,
+	const int32& FirstRow,
+	const FString& HeightfieldName)
+{
+	if (RowSize <= 0 || FirstRow < 0 || FloatValues.Num() <= 0 || FloatValues.Num() % RowSize != 0)
+		return false;
+
+	// Volume name
+	std::string NameStr;
+	FHoudiniEngineUtils::ConvertUnrealString(HeightfieldName, NameStr);
+
+	// Consecutive rows are contiguous in the volume, so they can be sent in a single call
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
+		FHoudiniEngine::Get().GetSession(),
+		VolumeNodeId, PartId, NameStr.c_str(), FloatValues.GetData(), FirstRow * RowSize, FloatValues.Num()), false);
+
+	return true;
+}
+
 bool FUnrealLandscapeTranslator::AddLandscapeMaterialAttributesToVolume(
 	const HAPI_NodeId& VolumeNodeId, 
 	const HAPI_PartId& PartId,
@@ -1351,30 +1848,8 @@ FUnrealLandscapeTranslator::GetLandscapeLayerData(
 		return false;
 
 	// Get the landscape X/Y Size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
-
-	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
-	if (LandscapeProxy == Landscape)
-	{
-		// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
-		// may have been moved to proxies and may not be present on this actor).
-		LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
-	}
-	else
-	{
-		// We only want to get the data for this landscape proxy.
-		// To handle streaming proxies correctly, get the extents via all the components,
-		// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-		for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-		{
-			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-		}
-	}
-
-	if(MinX == MAX_int32 || MinY == MAX_int32 || MaxX == -MAX_int32 || MaxY == -MAX_int32)
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
 		return false;
 
 	if (!GetLandscapeLayerData(
@@ -1537,7 +2012,8 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 	TArray<FVector>& LandscapeNormalArray,
 	TArray<FVector>& LandscapeUVArray,
 	TArray<FIntPoint>& LandscapeComponentVertexIndicesArray,
-	TArray<const char *>& LandscapeComponentNameArray,
+	TArray<int32>& LandscapeComponentIndexArray,
+	TArray<FString>& LandscapeComponentNames,
 	TArray<FLinearColor>& LandscapeLightmapValues)
 {
 	if (!LandscapeProxy)
@@ -1565,7 +2041,8 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 	LandscapePositionArray.SetNumUninitialized(VertexCount);
 	LandscapeNormalArray.SetNumUninitialized(VertexCount);
 	LandscapeUVArray.SetNumUninitialized(VertexCount);
-	LandscapeComponentNameArray.SetNumUninitialized(VertexCount);
+	LandscapeComponentIndexArray.SetNumUninitialized(VertexCount);
+	LandscapeComponentNames.Empty(NumComponents);
 	LandscapeComponentVertexIndicesArray.SetNumUninitialized(VertexCount);
 	if (bExportLighting)
 		LandscapeLightmapValues.SetNumUninitialized(VertexCount);
@@ -1613,7 +2090,7 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 		FLandscapeComponentDataInterface CDI(LandscapeComponent, LandscapeProxy->ExportLOD);
 
 		// Get name of this landscape component.
-		const char * LandscapeComponentNameStr = FHoudiniEngineUtils::ExtractRawString(LandscapeComponent->GetName());
+		const int32 LandscapeComponentNameIdx = LandscapeComponentNames.Add(LandscapeComponent->GetName());
 		for (int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++)
 		{
 			int32 VertX = 0;
@@ -1691,8 +2168,8 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 
 			Swap(Normal.Y, Normal.Z);
 
-			// Store landscape component name for this point.
-			LandscapeComponentNameArray[AllPositionsIdx] = LandscapeComponentNameStr;
+			// Store landscape component name index for this point.
+			LandscapeComponentIndexArray[AllPositionsIdx] = LandscapeComponentNameIdx;
 
 			// Store vertex index (x,y) for this point.
 			LandscapeComponentVertexIndicesArray[AllPositionsIdx].X = VertX;
@@ -1706,9 +2183,6 @@ FUnrealLandscapeTranslator::ExtractLandscapeData(
 
 			AllPositionsIdx++;
 		}
-
-		// Free the memory allocated for LandscapeComponentNameStr
-		FHoudiniEngineUtils::FreeRawStringMemory(LandscapeComponentNameStr);
 	}
 
 	// If we need to normalize UV space and we are doing global UVs.
@@ -1875,34 +2349,59 @@ FUnrealLandscapeTranslator::AddLandscapeComponentVertexIndicesAttribute(const HA
 }
 
 bool 
-FUnrealLandscapeTranslator::AddLandscapeComponentNameAttribute(const HAPI_NodeId& NodeId, const TArray<const char *>& LandscapeComponentNameArray)
+FUnrealLandscapeTranslator::AddLandscapeComponentNameAttribute(
+	const HAPI_NodeId& NodeId,
+	const TArray<int32>& LandscapeComponentIndexArray,
+	const TArray<FString>& LandscapeComponentNames)
 {
-	int32 VertexCount = LandscapeComponentNameArray.Num();
+	int32 VertexCount = LandscapeComponentIndexArray.Num();
 	if (VertexCount < 3)
 		return false;
 
-	// Create point attribute containing landscape component name.
-	HAPI_AttributeInfo AttributeInfoPointLandscapeComponentNames;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPointLandscapeComponentNames);
-	//FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPointLandscapeComponentNames );
-	AttributeInfoPointLandscapeComponentNames.count = VertexCount;
-	AttributeInfoPointLandscapeComponentNames.tupleSize = 1;
-	AttributeInfoPointLandscapeComponentNames.exists = true;
-	AttributeInfoPointLandscapeComponentNames.owner = HAPI_ATTROWNER_POINT;
-	AttributeInfoPointLandscapeComponentNames.storage = HAPI_STORAGETYPE_STRING;
-	AttributeInfoPointLandscapeComponentNames.originalOwner = HAPI_ATTROWNER_INVALID;
+	int32 NumComponents = LandscapeComponentNames.Num();
+	if (NumComponents < 1)
+		return false;
+
+	// Send the component index of each point, and the component names once, as a detail tuple
+	HAPI_AttributeInfo AttributeInfoPointLandscapeComponentIndex;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPointLandscapeComponentIndex);
+	AttributeInfoPointLandscapeComponentIndex.count = VertexCount;
+	AttributeInfoPointLandscapeComponentIndex.tupleSize = 1;
+	AttributeInfoPointLandscapeComponentIndex.exists = true;
+	AttributeInfoPointLandscapeComponentIndex.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfoPointLandscapeComponentIndex.storage = HAPI_STORAGETYPE_INT;
+	AttributeInfoPointLandscapeComponentIndex.originalOwner = HAPI_ATTROWNER_INVALID;
 
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
 		FHoudiniEngine::Get().GetSession(), NodeId, 0,
-		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
-		&AttributeInfoPointLandscapeComponentNames), false);
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_INDEX,
+		&AttributeInfoPointLandscapeComponentIndex), false);
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeStringData(
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
 		FHoudiniEngine::Get().GetSession(), NodeId, 0,
-		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
-		&AttributeInfoPointLandscapeComponentNames,
-		(const char **)LandscapeComponentNameArray.GetData(),
-		0, AttributeInfoPointLandscapeComponentNames.count), false);
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_INDEX,
+		&AttributeInfoPointLandscapeComponentIndex,
+		LandscapeComponentIndexArray.GetData(),
+		0, AttributeInfoPointLandscapeComponentIndex.count), false);
+
+	HAPI_AttributeInfo AttributeInfoDetailLandscapeComponentNames;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoDetailLandscapeComponentNames);
+	AttributeInfoDetailLandscapeComponentNames.count = 1;
+	AttributeInfoDetailLandscapeComponentNames.tupleSize = NumComponents;
+	AttributeInfoDetailLandscapeComponentNames.exists = true;
+	AttributeInfoDetailLandscapeComponentNames.owner = HAPI_ATTROWNER_DETAIL;
+	AttributeInfoDetailLandscapeComponentNames.storage = HAPI_STORAGETYPE_STRING;
+	AttributeInfoDetailLandscapeComponentNames.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0,
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAMES,
+		&AttributeInfoDetailLandscapeComponentNames), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::SetAttributeStringData(
+		LandscapeComponentNames, NodeId, 0,
+		HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAMES,
+		AttributeInfoDetailLandscapeComponentNames), false);
 
 	return true;
 }
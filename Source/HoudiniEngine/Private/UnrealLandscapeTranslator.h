@@ -30,8 +30,41 @@
 #include "HAPI/HAPI_Common.h"
 
 class ALandscapeProxy;
+class ULandscapeComponent;
 class UHoudiniInputLandscape;
 
+// What was sent to Houdini for a landscape heightfield input, by heightfield input node.
+// Used to only send the landscape components that have been modified on the next upload.
+struct HOUDINIENGINE_API FHoudiniLandscapeUploadCache
+{
+	struct FVolume
+	{
+		// The heightfield input volume node
+		HAPI_NodeId NodeId = -1;
+
+		// Fingerprint of the data of each landscape component (by component key) when it was sent
+		TMap<FIntPoint, uint32> ComponentFingerprints;
+
+		// True if the volume's values depend on the whole layer, so all of its rows
+		// need to be sent again whenever one of its components is modified
+		bool bSendAllRowsIfModified = false;
+	};
+
+	// The landscape that was sent
+	TWeakObjectPtr<ALandscapeProxy> LandscapeProxy;
+
+	// Landscape extent and layout when the data was sent
+	int32 MinX = 0;
+	int32 MinY = 0;
+	int32 MaxX = 0;
+	int32 MaxY = 0;
+	int32 ComponentSizeQuads = 0;
+	FTransform LandscapeTransform;
+
+	// Uploaded volumes, by volume name
+	TMap<FString, FVolume> Volumes;
+};
+
 struct HOUDINIENGINE_API FUnrealLandscapeTranslator 
 {
 	public:
@@ -44,6 +77,19 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			HAPI_NodeId& CreatedHeightfieldNodeId,
 			const FString &InputNodeNameStr);
 
+		// Updates a heightfield previously created by CreateHeightfieldFromLandscape,
+		// only sending the rows of the landscape components that have been modified since the last upload.
+		// Returns false if the heightfield can't be updated (it then needs to be recreated).
+		static bool UpdateHeightfieldFromLandscape(
+			ALandscapeProxy* LandscapeProxy,
+			const HAPI_NodeId& HeightfieldNodeId);
+
+		// Forget what was sent for a heightfield (when its node is deleted)
+		static void ClearLandscapeUploadCache(const HAPI_NodeId& HeightfieldNodeId);
+
+		// Forget what was sent for all heightfields (when the session is started/stopped)
+		static void ClearAllLandscapeUploadCaches();
+
 		static bool CreateInputNodeForLandscape(
 			ALandscapeProxy* LandscapeProxy,
 			const FString& InputNodeNameStr,
@@ -83,6 +129,12 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			TArray<uint16>& HeightData,
 			int32& XSize, int32& YSize);
 
+		// Get the extent (in landscape vertices) of the data sent for a landscape proxy
+		static bool GetLandscapeProxyExtent(
+			ALandscapeProxy* LandscapeProxy,
+			int32& MinX, int32& MinY,
+			int32& MaxX, int32& MaxY);
+
 		static void GetLandscapeProxyBounds(
 			ALandscapeProxy* LandscapeProxy,
 			FVector& Origin, FVector& Extents);
@@ -99,6 +151,10 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			HAPI_VolumeInfo& HeightfieldVolumeInfo,
 			FVector& CenterOffset);
 
+		// Returns true if the layer was created by Houdini: its alpha debug color is then PI, and its
+		// RGB debug color stores the min/max/spacing used to convert its values back to float
+		static bool IsLayerFromHoudini(const FLinearColor& LayerUsageDebugColor);
+
 		// Converts Unreal uint8 values to Houdini Float
 		static bool ConvertLandscapeLayerDataToHeightfieldData(
 			const TArray<uint8>& IntHeightData,
@@ -125,6 +181,44 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_VolumeInfo& VolumeInfo,
 			const FString& HeightfieldName);
 
+		// Only set the consecutive rows starting at FirstRow of an existing heightfield volume
+		static bool SetHeightfieldDataRows(
+			const HAPI_NodeId& VolumeNodeId,
+			const HAPI_PartId& PartId,
+			const TArray<float>& FloatValues,
+			const int32& RowSize,
+			const int32& FirstRow,
+			const FString& HeightfieldName);
+
+		// Sets the transform of the heightfield's parent OBJ node and its center offset
+		static void SetHeightfieldTransform(
+			const HAPI_NodeId& HeightfieldNodeId,
+			FTransform LandscapeTransform,
+			const FVector& CenterOffset);
+
+		// Fingerprints each landscape component (by component key) in the given extent with InGetFingerprint
+		static void ComputeLandscapeComponentFingerprints(
+			ULandscapeInfo* LandscapeInfo,
+			const int32& MinX, const int32& MinY,
+			const int32& MaxX, const int32& MaxY,
+			const int32& ComponentSizeQuads,
+			TFunctionRef<uint32(ULandscapeComponent*)> InGetFingerprint,
+			TMap<FIntPoint, uint32>& OutComponentFingerprints);
+
+		// Flags the heightfield rows (unreal X coordinates) covered by the components whose fingerprint differ
+		static bool GetModifiedHeightfieldRows(
+			const TMap<FIntPoint, uint32>& PreviousFingerprints,
+			const TMap<FIntPoint, uint32>& NewFingerprints,
+			const int32& MinX, const int32& XSize,
+			const int32& ComponentSizeQuads,
+			TArray<bool>& OutModifiedRows);
+
+		// Splits the modified rows into the runs of consecutive rows to send, as (first row, last row) pairs.
+		// Single row runs are extended by one row when possible, as the data is extracted by at least 2 rows.
+		static void GetHeightfieldRowRuns(
+			const TArray<bool>& InModifiedRows,
+			TArray<FIntPoint>& OutRowRuns);
+
 		static bool AddLandscapeMaterialAttributesToVolume(
 			const HAPI_NodeId& VolumeNodeId,
 			const HAPI_PartId& PartId,
@@ -195,7 +289,8 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			TArray<FVector>& LandscapeNormalArray,
 			TArray<FVector>& LandscapeUVArray,
 			TArray<FIntPoint>& LandscapeComponentVertexIndicesArray,
-			TArray<const char *>& LandscapeComponentNameArray,
+			TArray<int32>& LandscapeComponentIndexArray,
+			TArray<FString>& LandscapeComponentNames,
 			TArray<FLinearColor>& LandscapeLightmapValues);
 
 		// Helper functions to extract color from a texture
@@ -226,9 +321,11 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const TArray<FIntPoint>& LandscapeComponentVertexIndicesArray);
 
 		// Add the Component Name attribute extracted from a landscape
+		// LandscapeComponentIndexArray contains the index of each point's component in LandscapeComponentNames
 		static bool AddLandscapeComponentNameAttribute(
 			const HAPI_NodeId& NodeId,
-			const TArray<const char *>& LandscapeComponentNameArray);
+			const TArray<int32>& LandscapeComponentIndexArray,
+			const TArray<FString>& LandscapeComponentNames);
 
 		// Add the lightmap color attribute extracted from a landscape
 		static bool AddLandscapeLightmapColorAttribute(
@@ -105,7 +105,10 @@ public class HoudiniEngineEditor : ModuleRules
                 "Json",
                 "SceneOutliner",
                 "PropertyPath",
-                "MaterialEditor"
+                "MaterialEditor",
+                "SourceControl",
+                "MeshDescription",
+                "SlateNullRenderer"
             }
         );
 
@@ -0,0 +1,551 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniBatchCookCommandlet.h"
+
+#include "HoudiniEngineEditorPrivatePCH.h"
+
+#include "HoudiniEngine.h"
+#include "HoudiniEngineBakeUtils.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "FileHelpers.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "Interfaces/ISlateNullRendererModule.h"
+#include "Rendering/SlateRenderer.h"
+#include "Framework/Application/SlateApplication.h"
+
+// State of a component being processed by the commandlet
+struct FHoudiniBatchCookTrackedComponent
+{
+	TWeakObjectPtr<UHoudiniAssetComponent> HAC;
+
+	FHoudiniBatchCookAssetResult Result;
+
+	FDelegateHandle StateChangeHandle;
+
+	// Time at which the cook was requested, used for the timeout
+	double RequestTime = 0.0;
+
+	// Time at which the current stage (instantiation, cook or translation) started
+	double StageStartTime = 0.0;
+
+	bool bStarted = false;
+
+	bool bFinished = false;
+};
+
+UHoudiniBatchCookCommandlet::UHoudiniBatchCookCommandlet()
+	: MaxConcurrentCooks(4)
+	, CookTimeout(600.0)
+	, bRebuild(false)
+	, bBake(false)
+	, BakeOption(EHoudiniEngineBakeOption::ToActor)
+	, bReplacePreviousBake(false)
+	, bRemoveOutputAfterBake(false)
+	, bSave(true)
+{
+	HelpDescription = TEXT("Recooks (or rebuilds) and bakes all the Houdini Asset Components of a set of maps, saves the maps and reports the cook, translation and bake times of each component.");
+
+	HelpUsage = TEXT("HoudiniBatchCook Usage: HoudiniBatchCook [-maps=/Game/Maps/A+/Game/Maps/B] [-dir=/Game/Maps] [-concurrency=4] [-timeout=600] [-rebuild] [-bake=actors|blueprints|foliage|worldoutliner] [-replace] [-removeoutput] [-nosave] [-report=filename.json|csv]");
+
+	HelpParamNames = {
+		"help",
+		"maps",
+		"dir",
+		"concurrency",
+		"timeout",
+		"rebuild",
+		"bake",
+		"replace",
+		"removeoutput",
+		"nosave",
+		"report"
+	};
+
+	HelpParamDescriptions = {
+		"Displays this help.",
+		"The maps to process, separated by +.",
+		"The content directory (ie /Game/Maps) to look for maps in, recursively. Used if -maps isn't specified, defaults to /Game.",
+		"The maximum number of Houdini Asset Components cooking at the same time. Defaults to 4.",
+		"Time (in seconds) after which a component that hasn't finished cooking is skipped. Defaults to 600.",
+		"Rebuild the Houdini Asset Components instead of recooking them.",
+		"Bake the Houdini Asset Components after they have been cooked, to actors, blueprints, foliage or the world outliner.",
+		"Replace the previous bake output instead of creating new actors / assets.",
+		"Remove the Houdini Asset Components' outputs after a successful bake.",
+		"Do not save the maps and the cooked / baked assets.",
+		"Write the per component results to a file, as JSON if its extension is .json or CSV otherwise."
+	};
+
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowProgress = false;
+	ShowErrorCount = false;
+}
+
+void UHoudiniBatchCookCommandlet::PrintUsage() const
+{
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpDescription);
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpUsage);
+	const int32 NumOptions = HelpParamNames.Num();
+	for (int32 Idx = 0; Idx < NumOptions; ++Idx)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("-%s\t%s"), *HelpParamNames[Idx], *HelpParamDescriptions[Idx]);
+	}
+}
+
+void UHoudiniBatchCookCommandlet::TickEngine() const
+{
+	GEngine->UpdateTimeAndHandleMaxTickRate();
+	GEngine->Tick(FApp::GetDeltaTime(), false);
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().PumpMessages();
+		FSlateApplication::Get().Tick();
+	}
+
+	// Required for FTimerManager to function - as it blocks ticks, if the frame counter doesn't change
+	GFrameCounter++;
+
+	// update task graph
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+	// The Houdini Engine Manager is ticked by the core ticker
+	FTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
+	FThreadManager::Get().Tick();
+	GEngine->TickDeferredCommands();
+
+	FPlatformProcess::Sleep(0);
+}
+
+bool UHoudiniBatchCookCommandlet::BakeComponent(UHoudiniAssetComponent* InHAC, FHoudiniBatchCookAssetResult& OutResult) const
+{
+	const double BakeStartTime = FPlatformTime::Seconds();
+	OutResult.bBakeSucceeded = FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
+		InHAC, bReplacePreviousBake, BakeOption, bRemoveOutputAfterBake, false);
+	OutResult.BakeTime = FPlatformTime::Seconds() - BakeStartTime;
+
+	if (!OutResult.bBakeSucceeded)
+		HOUDINI_LOG_ERROR(TEXT("%s: failed to bake %s"), *OutResult.MapPackageName, *OutResult.ActorName);
+
+	return OutResult.bBakeSucceeded;
+}
+
+void UHoudiniBatchCookCommandlet::CancelCook(UHoudiniAssetComponent* InHAC) const
+{
+	if (!IsValid(InHAC))
+		return;
+
+	const int32 AssetId = InHAC->GetAssetId();
+	if (AssetId >= 0 && FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true);
+
+	// Also invalidates the asset id, the component will be reinstantiated if it's cooked again
+	InHAC->MarkAsNeedInstantiation();
+}
+
+bool UHoudiniBatchCookCommandlet::ProcessMap(const FString& InMapPackageName, TArray<FHoudiniBatchCookAssetResult>& OutResults)
+{
+	const double LoadStartTime = FPlatformTime::Seconds();
+	UWorld* World = UEditorLoadingAndSavingUtils::LoadMap(InMapPackageName);
+	if (!World)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not load map %s"), *InMapPackageName);
+		return false;
+	}
+	const double LoadTime = FPlatformTime::Seconds() - LoadStartTime;
+
+	// The tracked components are only accessed by index, and the array isn't resized while they're processed,
+	// so the state change delegates can safely keep a pointer to their element.
+	TArray<FHoudiniBatchCookTrackedComponent> Tracked;
+	for (TActorIterator<AActor> ActorIt(World); ActorIt; ++ActorIt)
+	{
+		TArray<UHoudiniAssetComponent*> HACs;
+		ActorIt->GetComponents<UHoudiniAssetComponent>(HACs);
+		for (UHoudiniAssetComponent* HAC : HACs)
+		{
+			if (!IsValid(HAC) || HAC->IsTemplate() || !IsValid(HAC->GetHoudiniAsset()))
+				continue;
+
+			FHoudiniBatchCookTrackedComponent& Entry = Tracked.AddDefaulted_GetRef();
+			Entry.HAC = HAC;
+			Entry.Result.MapPackageName = InMapPackageName;
+			Entry.Result.ActorName = ActorIt->GetActorLabel();
+			Entry.Result.HoudiniAssetName = HAC->GetHoudiniAsset()->GetPathName();
+		}
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("%s: loaded in %.3fs, %d Houdini Asset Components to process"), *InMapPackageName, LoadTime, Tracked.Num());
+
+	int32 NextIndex = 0;
+	int32 NumActive = 0;
+	int32 NumFailed = 0;
+	while (NextIndex < Tracked.Num() || NumActive > 0)
+	{
+		// Start new cooks until we reach the maximum number of concurrent cooks.
+		// The other components stay in the NeedInstantiation state they were loaded in, which the manager doesn't process.
+		while (NumActive < MaxConcurrentCooks && NextIndex < Tracked.Num())
+		{
+			FHoudiniBatchCookTrackedComponent* Entry = &Tracked[NextIndex++];
+			UHoudiniAssetComponent* HAC = Entry->HAC.Get();
+			if (!IsValid(HAC))
+				continue;
+
+			Entry->StateChangeHandle = HAC->GetOnAssetStateChangeDelegate().AddLambda(
+				[Entry](UHoudiniAssetComponent* InHAC, const EHoudiniAssetState InFromState, const EHoudiniAssetState InToState)
+			{
+				if (Entry->bFinished)
+					return;
+
+				const double Now = FPlatformTime::Seconds();
+				switch (InToState)
+				{
+					case EHoudiniAssetState::PreInstantiation:
+						Entry->StageStartTime = Now;
+						break;
+
+					case EHoudiniAssetState::PreCook:
+						if (InFromState == EHoudiniAssetState::Instantiating)
+							Entry->Result.InstantiateTime = Now - Entry->StageStartTime;
+						Entry->StageStartTime = Now;
+						break;
+
+					case EHoudiniAssetState::PostCook:
+						Entry->Result.CookTime = Now - Entry->StageStartTime;
+						Entry->StageStartTime = Now;
+						break;
+
+					case EHoudiniAssetState::None:
+						// Either all the outputs have been processed, or the cook failed / couldn't be started
+						if (InFromState == EHoudiniAssetState::Processing)
+						{
+							Entry->Result.TranslateTime = Now - Entry->StageStartTime;
+							Entry->Result.bCookSucceeded = InHAC->WasLastCookSuccessful();
+						}
+						Entry->bFinished = true;
+						break;
+
+					case EHoudiniAssetState::NeedInstantiation:
+						// The instantiation failed
+						if (Entry->bStarted)
+							Entry->bFinished = true;
+						break;
+
+					default:
+						break;
+				}
+			});
+
+			// Bake actual static meshes, not proxies
+			HAC->SetNoProxyMeshNextCookRequested(true);
+			if (bRebuild)
+				HAC->MarkAsNeedRebuild();
+			else
+				HAC->MarkAsNeedCook();
+
+			Entry->RequestTime = FPlatformTime::Seconds();
+			Entry->StageStartTime = Entry->RequestTime;
+			Entry->bStarted = true;
+			NumActive++;
+		}
+
+		TickEngine();
+
+		if (IsEngineExitRequested())
+			break;
+
+		const double Now = FPlatformTime::Seconds();
+		for (FHoudiniBatchCookTrackedComponent& Entry : Tracked)
+		{
+			if (!Entry.bStarted || !Entry.StateChangeHandle.IsValid())
+				continue;
+
+			UHoudiniAssetComponent* HAC = Entry.HAC.Get();
+			if (!IsValid(HAC))
+			{
+				HOUDINI_LOG_ERROR(TEXT("%s: %s was destroyed while cooking"), *InMapPackageName, *Entry.Result.ActorName);
+				Entry.bFinished = true;
+			}
+			else if (!Entry.bFinished && CookTimeout > 0.0 && Now - Entry.RequestTime > CookTimeout)
+			{
+				HOUDINI_LOG_ERROR(TEXT("%s: %s did not finish cooking after %.0fs, cancelling it"), *InMapPackageName, *Entry.Result.ActorName, CookTimeout);
+				Entry.Result.bTimedOut = true;
+				Entry.bFinished = true;
+
+				// Stop it before freeing its slot, so that it doesn't keep running alongside the next cooks
+				CancelCook(HAC);
+			}
+
+			if (!Entry.bFinished)
+				continue;
+
+			if (IsValid(HAC))
+				HAC->GetOnAssetStateChangeDelegate().Remove(Entry.StateChangeHandle);
+			Entry.StateChangeHandle.Reset();
+			NumActive--;
+
+			if (Entry.Result.bCookSucceeded && bBake)
+				BakeComponent(HAC, Entry.Result);
+
+			if (!Entry.Result.bCookSucceeded || (bBake && !Entry.Result.bBakeSucceeded))
+				NumFailed++;
+
+			const FHoudiniBatchCookAssetResult& Result = Entry.Result;
+			HOUDINI_LOG_DISPLAY(
+				TEXT("%s: %s (%s) %s, instantiate %.3fs, cook %.3fs, translate %.3fs, bake %.3fs"),
+				*Result.MapPackageName, *Result.ActorName, *Result.HoudiniAssetName,
+				Result.bCookSucceeded ? TEXT("cooked") : TEXT("failed"),
+				Result.InstantiateTime, Result.CookTime, Result.TranslateTime, Result.BakeTime);
+		}
+	}
+
+	for (const FHoudiniBatchCookTrackedComponent& Entry : Tracked)
+	{
+		// Unbind the components that were still cooking if the engine is exiting
+		if (Entry.StateChangeHandle.IsValid() && Entry.HAC.IsValid())
+			Entry.HAC->GetOnAssetStateChangeDelegate().Remove(Entry.StateChangeHandle);
+
+		OutResults.Add(Entry.Result);
+	}
+
+	bool bSaved = true;
+	if (bSave)
+	{
+		// Saves the map, and the cooked and baked assets
+		const double SaveStartTime = FPlatformTime::Seconds();
+		bSaved = UEditorLoadingAndSavingUtils::SaveDirtyPackages(true, true);
+		if (bSaved)
+			HOUDINI_LOG_DISPLAY(TEXT("%s: saved in %.3fs"), *InMapPackageName, FPlatformTime::Seconds() - SaveStartTime);
+		else
+			HOUDINI_LOG_ERROR(TEXT("Could not save map %s"), *InMapPackageName);
+	}
+
+	return bSaved && NumFailed == 0;
+}
+
+bool UHoudiniBatchCookCommandlet::WriteReport(const FString& InFilename, const TArray<FHoudiniBatchCookAssetResult>& InResults) const
+{
+	FString Report;
+	if (FPaths::GetExtension(InFilename).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Report);
+		Writer->WriteObjectStart();
+		Writer->WriteArrayStart(TEXT("assets"));
+		for (const FHoudiniBatchCookAssetResult& Result : InResults)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("map"), Result.MapPackageName);
+			Writer->WriteValue(TEXT("actor"), Result.ActorName);
+			Writer->WriteValue(TEXT("houdini_asset"), Result.HoudiniAssetName);
+			Writer->WriteValue(TEXT("instantiate_seconds"), Result.InstantiateTime);
+			Writer->WriteValue(TEXT("cook_seconds"), Result.CookTime);
+			Writer->WriteValue(TEXT("translate_seconds"), Result.TranslateTime);
+			Writer->WriteValue(TEXT("bake_seconds"), Result.BakeTime);
+			Writer->WriteValue(TEXT("cooked"), Result.bCookSucceeded);
+			Writer->WriteValue(TEXT("baked"), Result.bBakeSucceeded);
+			Writer->WriteValue(TEXT("timed_out"), Result.bTimedOut);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+	}
+	else
+	{
+		Report = TEXT("Map,Actor,HoudiniAsset,InstantiateSeconds,CookSeconds,TranslateSeconds,BakeSeconds,Cooked,Baked,TimedOut\n");
+		for (const FHoudiniBatchCookAssetResult& Result : InResults)
+		{
+			Report += FString::Printf(
+				TEXT("%s,%s,%s,%.3f,%.3f,%.3f,%.3f,%d,%d,%d\n"),
+				*Result.MapPackageName,
+				*Result.ActorName,
+				*Result.HoudiniAssetName,
+				Result.InstantiateTime,
+				Result.CookTime,
+				Result.TranslateTime,
+				Result.BakeTime,
+				Result.bCookSucceeded ? 1 : 0,
+				Result.bBakeSucceeded ? 1 : 0,
+				Result.bTimedOut ? 1 : 0);
+		}
+	}
+
+	return FFileHelper::SaveStringToFile(Report, *InFilename);
+}
+
+int32 UHoudiniBatchCookCommandlet::Main(const FString& InParams)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*InParams, Tokens, Switches, Params);
+
+	if (Switches.Contains(TEXT("help")) || Switches.Contains(TEXT("?")))
+	{
+		PrintUsage();
+		return 0;
+	}
+
+	// Find the maps to process
+	TArray<FString> MapPackageNames;
+	if (Params.Contains(TEXT("maps")))
+	{
+		Params.FindChecked(TEXT("maps")).ParseIntoArray(MapPackageNames, TEXT("+"));
+	}
+	else
+	{
+		const FString ContentDirectory = Params.Contains(TEXT("dir")) ? Params.FindChecked(TEXT("dir")) : TEXT("/Game");
+		FString Directory;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(ContentDirectory / TEXT(""), Directory))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Invalid content directory: %s"), *ContentDirectory);
+			return 1;
+		}
+
+		TArray<FString> MapFilenames;
+		IFileManager::Get().FindFilesRecursive(
+			MapFilenames, *Directory, *(FString(TEXT("*")) + FPackageName::GetMapPackageExtension()), true, false);
+		for (const FString& MapFilename : MapFilenames)
+		{
+			FString MapPackageName;
+			if (FPackageName::TryConvertFilenameToLongPackageName(MapFilename, MapPackageName))
+				MapPackageNames.Add(MapPackageName);
+		}
+	}
+
+	if (MapPackageNames.Num() <= 0)
+	{
+		HOUDINI_LOG_ERROR(TEXT("No maps to process."));
+		PrintUsage();
+		return 1;
+	}
+
+	if (Params.Contains(TEXT("concurrency")))
+		MaxConcurrentCooks = FMath::Max(1, FCString::Atoi(*Params.FindChecked(TEXT("concurrency"))));
+
+	if (Params.Contains(TEXT("timeout")))
+		CookTimeout = FCString::Atod(*Params.FindChecked(TEXT("timeout")));
+
+	bRebuild = Switches.Contains(TEXT("rebuild"));
+	bReplacePreviousBake = Switches.Contains(TEXT("replace"));
+	bRemoveOutputAfterBake = Switches.Contains(TEXT("removeoutput"));
+	bSave = !Switches.Contains(TEXT("nosave"));
+
+	bBake = Params.Contains(TEXT("bake"));
+	if (bBake)
+	{
+		const FString& BakeOptionString = Params.FindChecked(TEXT("bake"));
+		if (BakeOptionString.Equals(TEXT("actors"), ESearchCase::IgnoreCase))
+			BakeOption = EHoudiniEngineBakeOption::ToActor;
+		else if (BakeOptionString.Equals(TEXT("blueprints"), ESearchCase::IgnoreCase))
+			BakeOption = EHoudiniEngineBakeOption::ToBlueprint;
+		else if (BakeOptionString.Equals(TEXT("foliage"), ESearchCase::IgnoreCase))
+			BakeOption = EHoudiniEngineBakeOption::ToFoliage;
+		else if (BakeOptionString.Equals(TEXT("worldoutliner"), ESearchCase::IgnoreCase))
+			BakeOption = EHoudiniEngineBakeOption::ToWorldOutliner;
+		else
+		{
+			HOUDINI_LOG_ERROR(TEXT("Invalid bake option: %s"), *BakeOptionString);
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	// In UnrealEngine 4.25 and older we cannot tick the editor engine without slate being initialized.
+	if (!FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::InitHighDPI(false);
+		FSlateApplication::Create();
+	}
+
+	// If slate is initialized, make sure it has a renderer. If we have to create a renderer, create the null renderer.
+	if (FSlateApplication::IsInitialized() && !FSlateApplication::Get().GetRenderer())
+	{
+		const TSharedPtr<FSlateRenderer> SlateRenderer = FModuleManager::Get().LoadModuleChecked<ISlateNullRendererModule>("SlateNullRenderer").CreateSlateNullRenderer();
+		const TSharedRef<FSlateRenderer> SlateRendererSharedRef = SlateRenderer.ToSharedRef();
+		FSlateApplication::Get().InitializeRenderer(SlateRendererSharedRef);
+	}
+
+	// Start the session now instead of when the first component is processed, so we can stop early if it fails
+	if (!FHoudiniEngine::Get().GetSession())
+	{
+		FHoudiniEngine::Get().SetFirstSessionCreated(true);
+		if (!FHoudiniEngine::Get().RestartSession())
+		{
+			HOUDINI_LOG_ERROR(TEXT("Could not start the Houdini Engine session."));
+			return 1;
+		}
+	}
+
+	if (!FHoudiniEngine::Get().IsCookingEnabled())
+		FHoudiniEngine::Get().SetCookingEnabled(true);
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FHoudiniBatchCookAssetResult> Results;
+	int32 NumFailedMaps = 0;
+	for (const FString& MapPackageName : MapPackageNames)
+	{
+		if (!ProcessMap(MapPackageName, Results))
+			NumFailedMaps++;
+
+		if (IsEngineExitRequested())
+			break;
+
+		// Unload the map before processing the next one
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	if (Params.Contains(TEXT("report")))
+	{
+		const FString ReportFilename = Params.FindChecked(TEXT("report"));
+		if (!WriteReport(ReportFilename, Results))
+			HOUDINI_LOG_ERROR(TEXT("Could not write the batch cook report to %s"), *ReportFilename);
+	}
+
+	HOUDINI_LOG_DISPLAY(
+		TEXT("Processed %d Houdini Asset Components in %d maps in %.3fs, %d maps had failures."),
+		Results.Num(), MapPackageNames.Num(), FPlatformTime::Seconds() - StartTime, NumFailedMaps);
+
+	if (FSlateApplication::IsInitialized())
+		FSlateApplication::Shutdown();
+
+	return NumFailedMaps > 0 ? 2 : 0;
+}
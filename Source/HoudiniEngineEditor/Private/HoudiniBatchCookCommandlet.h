@@ -0,0 +1,126 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+
+#include "HoudiniEngineRuntimeCommon.h"
+
+#include "HoudiniBatchCookCommandlet.generated.h"
+
+class UHoudiniAssetComponent;
+
+// Cook and bake results for a single Houdini Asset Component
+struct FHoudiniBatchCookAssetResult
+{
+	// Long package name of the map containing the component
+	FString MapPackageName;
+
+	// Label of the component's owner
+	FString ActorName;
+
+	// Path name of the component's Houdini Asset
+	FString HoudiniAssetName;
+
+	// Time spent instantiating the HDA in the Houdini Engine session
+	double InstantiateTime = 0.0;
+
+	// Time spent uploading the parameters and inputs, and cooking the HDA
+	double CookTime = 0.0;
+
+	// Time spent translating the cooked data to outputs
+	double TranslateTime = 0.0;
+
+	// Time spent baking the outputs
+	double BakeTime = 0.0;
+
+	bool bCookSucceeded = false;
+
+	bool bBakeSucceeded = false;
+
+	// The component didn't finish cooking before the timeout
+	bool bTimedOut = false;
+};
+
+UCLASS()
+class HOUDINIENGINEEDITOR_API UHoudiniBatchCookCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UHoudiniBatchCookCommandlet();
+
+	void PrintUsage() const;
+
+	/**
+	* Entry point for the commandlet
+	*
+	* @param Params the string containing the parameters for the commandlet
+	*/
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+
+	// Ticks the engine, the task graph and the core ticker (which ticks the Houdini Engine Manager)
+	void TickEngine() const;
+
+	// Loads a map, recooks (or rebuilds) and bakes all its Houdini Asset Components, and saves it
+	bool ProcessMap(const FString& InMapPackageName, TArray<FHoudiniBatchCookAssetResult>& OutResults);
+
+	// Bakes a cooked Houdini Asset Component with the commandlet's bake option
+	bool BakeComponent(UHoudiniAssetComponent* InHAC, FHoudiniBatchCookAssetResult& OutResult) const;
+
+	// Cancels the cook of a Houdini Asset Component that timed out: deletes its node so that it stops
+	// using the session, and puts it back in the NeedInstantiation state, which the manager doesn't process
+	void CancelCook(UHoudiniAssetComponent* InHAC) const;
+
+	// Writes the results to InFilename, as JSON if the file has a .json extension or as CSV otherwise
+	bool WriteReport(const FString& InFilename, const TArray<FHoudiniBatchCookAssetResult>& InResults) const;
+
+	// Maximum number of components being cooked at the same time
+	int32 MaxConcurrentCooks;
+
+	// Time after which a component that hasn't finished cooking is skipped, in seconds
+	double CookTimeout;
+
+	// Rebuild the components instead of recooking them
+	bool bRebuild;
+
+	// Bake the components after they have been cooked
+	bool bBake;
+
+	EHoudiniEngineBakeOption BakeOption;
+
+	bool bReplacePreviousBake;
+
+	bool bRemoveOutputAfterBake;
+
+	bool bSave;
+};
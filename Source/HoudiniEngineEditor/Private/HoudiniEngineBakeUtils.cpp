@@ -95,9 +95,204 @@
 #include "UObject/UnrealType.h"
 #include "Math/Box.h"
 #include "Misc/ScopedSlowTask.h"
+#include "ISourceControlModule.h"
+#include "MeshDescription.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/ArchiveUObject.h"
+#include "Engine/StaticMeshSocket.h"
+#include "Rendering/ColorVertexBuffer.h"
 
 HOUDINI_BAKING_DEFINE_LOG_CATEGORY();
 
+// Feeds everything serialized to it to a SHA1, to compute the content hash of baked objects.
+// References to the Houdini generated materials and textures are hashed by content, so that identical
+// temporary objects match, and references to other objects are hashed by path.
+class FHoudiniBakeContentHashArchive : public FArchiveUObject
+{
+public:
+	FHoudiniBakeContentHashArchive(UObject* InRootObject)
+		: RootObject(InRootObject)
+	{
+		SetIsSaving(true);
+		SetIsPersistent(true);
+		ArIgnoreOuterRef = true;
+	}
+
+	virtual FString GetArchiveName() const override { return TEXT("FHoudiniBakeContentHashArchive"); }
+
+	virtual void Serialize(void* Data, int64 Num) override
+	{
+		Hash.Update((const uint8*)Data, Num);
+	}
+
+	virtual FArchive& operator<<(FName& Value) override
+	{
+		FString NameString = Value.ToString();
+		return *this << NameString;
+	}
+
+	virtual FArchive& operator<<(UObject*& Value) override
+	{
+		FString Reference;
+		if (!Value)
+		{
+			Reference = TEXT("None");
+		}
+		else if (Value == RootObject)
+		{
+			Reference = TEXT("Self");
+		}
+		else if (Value->IsIn(RootObject))
+		{
+			// Subobjects are hashed along with their root
+			Reference = Value->GetPathName(RootObject);
+			PendingObjects.AddUnique(Value);
+		}
+		else if (IsHoudiniGeneratedObject(Value))
+		{
+			Reference = FHoudiniEngineBakeUtils::GetBakeContentHash(Value);
+			if (Reference.IsEmpty())
+				bFailed = true;
+		}
+		else
+		{
+			Reference = Value->GetPathName();
+		}
+
+		return *this << Reference;
+	}
+
+	virtual bool ShouldSkipProperty(const FProperty* InProperty) const override
+	{
+		// Guids are unique to each object, even when their content is identical
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty);
+		const FStructProperty* StructProperty = CastField<FStructProperty>(ArrayProperty ? ArrayProperty->Inner : InProperty);
+		return StructProperty && StructProperty->Struct == TBaseStructure<FGuid>::Get();
+	}
+
+	// Serializes InObject (the root or one of its subobjects), then all the subobjects it references
+	void SerializeObject(UObject* InObject)
+	{
+		PendingObjects.AddUnique(InObject);
+		SerializePendingObjects();
+	}
+
+	void SerializePendingObjects()
+	{
+		while (PendingObjects.Num() > 0)
+		{
+			UObject* Object = PendingObjects.Pop(false);
+			if (SerializedObjects.Contains(Object))
+				continue;
+
+			SerializedObjects.Add(Object);
+			Object->Serialize(*this);
+		}
+	}
+
+	// Returns the hash of everything serialized so far, or an empty string if a referenced object couldn't be hashed
+	FString GetHash()
+	{
+		SerializePendingObjects();
+		if (bFailed)
+			return FString();
+
+		Hash.Final();
+		uint8 Digest[FSHA1::DigestSize];
+		Hash.GetHash(Digest);
+
+		return BytesToHex(Digest, FSHA1::DigestSize);
+	}
+
+	static bool IsHoudiniGeneratedObject(UObject* InObject)
+	{
+		if (!IsValid(InObject) || !(InObject->IsA<UMaterialInterface>() || InObject->IsA<UTexture2D>()))
+			return false;
+
+		UMetaData* MetaData = InObject->GetOutermost()->GetMetaData();
+		return MetaData && MetaData->HasValue(InObject, HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT);
+	}
+
+private:
+	FSHA1 Hash;
+	UObject* RootObject;
+	TArray<UObject*> PendingObjects;
+	TSet<UObject*> SerializedObjects;
+	bool bFailed = false;
+};
+
+// Object that wasn't baked because an identical asset had already been baked
+struct FHoudiniBakeDedupeEntry
+{
+	FString SourceObjectPath;
+	FString BakedObjectPath;
+	int64 BytesSaved;
+};
+
+// Collects the objects that reused an identical baked asset for the duration of a bake.
+// The bake entry points each open a scope, only the outermost one collects the entries and logs them when it ends.
+class FHoudiniBakeDedupeReportScope
+{
+public:
+	FHoudiniBakeDedupeReportScope()
+		: bIsOutermost(ActiveEntries == nullptr)
+	{
+		if (bIsOutermost)
+			ActiveEntries = &Entries;
+	}
+
+	~FHoudiniBakeDedupeReportScope()
+	{
+		if (!bIsOutermost)
+			return;
+
+		ActiveEntries = nullptr;
+		LogReport(Entries);
+	}
+
+	static void Record(UObject* InSourceObject, UObject* InBakedObject)
+	{
+		// Estimate the bytes saved with the size of the reused package on disk, or of the object in memory
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(
+			InBakedObject->GetOutermost()->GetName(), FPackageName::GetAssetPackageExtension());
+		int64 BytesSaved = IFileManager::Get().FileSize(*PackageFilename);
+		if (BytesSaved <= 0)
+			BytesSaved = InBakedObject->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+
+		const FHoudiniBakeDedupeEntry Entry{ InSourceObject->GetPathName(), InBakedObject->GetPathName(), BytesSaved };
+		if (ActiveEntries)
+			ActiveEntries->Add(Entry);
+		else
+			LogReport({ Entry });
+	}
+
+private:
+	static void LogReport(const TArray<FHoudiniBakeDedupeEntry>& InEntries)
+	{
+		if (InEntries.Num() <= 0)
+			return;
+
+		int64 TotalBytesSaved = 0;
+		for (const FHoudiniBakeDedupeEntry& Entry : InEntries)
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("Bake: reused %s for %s (%lld bytes)."), *Entry.BakedObjectPath, *Entry.SourceObjectPath, Entry.BytesSaved);
+			TotalBytesSaved += Entry.BytesSaved;
+		}
+
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Bake: %d objects were identical to already baked assets, saved about %lld bytes."),
+			InEntries.Num(), TotalBytesSaved);
+	}
+
+	// Entries of the outermost scope, bakes only run on the game thread
+	static TArray<FHoudiniBakeDedupeEntry>* ActiveEntries;
+
+	TArray<FHoudiniBakeDedupeEntry> Entries;
+	bool bIsOutermost;
+};
+
+TArray<FHoudiniBakeDedupeEntry>* FHoudiniBakeDedupeReportScope::ActiveEntries = nullptr;
+
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
 FHoudiniEngineBakedActor::FHoudiniEngineBakedActor()
@@ -139,6 +334,151 @@ FHoudiniEngineBakedActor::FHoudiniEngineBakedActor(
 {
 }
 
+int32 FHoudiniBakeNotificationScope::ScopeDepth = 0;
+double FHoudiniBakeNotificationScope::ScopeStartTime = 0.0;
+TArray<TWeakObjectPtr<UObject>> FHoudiniBakeNotificationScope::CreatedAssets;
+TArray<TPair<FSoftObjectPath, FSoftObjectPath>> FHoudiniBakeNotificationScope::RenamedObjects;
+TArray<TWeakObjectPtr<UObject>> FHoudiniBakeNotificationScope::ChangedObjects;
+TSet<TWeakObjectPtr<UObject>> FHoudiniBakeNotificationScope::ChangedObjectsSet;
+TSet<TWeakObjectPtr<UPackage>> FHoudiniBakeNotificationScope::DirtyPackages;
+
+FHoudiniBakeNotificationScope::FHoudiniBakeNotificationScope()
+{
+	check(IsInGameThread());
+	if (ScopeDepth++ == 0)
+		ScopeStartTime = FPlatformTime::Seconds();
+}
+
+FHoudiniBakeNotificationScope::~FHoudiniBakeNotificationScope()
+{
+	if (--ScopeDepth == 0)
+		SendDeferredNotifications();
+}
+
+void
+FHoudiniBakeNotificationScope::NotifyAssetCreated(UObject* InAsset)
+{
+	if (!IsValid(InAsset))
+		return;
+
+	if (IsActive())
+		CreatedAssets.Add(InAsset);
+	else
+		FAssetRegistryModule::AssetCreated(InAsset);
+}
+
+void
+FHoudiniBakeNotificationScope::NotifyObjectRenamed(const FSoftObjectPath& InOldPath, const FSoftObjectPath& InNewPath)
+{
+	if (InOldPath == InNewPath)
+		return;
+
+	if (!IsActive())
+	{
+		FAssetToolsModule& AssetToolsModule = FModuleManager::GetModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+		TArray<FAssetRenameData> RenameData;
+		RenameData.Add(FAssetRenameData(InOldPath, InNewPath, true));
+		AssetToolsModule.Get().RenameAssets(RenameData);
+		return;
+	}
+
+	// Collapse successive renames of the same object
+	for (int32 Index = 0; Index < RenamedObjects.Num(); Index++)
+	{
+		if (RenamedObjects[Index].Value != InOldPath)
+			continue;
+
+		if (RenamedObjects[Index].Key == InNewPath)
+			RenamedObjects.RemoveAt(Index);
+		else
+			RenamedObjects[Index].Value = InNewPath;
+		return;
+	}
+
+	RenamedObjects.Emplace(InOldPath, InNewPath);
+}
+
+void
+FHoudiniBakeNotificationScope::PostEditChange(UObject* InObject)
+{
+	if (!IsValid(InObject))
+		return;
+
+	if (!IsActive())
+	{
+		InObject->PostEditChange();
+		return;
+	}
+
+	bool bAlreadyInSet = false;
+	ChangedObjectsSet.Add(InObject, &bAlreadyInSet);
+	if (!bAlreadyInSet)
+		ChangedObjects.Add(InObject);
+}
+
+void
+FHoudiniBakeNotificationScope::MarkPackageDirty(UObject* InObject)
+{
+	if (!IsValid(InObject))
+		return;
+
+	if (IsActive())
+		DirtyPackages.Add(InObject->GetOutermost());
+	else
+		InObject->MarkPackageDirty();
+}
+
+void
+FHoudiniBakeNotificationScope::SendDeferredNotifications()
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumCreatedAssets = CreatedAssets.Num();
+	const int32 NumRenamedObjects = RenamedObjects.Num();
+	const int32 NumChangedObjects = ChangedObjects.Num();
+	const int32 NumDirtyPackages = DirtyPackages.Num();
+
+	// Move the pending notifications out first, in case the listeners start a new bake
+	TArray<TWeakObjectPtr<UObject>> Assets = MoveTemp(CreatedAssets);
+	TArray<TPair<FSoftObjectPath, FSoftObjectPath>> Renames = MoveTemp(RenamedObjects);
+	TArray<TWeakObjectPtr<UObject>> Objects = MoveTemp(ChangedObjects);
+	TSet<TWeakObjectPtr<UPackage>> Packages = MoveTemp(DirtyPackages);
+	ChangedObjectsSet.Empty();
+
+	for (const TWeakObjectPtr<UObject>& Asset : Assets)
+	{
+		if (Asset.IsValid())
+			FAssetRegistryModule::AssetCreated(Asset.Get());
+	}
+
+	if (Renames.Num() > 0)
+	{
+		TArray<FAssetRenameData> RenameData;
+		RenameData.Reserve(Renames.Num());
+		for (const TPair<FSoftObjectPath, FSoftObjectPath>& Rename : Renames)
+			RenameData.Add(FAssetRenameData(Rename.Key, Rename.Value, true));
+
+		FAssetToolsModule& AssetToolsModule = FModuleManager::GetModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+		AssetToolsModule.Get().RenameAssets(RenameData);
+	}
+
+	for (const TWeakObjectPtr<UObject>& Object : Objects)
+	{
+		if (Object.IsValid())
+			Object->PostEditChange();
+	}
+
+	for (const TWeakObjectPtr<UPackage>& Package : Packages)
+	{
+		if (Package.IsValid())
+			Package->MarkPackageDirty();
+	}
+
+	const double EndTime = FPlatformTime::Seconds();
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Bake took %.3f s, including %.3f s to send the deferred notifications (%d created assets, %d renamed objects, %d changed objects, %d dirty packages)."),
+		EndTime - ScopeStartTime, EndTime - StartTime, NumCreatedAssets, NumRenamedObjects, NumChangedObjects, NumDirtyPackages);
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	UHoudiniAssetComponent* InHACToBake,
@@ -147,6 +487,8 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	bool bInRemoveHACOutputOnSuccess,
 	bool bInRecenterBakedActors)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!IsValid(InHACToBake))
 		return false;
 
@@ -202,6 +544,8 @@ bool
 FHoudiniEngineBakeUtils::BakeHoudiniActorToActors(
 	UHoudiniAssetComponent* HoudiniAssetComponent, bool bInReplaceActors, bool bInReplaceAssets, bool bInRecenterBakedActors) 
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
@@ -264,6 +608,8 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors(
 	AActor* InFallbackActor,
 	const FString& InFallbackWorldOutlinerFolder)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
@@ -326,6 +672,11 @@ FHoudiniEngineBakeUtils::BakeHoudiniOutputsToActors(
 	AActor* InFallbackActor,
 	const FString& InFallbackWorldOutlinerFolder)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
+	// Send the editor notifications for all the outputs at once, when we're done
+	FHoudiniBakeNotificationScope NotificationScope;
+
 	const int32 NumOutputs = InOutputs.Num();
 	
 	const FString MsgTemplate = TEXT("Baking output: {0}/{1}.");
@@ -489,7 +840,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniOutputsToActors(
 			{
 				Actor->InvalidateLightingCache();
 				Actor->PostEditMove(true);
-				Actor->MarkPackageDirty();
+				FHoudiniBakeNotificationScope::MarkPackageDirty(Actor);
 			}
 		}
 	}
@@ -685,41 +1036,38 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToFoliage(
 	if (!FoliageInfo)
 		return false;
 
-	int32 CurrentInstanceCount = 0;
+	// Gather all the instances first, so they can be added to the foliage at once
+	TArray<FFoliageInstance> FoliageInstances;
 	if (SMC->IsA<UInstancedStaticMeshComponent>())
 	{
 		UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(SMC);
 		const int32 NumInstances = ISMC->GetInstanceCount();
+		FoliageInstances.Reserve(NumInstances);
 		for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
 		{
 			FTransform InstanceTransform;
 			const bool bWorldSpace = true;
 			if (ISMC->GetInstanceTransform(InstanceIndex, InstanceTransform, bWorldSpace))
 			{
-				FFoliageInstance FoliageInstance;
+				FFoliageInstance& FoliageInstance = FoliageInstances.AddDefaulted_GetRef();
 				FoliageInstance.Location = InstanceTransform.GetLocation();
 				FoliageInstance.Rotation = InstanceTransform.GetRotation().Rotator();
 				FoliageInstance.DrawScale3D = InstanceTransform.GetScale3D();
-
-				FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-
-				CurrentInstanceCount++;
 			}
 		}
 	}
 	else
 	{
 		const FTransform ComponentToWorldTransform = SMC->GetComponentToWorld();
-		FFoliageInstance FoliageInstance;
+		FFoliageInstance& FoliageInstance = FoliageInstances.AddDefaulted_GetRef();
 		FoliageInstance.Location = ComponentToWorldTransform.GetLocation();
 		FoliageInstance.Rotation = ComponentToWorldTransform.GetRotation().Rotator();
 		FoliageInstance.DrawScale3D = ComponentToWorldTransform.GetScale3D();
-
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-
-		CurrentInstanceCount++;
 	}
 
+	const int32 CurrentInstanceCount = FHoudiniEngineUtils::AddFoliageInstances(
+		InstancedFoliageActor, FoliageType, FoliageInfo, FoliageInstances);
+
 	// TODO: This was due to a bug in UE4.22-20, check if still needed! 
 	if (FoliageInfo->GetComponent())
 		FoliageInfo->GetComponent()->BuildTreeIfOutdated(true, true);
@@ -770,6 +1118,8 @@ FHoudiniEngineBakeUtils::CanHoudiniAssetComponentBakeToFoliage(UHoudiniAssetComp
 bool 
 FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent* HoudiniAssetComponent, bool bInReplaceAssets, TMap<UMaterialInterface *, UMaterialInterface *>& InOutAlreadyBakedMaterialsMap) 
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
@@ -1813,6 +2163,186 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 	return true;
 }
 
+void
+FHoudiniEngineBakeUtils::DuplicateMeshSplitInstancerComponents(
+	AActor* InActor,
+	USceneComponent* InParentComponent,
+	UHoudiniMeshSplitInstancerComponent* InMSIC,
+	UStaticMesh* InStaticMesh,
+	UMaterialInterface* InOverrideMaterial,
+	TArray<UStaticMeshComponent*>& OutComponents)
+{
+	if (!IsValid(InActor) || !IsValid(InMSIC) || !IsValid(InStaticMesh))
+		return;
+
+	OutComponents.Reserve(OutComponents.Num() + InMSIC->GetInstances().Num());
+
+	// Add a SMC component for each of the MSIC's instance
+	for (UStaticMeshComponent* CurrentSMC : InMSIC->GetInstances())
+	{
+		if (!CurrentSMC || CurrentSMC->IsPendingKill())
+			continue;
+
+		UStaticMeshComponent* NewSMC = DuplicateObject<UStaticMeshComponent>(
+			CurrentSMC,
+			InActor,
+			FName(MakeUniqueObjectNameIfNeeded(InActor, CurrentSMC->GetClass(), CurrentSMC->GetName())));
+		if (!NewSMC || NewSMC->IsPendingKill())
+			continue;
+
+		OutComponents.Add(NewSMC);
+
+		// NewSMC->SetupAttachment(nullptr);
+		NewSMC->SetStaticMesh(InStaticMesh);
+		InActor->AddInstanceComponent(NewSMC);
+		NewSMC->SetWorldTransform(CurrentSMC->GetComponentTransform());
+
+		if (InOverrideMaterial)
+		{
+			NewSMC->OverrideMaterials.Empty();
+			int32 MeshMaterialCount = InStaticMesh->StaticMaterials.Num();
+			for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
+				NewSMC->SetMaterial(Idx, InOverrideMaterial);
+		}
+
+		if (IsValid(InParentComponent))
+			NewSMC->AttachToComponent(InParentComponent, FAttachmentTransformRules::KeepWorldTransform);
+
+		// Only register the component once it's set up, so its render and physics states are only created once
+		NewSMC->RegisterComponent();
+
+		// TODO: Do we need to copy properties here, we duplicated the component
+		// // Copy properties from the existing component
+		// CopyPropertyToNewActorAndComponent(InActor, NewSMC, CurrentSMC);
+	}
+}
+
+void
+FHoudiniEngineBakeUtils::CreateInstancedComponentsFromMeshSplitInstancer(
+	AActor* InActor,
+	USceneComponent* InParentComponent,
+	UHoudiniMeshSplitInstancerComponent* InMSIC,
+	UStaticMesh* InStaticMesh,
+	UMaterialInterface* InOverrideMaterial,
+	TArray<UStaticMeshComponent*>& OutComponents)
+{
+	if (!IsValid(InActor) || !IsValid(InMSIC) || !IsValid(InStaticMesh))
+		return;
+
+	const TArray<UStaticMeshComponent*>& Instances = InMSIC->GetInstances();
+
+	// The instance colors are applied to the MSIC's components as override vertex colors,
+	// only store them as custom data if at least one instance has them
+	auto GetInstanceColor = [](UStaticMeshComponent* InSMC, FColor& OutColor)
+	{
+		if (InSMC->LODData.Num() <= 0)
+			return false;
+
+		const FColorVertexBuffer* OverrideVertexColors = InSMC->LODData[0].OverrideVertexColors;
+		if (!OverrideVertexColors || OverrideVertexColors->GetNumVertices() <= 0)
+			return false;
+
+		OutColor = OverrideVertexColors->VertexColor(0);
+		return true;
+	};
+
+	bool bHasInstanceColors = false;
+	for (UStaticMeshComponent* CurrentSMC : Instances)
+	{
+		FColor InstanceColor;
+		if (IsValid(CurrentSMC) && GetInstanceColor(CurrentSMC, InstanceColor))
+		{
+			bHasInstanceColors = true;
+			break;
+		}
+	}
+
+	// Instances using different override materials need to go in different components
+	struct FInstancedComponentGroup
+	{
+		TArray<UMaterialInterface*> Materials;
+		UInstancedStaticMeshComponent* Component = nullptr;
+	};
+	TArray<FInstancedComponentGroup> Groups;
+
+	const int32 MeshMaterialCount = InStaticMesh->StaticMaterials.Num();
+	const FTransform MSICTransform = InMSIC->GetComponentTransform();
+	for (UStaticMeshComponent* CurrentSMC : Instances)
+	{
+		if (!CurrentSMC || CurrentSMC->IsPendingKill())
+			continue;
+
+		TArray<UMaterialInterface*> Materials;
+		if (InOverrideMaterial)
+			Materials.Init(InOverrideMaterial, MeshMaterialCount);
+		else
+			Materials = CurrentSMC->OverrideMaterials;
+
+		FInstancedComponentGroup* Group = Groups.FindByPredicate([&Materials](const FInstancedComponentGroup& InGroup)
+		{
+			return InGroup.Materials == Materials;
+		});
+
+		if (!Group)
+		{
+			UClass* ComponentClass = UHierarchicalInstancedStaticMeshComponent::StaticClass();
+			UInstancedStaticMeshComponent* NewISMC = NewObject<UInstancedStaticMeshComponent>(
+				InActor,
+				ComponentClass,
+				FName(MakeUniqueObjectNameIfNeeded(InActor, ComponentClass, InMSIC->GetName())),
+				RF_Transactional);
+			if (!NewISMC)
+				continue;
+
+			// Copy properties from the first instance
+			CopyPropertyToNewActorAndComponent(InActor, NewISMC, CurrentSMC);
+			NewISMC->SetStaticMesh(InStaticMesh);
+			NewISMC->OverrideMaterials.Empty();
+			for (int32 Idx = 0; Idx < Materials.Num(); ++Idx)
+				NewISMC->SetMaterial(Idx, Materials[Idx]);
+
+			if (bHasInstanceColors)
+				NewISMC->SetNumCustomDataFloats(4);
+
+			InActor->AddInstanceComponent(NewISMC);
+			if (IsValid(InParentComponent))
+				NewISMC->AttachToComponent(InParentComponent, FAttachmentTransformRules::KeepRelativeTransform);
+			NewISMC->SetWorldTransform(MSICTransform);
+
+			Group = &Groups.AddDefaulted_GetRef();
+			Group->Materials = Materials;
+			Group->Component = NewISMC;
+			OutComponents.Add(NewISMC);
+		}
+
+		// Instance transforms are relative to the instanced component, which matches the MSIC's transform
+		const FTransform InstanceTransform = CurrentSMC->GetAttachParent() == InMSIC
+			? CurrentSMC->GetRelativeTransform()
+			: CurrentSMC->GetComponentTransform().GetRelativeTransform(MSICTransform);
+		const int32 InstanceIndex = Group->Component->AddInstance(InstanceTransform);
+
+		FColor InstanceColor = FColor::White;
+		if (bHasInstanceColors)
+		{
+			GetInstanceColor(CurrentSMC, InstanceColor);
+
+			// The colors were quantized from the linear color attribute without gamma correction
+			const FLinearColor LinearColor = InstanceColor.ReinterpretAsLinear();
+			Group->Component->SetCustomData(InstanceIndex, { LinearColor.R, LinearColor.G, LinearColor.B, LinearColor.A });
+		}
+	}
+
+	for (FInstancedComponentGroup& Group : Groups)
+	{
+		// Only register the component once all the instances are added, so its render and physics states are only created once
+		Group.Component->RegisterComponent();
+
+		UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(Group.Component);
+		if (HISMC)
+			HISMC->BuildTreeIfOutdated(false, true);
+	}
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_MSIC(
 	const UHoudiniAssetComponent* HoudiniAssetComponent,
@@ -2011,49 +2541,38 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_MSIC(
 	if (bSpawnedActor && IsValid(RootComponent))
 		RootComponent->SetWorldTransform(InTransform);
 
-	// Empty and reserve enough space in the baked components array for the new components
-	InBakedOutputObject.InstancedComponents.Empty(InMSIC->GetInstances().Num());
-	
-	// Now add s SMC component for each of the SMC's instance
-	for (UStaticMeshComponent* CurrentSMC : InMSIC->GetInstances())
-	{
-		if (!CurrentSMC || CurrentSMC->IsPendingKill())
-			continue;
+	UMaterialInterface* InstancerMaterial = DuplicatedMSICOverrideMaterials.Num() > 0 ? DuplicatedMSICOverrideMaterials[0] : nullptr;
 
-		UStaticMeshComponent* NewSMC = DuplicateObject<UStaticMeshComponent>(
-			CurrentSMC,
-			FoundActor,
-			FName(MakeUniqueObjectNameIfNeeded(FoundActor, CurrentSMC->GetClass(), CurrentSMC->GetName())));
-		if (!NewSMC || NewSMC->IsPendingKill())
-			continue;
+	// PDG work result outputs use the bake settings of their PDG asset link, other outputs the ones of the HAC
+	bool bBakeAsInstances = IsValid(HoudiniAssetComponent) && HoudiniAssetComponent->bBakeMeshSplitInstancersAsInstances;
+	const UHoudiniOutput* InstancerOutput = InAllOutputs.IsValidIndex(InOutputIndex) ? InAllOutputs[InOutputIndex] : nullptr;
+	const UHoudiniPDGAssetLink* PDGAssetLink = IsValid(InstancerOutput) ? Cast<UHoudiniPDGAssetLink>(InstancerOutput->GetOuter()) : nullptr;
+	if (IsValid(PDGAssetLink))
+		bBakeAsInstances = PDGAssetLink->bBakeMeshSplitInstancersAsInstances;
 
-		InBakedOutputObject.InstancedComponents.Add(FSoftObjectPath(NewSMC).ToString());
-		
-		NewSMC->RegisterComponent();
-		// NewSMC->SetupAttachment(nullptr);
-		NewSMC->SetStaticMesh(BakedStaticMesh);
-		FoundActor->AddInstanceComponent(NewSMC);
-		NewSMC->SetWorldTransform(CurrentSMC->GetComponentTransform());
+	// Create a SMC for each of the MSIC's instances, or a few instanced components holding all of them
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<UStaticMeshComponent*> NewComponents;
+	if (bBakeAsInstances)
+	{
+		CreateInstancedComponentsFromMeshSplitInstancer(
+			FoundActor, RootComponent, InMSIC, BakedStaticMesh, InstancerMaterial, NewComponents);
+	}
+	else
+	{
+		DuplicateMeshSplitInstancerComponents(
+			FoundActor, RootComponent, InMSIC, BakedStaticMesh, InstancerMaterial, NewComponents);
+	}
 
-		if (DuplicatedMSICOverrideMaterials.Num() > 0)
-		{
-			UMaterialInterface * InstancerMaterial = DuplicatedMSICOverrideMaterials[0];
-			if (InstancerMaterial)
-			{
-				NewSMC->OverrideMaterials.Empty();
-				int32 MeshMaterialCount = BakedStaticMesh->StaticMaterials.Num();
-				for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
-					NewSMC->SetMaterial(Idx, InstancerMaterial);
-			}
-		}
-		
-		if (IsValid(RootComponent))
-			NewSMC->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepWorldTransform);
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Bake: %d mesh split instances of %s baked to %d components on %s in %.3fs."),
+		InMSIC->GetInstances().Num(), *BakedStaticMesh->GetName(), NewComponents.Num(), *FoundActor->GetName(),
+		FPlatformTime::Seconds() - StartTime);
 
-		// TODO: Do we need to copy properties here, we duplicated the component
-		// // Copy properties from the existing component
-		// CopyPropertyToNewActorAndComponent(FoundActor, NewSMC, CurrentSMC);
-	}
+	// Record the new components in the baked output
+	InBakedOutputObject.InstancedComponents.Empty(NewComponents.Num());
+	for (UStaticMeshComponent* NewComponent : NewComponents)
+		InBakedOutputObject.InstancedComponents.Add(FSoftObjectPath(NewComponent).ToString());
 
 	if (bSpawnedActor)
 		FoundActor->FinishSpawning(InTransform);
@@ -2587,6 +3106,8 @@ FHoudiniEngineBakeUtils::CopyActorContentsToBlueprint(AActor * InActor, UBluepri
 bool 
 FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComponent, bool bInReplaceAssets, bool bInRecenterBakedActors) 
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	FHoudiniEngineOutputStats BakeStats;
 	TArray<UPackage*> PackagesToSave;
 	TArray<UBlueprint*> Blueprints;
@@ -2634,6 +3155,8 @@ FHoudiniEngineBakeUtils::BakeBlueprints(
 	TArray<UBlueprint*>& OutBlueprints,
 	TArray<UPackage*>& OutPackagesToSave)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
@@ -2697,6 +3220,8 @@ FHoudiniEngineBakeUtils::BakeStaticMesh(
 	const FDirectoryPath& InTempCookFolder,
 	TMap<UMaterialInterface *, UMaterialInterface *>& InOutAlreadyBakedMaterialsMap) 
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!StaticMesh || StaticMesh->IsPendingKill())
 		return nullptr;
 
@@ -3221,6 +3746,20 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 		}
 	}
 
+	// Look for an identical mesh that was already baked to the same folder
+	FString ContentHash;
+	if (PackageParams.ReplaceMode == EPackageReplaceMode::CreateNewAssets)
+	{
+		ContentHash = GetBakeContentHash(InStaticMesh);
+		UStaticMesh* BakedStaticMesh = Cast<UStaticMesh>(
+			FindBakedObjectWithContentHash(PackageParams.GetPackagePath(), UStaticMesh::StaticClass(), ContentHash));
+		if (IsValid(BakedStaticMesh))
+		{
+			FHoudiniBakeDedupeReportScope::Record(InStaticMesh, BakedStaticMesh);
+			return BakedStaticMesh;
+		}
+	}
+
 	// InStaticMesh is temporary and we didn't find a baked version of it in our current bake output, we need to bake it
 	
 	// If we have a previously baked static mesh, get the bake counter from it so that both replace and increment
@@ -3284,6 +3823,12 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 	FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
 		MeshPackage, DuplicatedStaticMesh,
 		HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *CreatedPackageName);
+	if (!ContentHash.IsEmpty())
+	{
+		FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+			MeshPackage, DuplicatedStaticMesh,
+			HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH, *ContentHash);
+	}
 
 	// See if we need to duplicate materials and textures.
 	TArray<FStaticMaterial>DuplicatedMaterials;
@@ -3348,10 +3893,10 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 
 	// Notify registry that we have created a new duplicate mesh.
 	if (!bFoundExistingMesh)
-		FAssetRegistryModule::AssetCreated(DuplicatedStaticMesh);
+		FHoudiniBakeNotificationScope::NotifyAssetCreated(DuplicatedStaticMesh);
 
 	// Dirty the static mesh package.
-	DuplicatedStaticMesh->MarkPackageDirty();
+	FHoudiniBakeNotificationScope::MarkPackageDirty(DuplicatedStaticMesh);
 
 	return DuplicatedStaticMesh;
 }
@@ -3579,7 +4124,7 @@ FHoudiniEngineBakeUtils::BakeCurve(
 	// world transform
 	DuplicatedSplineComponent->SetWorldTransform(InSplineComponent->GetComponentTransform());
 	
-	FAssetRegistryModule::AssetCreated(DuplicatedSplineComponent);
+	FHoudiniBakeNotificationScope::NotifyAssetCreated(DuplicatedSplineComponent);
 	DuplicatedSplineComponent->RegisterComponent();
 
 	OutSplineComponent = DuplicatedSplineComponent;
@@ -3742,8 +4287,8 @@ FHoudiniEngineBakeUtils::BakeInputHoudiniCurveToActor(
 
 	BakedUnrealSplineComponent->AttachToComponent(NewActor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
 
-	FAssetRegistryModule::AssetCreated(NewActor);
-	FAssetRegistryModule::AssetCreated(BakedUnrealSplineComponent);
+	FHoudiniBakeNotificationScope::NotifyAssetCreated(NewActor);
+	FHoudiniBakeNotificationScope::NotifyAssetCreated(BakedUnrealSplineComponent);
 	BakedUnrealSplineComponent->RegisterComponent();
 
 	// The default name will be based on the static mesh package, we would prefer it to be based on the Houdini asset
@@ -3907,6 +4452,21 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 	FHoudiniPackageParams MaterialPackageParams = ObjectPackageParams;
 	MaterialPackageParams.ObjectName = MaterialName;
 
+	// Look for an identical material that was already baked to the same folder
+	FString ContentHash;
+	if (MaterialPackageParams.ReplaceMode == EPackageReplaceMode::CreateNewAssets)
+	{
+		ContentHash = GetBakeContentHash(Material);
+		UMaterialInterface* BakedMaterial = Cast<UMaterialInterface>(
+			FindBakedObjectWithContentHash(MaterialPackageParams.GetPackagePath(), Material->GetClass(), ContentHash));
+		if (IsValid(BakedMaterial))
+		{
+			FHoudiniBakeDedupeReportScope::Record(Material, BakedMaterial);
+			InOutAlreadyBakedMaterialsMap.Add(Material, BakedMaterial);
+			return BakedMaterial;
+		}
+	}
+
 	// Check if there is a valid previous material. If so, get the bake counter for consistency in
 	// replace or iterative package naming
 	bool bIsPreviousBakeMaterialValid = IsValid(PreviousBakeMaterial);
@@ -3944,6 +4504,12 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 	FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
 		MaterialPackage, DuplicatedMaterial,
 		HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *CreatedMaterialName);
+	if (!ContentHash.IsEmpty())
+	{
+		FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+			MaterialPackage, DuplicatedMaterial,
+			HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH, *ContentHash);
+	}
 
 	// Retrieve and check various sampling expressions. If they contain textures, duplicate (and bake) them.
 	UMaterial * DuplicatedMaterialCast = Cast<UMaterial>(DuplicatedMaterial);
@@ -3964,10 +4530,10 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 	}
 
 	// Notify registry that we have created a new duplicate material.
-	FAssetRegistryModule::AssetCreated(DuplicatedMaterial);
+	FHoudiniBakeNotificationScope::NotifyAssetCreated(DuplicatedMaterial);
 
 	// Dirty the material package.
-	DuplicatedMaterial->MarkPackageDirty();
+	FHoudiniBakeNotificationScope::MarkPackageDirty(DuplicatedMaterial);
 
 	// Recompile the baked material
 	// DuplicatedMaterial->ForceRecompileForRendering();
@@ -4053,6 +4619,20 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
 		FHoudiniPackageParams TexturePackageParams = PackageParams;
 		TexturePackageParams.ObjectName = TexturePackageParams.ObjectName + "_" + GeneratedTextureName;
 
+		// Look for an identical texture that was already baked to the same folder
+		FString ContentHash;
+		if (TexturePackageParams.ReplaceMode == EPackageReplaceMode::CreateNewAssets)
+		{
+			ContentHash = GetBakeContentHash(Texture);
+			UTexture2D* BakedTexture = Cast<UTexture2D>(
+				FindBakedObjectWithContentHash(TexturePackageParams.GetPackagePath(), UTexture2D::StaticClass(), ContentHash));
+			if (IsValid(BakedTexture))
+			{
+				FHoudiniBakeDedupeReportScope::Record(Texture, BakedTexture);
+				return BakedTexture;
+			}
+		}
+
 		// Determine the bake counter of the previous bake's texture (if exists/valid) for naming consistency when
 		// replacing/iterating
 		bool bIsPreviousBakeTextureValid = IsValid(PreviousBakeTexture);
@@ -4086,12 +4666,18 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
 		FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
 			NewTexturePackage, DuplicatedTexture,
 			HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE, *TextureType);
+		if (!ContentHash.IsEmpty())
+		{
+			FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+				NewTexturePackage, DuplicatedTexture,
+				HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH, *ContentHash);
+		}
 
 		// Notify registry that we have created a new duplicate texture.
-		FAssetRegistryModule::AssetCreated(DuplicatedTexture);
+		FHoudiniBakeNotificationScope::NotifyAssetCreated(DuplicatedTexture);
 		
 		// Dirty the texture package.
-		DuplicatedTexture->MarkPackageDirty();
+		FHoudiniBakeNotificationScope::MarkPackageDirty(DuplicatedTexture);
 
 		OutCreatedPackages.Add(NewTexturePackage);
 	}
@@ -4099,6 +4685,154 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
 	return DuplicatedTexture;
 }
 
+FString
+FHoudiniEngineBakeUtils::GetBakeContentHash(UObject* InObject)
+{
+	if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(InObject))
+		return GetBakeContentHash(StaticMesh);
+	if (UMaterialInterface* Material = Cast<UMaterialInterface>(InObject))
+		return GetBakeContentHash(Material);
+	if (UTexture2D* Texture = Cast<UTexture2D>(InObject))
+		return GetBakeContentHash(Texture);
+
+	return FString();
+}
+
+FString
+FHoudiniEngineBakeUtils::GetBakeContentHash(UStaticMesh* InStaticMesh)
+{
+	if (!IsValid(InStaticMesh))
+		return FString();
+
+	FHoudiniBakeContentHashArchive Ar(InStaticMesh);
+
+	FString ClassName = InStaticMesh->GetClass()->GetName();
+	Ar << ClassName;
+
+	// Geometry and build settings of each LOD
+	int32 NumLODs = InStaticMesh->GetNumSourceModels();
+	Ar << NumLODs;
+	for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+		FMeshDescription* MeshDescription = InStaticMesh->GetMeshDescription(LODIndex);
+		if (!MeshDescription)
+			return FString();
+		Ar << *MeshDescription;
+
+		FStaticMeshSourceModel& SourceModel = InStaticMesh->GetSourceModel(LODIndex);
+		FMeshBuildSettings::StaticStruct()->SerializeItem(Ar, &SourceModel.BuildSettings, nullptr);
+		FMeshReductionSettings::StaticStruct()->SerializeItem(Ar, &SourceModel.ReductionSettings, nullptr);
+		Ar << SourceModel.ScreenSize.Default;
+	}
+
+	// Materials
+	for (FStaticMaterial& StaticMaterial : InStaticMesh->StaticMaterials)
+	{
+		UObject* MaterialInterface = StaticMaterial.MaterialInterface;
+		Ar << StaticMaterial.MaterialSlotName;
+		Ar << MaterialInterface;
+	}
+
+	// Lightmaps, collisions and sockets
+	Ar << InStaticMesh->LightMapResolution;
+	Ar << InStaticMesh->LightMapCoordinateIndex;
+	if (IsValid(InStaticMesh->BodySetup))
+	{
+		FKAggregateGeom::StaticStruct()->SerializeItem(Ar, &InStaticMesh->BodySetup->AggGeom, nullptr);
+		uint8 CollisionTraceFlag = (uint8)InStaticMesh->BodySetup->CollisionTraceFlag;
+		Ar << CollisionTraceFlag;
+	}
+	for (UStaticMeshSocket* Socket : InStaticMesh->Sockets)
+	{
+		UObject* SocketObject = Socket;
+		Ar << SocketObject;
+	}
+
+	return Ar.GetHash();
+}
+
+FString
+FHoudiniEngineBakeUtils::GetBakeContentHash(UMaterialInterface* InMaterial)
+{
+	if (!IsValid(InMaterial))
+		return FString();
+
+	// Hash the material's properties and expressions
+	FHoudiniBakeContentHashArchive Ar(InMaterial);
+	FString ClassName = InMaterial->GetClass()->GetName();
+	Ar << ClassName;
+	Ar.SerializeObject(InMaterial);
+
+	return Ar.GetHash();
+}
+
+FString
+FHoudiniEngineBakeUtils::GetBakeContentHash(UTexture2D* InTexture)
+{
+	if (!IsValid(InTexture))
+		return FString();
+
+	// Textures created by the material translator already have a hash of their image and parameters
+	UMetaData* MetaData = InTexture->GetOutermost()->GetMetaData();
+	if (MetaData && MetaData->HasValue(InTexture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH))
+		return MetaData->GetValue(InTexture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH);
+
+	// Otherwise, hash the source mips and the settings that change the built texture
+	FSHA1 Hash;
+	const int32 SizeX = InTexture->Source.GetSizeX();
+	const int32 SizeY = InTexture->Source.GetSizeY();
+	const int32 NumMips = InTexture->Source.GetNumMips();
+	const uint8 Format = (uint8)InTexture->Source.GetFormat();
+	Hash.Update((const uint8*)&SizeX, sizeof(SizeX));
+	Hash.Update((const uint8*)&SizeY, sizeof(SizeY));
+	Hash.Update((const uint8*)&NumMips, sizeof(NumMips));
+	Hash.Update(&Format, sizeof(Format));
+
+	const uint8 Settings[] = {
+		(uint8)InTexture->CompressionSettings, (uint8)InTexture->LODGroup, (uint8)InTexture->Filter,
+		(uint8)InTexture->AddressX, (uint8)InTexture->AddressY, (uint8)InTexture->SRGB };
+	Hash.Update(Settings, sizeof(Settings));
+
+	TArray64<uint8> MipData;
+	for (int32 MipIndex = 0; MipIndex < NumMips; MipIndex++)
+	{
+		if (!InTexture->Source.GetMipData(MipData, MipIndex))
+			return FString();
+		Hash.Update(MipData.GetData(), MipData.Num());
+	}
+
+	Hash.Final();
+	uint8 Digest[FSHA1::DigestSize];
+	Hash.GetHash(Digest);
+
+	return BytesToHex(Digest, FSHA1::DigestSize);
+}
+
+UObject*
+FHoudiniEngineBakeUtils::FindBakedObjectWithContentHash(const FString& InFolder, UClass* InClass, const FString& InContentHash)
+{
+	if (InContentHash.IsEmpty() || !InClass)
+		return nullptr;
+
+	// The content hash is exposed as an asset registry tag, for both the assets in memory and on disk
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(*InFolder));
+	Filter.ClassNames.Add(InClass->GetFName());
+	Filter.TagsAndValues.Add(HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH, InContentHash);
+
+	TArray<FAssetData> AssetDatas;
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.GetAssets(Filter, AssetDatas);
+	for (const FAssetData& AssetData : AssetDatas)
+	{
+		UObject* BakedObject = AssetData.GetAsset();
+		if (IsValid(BakedObject) && BakedObject->IsA(InClass))
+			return BakedObject;
+	}
+
+	return nullptr;
+}
+
 
 bool 
 FHoudiniEngineBakeUtils::DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent* HoudiniAssetComponent) 
@@ -4141,9 +4875,110 @@ FHoudiniEngineBakeUtils::SaveBakedPackages(TArray<UPackage*> & PackagesToSave, b
 		}
 	}
 
+	// Without source control there is nothing to check out: save the asset packages ourselves
+	// and let the editor handle the maps
+	if (!ISourceControlModule::Get().IsEnabled())
+	{
+		TArray<UPackage*> AssetPackagesToSave;
+		TArray<UPackage*> PackagesToPrompt;
+		for (UPackage* Package : PackagesToSave)
+		{
+			if (!IsValid(Package))
+				continue;
+
+			if (Package->ContainsMap())
+				PackagesToPrompt.AddUnique(Package);
+			else
+				AssetPackagesToSave.AddUnique(Package);
+		}
+
+		TArray<UPackage*> UnsavedPackages;
+		if (!SaveBakedPackagesNonInteractive(AssetPackagesToSave, UnsavedPackages))
+		{
+			// Let the user save (or discard) the packages that failed to save or were skipped by a cancel
+			for (UPackage* Package : UnsavedPackages)
+			{
+				HOUDINI_LOG_WARNING(TEXT("Baked package %s was not saved, prompting to save it."), *Package->GetName());
+				PackagesToPrompt.AddUnique(Package);
+			}
+		}
+
+		if (PackagesToPrompt.Num() > 0)
+			FEditorFileUtils::PromptForCheckoutAndSave(PackagesToPrompt, true, false);
+
+		return;
+	}
+
 	FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false);
 }
 
+bool
+FHoudiniEngineBakeUtils::SaveBakedPackagesNonInteractive(
+	const TArray<UPackage*>& InPackagesToSave, TArray<UPackage*>& OutUnsavedPackages, bool bInShowProgress)
+{
+	// Only save the dirty packages, like PromptForCheckoutAndSave
+	TArray<UPackage*> DirtyPackages;
+	for (UPackage* Package : InPackagesToSave)
+	{
+		if (IsValid(Package) && Package->IsDirty())
+			DirtyPackages.AddUnique(Package);
+	}
+
+	if (DirtyPackages.Num() <= 0)
+		return true;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FScopedSlowTask Progress(DirtyPackages.Num(), FText::FromString(TEXT("Saving baked packages...")));
+	if (bInShowProgress)
+		Progress.MakeDialog(/*bShowCancelButton=*/true);
+
+	int32 NumSaved = 0;
+	int32 NumFailed = 0;
+	bool bCancelled = false;
+	for (UPackage* Package : DirtyPackages)
+	{
+		if (bCancelled || Progress.ShouldCancel())
+		{
+			bCancelled = true;
+			OutUnsavedPackages.Add(Package);
+			continue;
+		}
+
+		Progress.EnterProgressFrame(1.0f, FText::FromString(FString::Printf(
+			TEXT("Saving %s (%d / %d)"), *Package->GetName(), NumSaved + NumFailed + 1, DirtyPackages.Num())));
+
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(
+			Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+		// The package is serialized here, and its file is written by the async writer
+		// while the next packages are being serialized
+		const bool bSaved = UPackage::SavePackage(
+			Package, nullptr, RF_Standalone, *PackageFilename, GError, nullptr, false, true,
+			SAVE_NoError | SAVE_Async, nullptr, FDateTime::MinValue(), false);
+
+		if (bSaved)
+		{
+			NumSaved++;
+		}
+		else
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to save baked package %s to %s"), *Package->GetName(), *PackageFilename);
+			OutUnsavedPackages.Add(Package);
+			NumFailed++;
+		}
+	}
+
+	// Make sure all the files are on disk before returning
+	UPackage::WaitForAsyncFileWrites();
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Saved %d baked packages in %.3f seconds (%d failed%s)."),
+		NumSaved, FPlatformTime::Seconds() - StartTime, NumFailed, bCancelled ? TEXT(", cancelled") : TEXT(""));
+
+	return !bCancelled && NumFailed == 0;
+}
+
 bool
 FHoudiniEngineBakeUtils::FindOutputObject(const UObject* InObjectToFind, EHoudiniOutputType InOutputType, const TArray<UHoudiniOutput*> InOutputs, int32& OutOutputIndex, FHoudiniOutputObjectIdentifier &OutIdentifier)
 {
@@ -4325,7 +5160,7 @@ FHoudiniEngineBakeUtils::CopyPropertyToNewActorAndComponent(
 			*(InSMC->GetName()),
 			*(NewSMC->GetClass()->GetName()));
 
-		NewSMC->PostEditChange();
+		FHoudiniBakeNotificationScope::PostEditChange(NewSMC);
 		return;
 	}
 
@@ -4335,12 +5170,18 @@ FHoudiniEngineBakeUtils::CopyPropertyToNewActorAndComponent(
 	AActor* SourceActor = InSMC->GetOwner();
 	if (!IsValid(SourceActor))
 	{
-		NewSMC->PostEditChange();
+		FHoudiniBakeNotificationScope::PostEditChange(NewSMC);
 		return;
 	}
 
+	// When baking in a notification scope, the actor is post-edit-changed once at the end of the bake instead
+	// of once per copied property
+	const bool bDeferActorPostEditChange = FHoudiniBakeNotificationScope::IsActive() && IsValid(NewActor);
+
 	TArray<UObject*> ModifiedObjects;
-	const EditorUtilities::FCopyOptions Options(EditorUtilities::ECopyOptions::CallPostEditChangeProperty);
+	const EditorUtilities::FCopyOptions Options(bDeferActorPostEditChange
+		? EditorUtilities::ECopyOptions::Default
+		: EditorUtilities::ECopyOptions::CallPostEditChangeProperty);
 	// Copy component properties
 	for( FProperty* Property = ComponentClass->PropertyLink; Property != nullptr; Property = Property->PropertyLinkNext )
 	{
@@ -4406,7 +5247,10 @@ FHoudiniEngineBakeUtils::CopyPropertyToNewActorAndComponent(
 		NewSMC->SetWorldTransform(InSMC->GetComponentTransform());
 	}
 
-	NewSMC->PostEditChange();
+	if (bDeferActorPostEditChange && ModifiedObjects.Num() > 0)
+		FHoudiniBakeNotificationScope::PostEditChange(NewActor);
+
+	FHoudiniBakeNotificationScope::PostEditChange(NewSMC);
 };
 
 bool
@@ -4484,8 +5328,6 @@ FHoudiniEngineBakeUtils::GetOutputFolderPath(UObject* InOutputOwner)
 void
 FHoudiniEngineBakeUtils::RenameAsset(UObject* InAsset, const FString& InNewName, bool bMakeUniqueIfNotUnique)
 {
-	FAssetToolsModule& AssetToolsModule = FModuleManager::GetModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-
 	const FSoftObjectPath OldPath = FSoftObjectPath(InAsset);
 
 	FString NewName;
@@ -4497,12 +5339,7 @@ FHoudiniEngineBakeUtils::RenameAsset(UObject* InAsset, const FString& InNewName,
 	FHoudiniEngineUtils::RenameObject(InAsset, *NewName);
 
 	const FSoftObjectPath NewPath = FSoftObjectPath(InAsset);
-	if (OldPath != NewPath)
-	{
-		TArray<FAssetRenameData> RenameData;
-		RenameData.Add(FAssetRenameData(OldPath, NewPath, true));
-		AssetToolsModule.Get().RenameAssets(RenameData);
-	}
+	FHoudiniBakeNotificationScope::NotifyObjectRenamed(OldPath, NewPath);
 }
 
 void
@@ -4510,8 +5347,6 @@ FHoudiniEngineBakeUtils::RenameAndRelabelActor(AActor* InActor, const FString& I
 {
 	if (!IsValid(InActor))
 		return;
-	
-	FAssetToolsModule& AssetToolsModule = FModuleManager::GetModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
 
 	const FSoftObjectPath OldPath = FSoftObjectPath(InActor);
 
@@ -4525,12 +5360,7 @@ FHoudiniEngineBakeUtils::RenameAndRelabelActor(AActor* InActor, const FString& I
 	FHoudiniEngineRuntimeUtils::SetActorLabel(InActor, NewName);
 	
 	const FSoftObjectPath NewPath = FSoftObjectPath(InActor);
-	if (OldPath != NewPath)
-	{
-		TArray<FAssetRenameData> RenameData;
-		RenameData.Add(FAssetRenameData(OldPath, NewPath, true));
-		AssetToolsModule.Get().RenameAssets(RenameData);
-	}
+	FHoudiniBakeNotificationScope::NotifyObjectRenamed(OldPath, NewPath);
 }
 
 bool
@@ -4579,6 +5409,8 @@ FHoudiniEngineBakeUtils::BakePDGWorkResultObject(
 	TArray<EHoudiniInstancerComponentType> const* InInstancerComponentTypesToBake,
 	const FString& InFallbackWorldOutlinerFolder)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!IsValid(InPDGAssetLink))
 		return false;
 
@@ -4822,6 +5654,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(
 	TArray<UPackage*>& OutPackagesToSave,
 	FHoudiniEngineOutputStats& OutBakeStats) 
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!InPDGAssetLink || InPDGAssetLink->IsPendingKill())
 		return false;
 
@@ -4890,6 +5724,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(
 bool
 FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors(UHoudiniPDGAssetLink* InPDGAssetLink, UTOPNode* InTOPNode, bool bInIsAutoBake, const EPDGBakePackageReplaceModeOption InPDGBakePackageReplaceMode, bool bInRecenterBakedActors)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	TArray<UPackage*> PackagesToSave;
 	FHoudiniEngineOutputStats BakeStats;
 	TArray<FHoudiniEngineBakedActor> BakedActors;
@@ -4940,6 +5776,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNetworkOutputsKeepActors(
 	TArray<UPackage*>& OutPackagesToSave,
 	FHoudiniEngineOutputStats& OutBakeStats)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!InPDGAssetLink || InPDGAssetLink->IsPendingKill())
 		return false;
 
@@ -4961,6 +5799,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNetworkOutputsKeepActors(
 bool
 FHoudiniEngineBakeUtils::BakePDGAssetLinkOutputsKeepActors(UHoudiniPDGAssetLink* InPDGAssetLink, const EPDGBakeSelectionOption InBakeSelectionOption, const EPDGBakePackageReplaceModeOption InPDGBakePackageReplaceMode, bool bInRecenterBakedActors)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!InPDGAssetLink || InPDGAssetLink->IsPendingKill())
 		return false;
 
@@ -5040,6 +5880,8 @@ FHoudiniEngineBakeUtils::BakeBlueprintsFromBakedActors(
 	TArray<UBlueprint*>& OutBlueprints,
 	TArray<UPackage*>& OutPackagesToSave)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	// // Clear selection
 	// if (GEditor)
 	// {
@@ -5267,6 +6109,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(
 	TArray<UPackage*>& OutPackagesToSave,
 	FHoudiniEngineOutputStats& OutBakeStats)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	TArray<AActor*> BPActors;
 
 	if (!IsValid(InPDGAssetLink))
@@ -5318,6 +6162,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(
 bool
 FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAssetLink, UTOPNode* InTOPNode, bool bInIsAutoBake, const EPDGBakePackageReplaceModeOption InPDGBakePackageReplaceMode, bool bInRecenterBakedActors)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	TArray<UBlueprint*> Blueprints;
 	TArray<UPackage*> PackagesToSave;
 	FHoudiniEngineOutputStats BakeStats;
@@ -5370,6 +6216,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNetworkBlueprints(
 	TArray<UPackage*>& OutPackagesToSave,
 	FHoudiniEngineOutputStats& OutBakeStats)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	if (!InPDGAssetLink || InPDGAssetLink->IsPendingKill())
 		return false;
 
@@ -5392,6 +6240,8 @@ FHoudiniEngineBakeUtils::BakePDGTOPNetworkBlueprints(
 bool
 FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGAssetLink, const EPDGBakeSelectionOption InBakeSelectionOption, const EPDGBakePackageReplaceModeOption InPDGBakePackageReplaceMode, bool bInRecenterBakedActors)
 {
+	FHoudiniBakeDedupeReportScope DedupeReportScope;
+
 	TArray<UBlueprint*> Blueprints;
 	TArray<UPackage*> PackagesToSave;
 	FHoudiniEngineOutputStats BakeStats;
@@ -40,6 +40,9 @@ class UWorld;
 class AActor;
 class UHoudiniSplineComponent;
 class UStaticMeshComponent;
+class UHoudiniMeshSplitInstancerComponent;
+class USceneComponent;
+class UMaterialInterface;
 class UHoudiniPDGAssetLink;
 class UTOPNetwork;
 class UTOPNode;
@@ -141,6 +144,39 @@ struct HOUDINIENGINEEDITOR_API FHoudiniEngineBakedActor
 
 };
 
+// Defers the asset registry and editor notifications sent while baking, and sends them in one batch when
+// the outermost scope ends: created assets are registered, references to renamed objects are fixed up in one
+// pass, and each object is post-edit-changed and each package marked dirty only once.
+// Without an active scope, the notifications are sent immediately.
+class HOUDINIENGINEEDITOR_API FHoudiniBakeNotificationScope
+{
+public:
+	FHoudiniBakeNotificationScope();
+	~FHoudiniBakeNotificationScope();
+
+	static bool IsActive() { return ScopeDepth > 0; }
+
+	// Notifies the asset registry that InAsset was created
+	static void NotifyAssetCreated(UObject* InAsset);
+	// Fixes up the soft references to an object that has already been renamed from InOldPath to InNewPath
+	static void NotifyObjectRenamed(const FSoftObjectPath& InOldPath, const FSoftObjectPath& InNewPath);
+	// Calls PostEditChange on InObject
+	static void PostEditChange(UObject* InObject);
+	// Marks InObject's package as dirty
+	static void MarkPackageDirty(UObject* InObject);
+
+private:
+	static void SendDeferredNotifications();
+
+	static int32 ScopeDepth;
+	static double ScopeStartTime;
+	static TArray<TWeakObjectPtr<UObject>> CreatedAssets;
+	static TArray<TPair<FSoftObjectPath, FSoftObjectPath>> RenamedObjects;
+	static TArray<TWeakObjectPtr<UObject>> ChangedObjects;
+	static TSet<TWeakObjectPtr<UObject>> ChangedObjectsSet;
+	static TSet<TWeakObjectPtr<UPackage>> DirtyPackages;
+};
+
 struct HOUDINIENGINEEDITOR_API FHoudiniEngineBakeUtils
 {
 public:
@@ -288,6 +324,27 @@ public:
 		AActor* InFallbackActor=nullptr,
 		const FString& InFallbackWorldOutlinerFolder="");
 
+	// Duplicates each instance component of the mesh split instancer to InActor, attached to InParentComponent.
+	// If InOverrideMaterial is valid, it is applied to all the material slots of the duplicated components.
+	static void DuplicateMeshSplitInstancerComponents(
+		AActor* InActor,
+		USceneComponent* InParentComponent,
+		UHoudiniMeshSplitInstancerComponent* InMSIC,
+		UStaticMesh* InStaticMesh,
+		UMaterialInterface* InOverrideMaterial,
+		TArray<UStaticMeshComponent*>& OutComponents);
+
+	// Creates hierarchical instanced static mesh components on InActor holding the mesh split
+	// instancer's instances: one component per distinct set of override materials.
+	// Per-instance colors are stored as 4 per-instance custom data floats (linear RGBA).
+	static void CreateInstancedComponentsFromMeshSplitInstancer(
+		AActor* InActor,
+		USceneComponent* InParentComponent,
+		UHoudiniMeshSplitInstancerComponent* InMSIC,
+		UStaticMesh* InStaticMesh,
+		UMaterialInterface* InOverrideMaterial,
+		TArray<UStaticMeshComponent*>& OutComponents);
+
 	static bool BakeInstancerOutputToActors_SMC(
 		const UHoudiniAssetComponent* HoudiniAssetComponent,
 		int32 InOutputIndex,
@@ -337,6 +394,17 @@ public:
 		const FHoudiniPackageParams& PackageParams,
 		TArray<UPackage*> & OutCreatedPackages);
 
+	// Returns a hash of the content of a mesh, material or texture that is about to be baked.
+	// Houdini generated materials and textures referenced by the object are hashed by content as well.
+	// Returns an empty string if the object's content couldn't be hashed.
+	static FString GetBakeContentHash(UObject* InObject);
+	static FString GetBakeContentHash(UStaticMesh* InStaticMesh);
+	static FString GetBakeContentHash(UMaterialInterface* InMaterial);
+	static FString GetBakeContentHash(UTexture2D* InTexture);
+
+	// Looks in InFolder for an asset of class InClass that was baked from an object with the same content hash.
+	static UObject* FindBakedObjectWithContentHash(const FString& InFolder, UClass* InClass, const FString& InContentHash);
+
 	// Bake a Houdini asset component (InHACToBake) based on the bInReplace and BakeOption arguments.
 	// Returns true if the underlying bake function (for example, BakeHoudiniActorToActors, returns true (or a valid UObject*))
 	static bool BakeHoudiniAssetComponent(
@@ -475,6 +543,13 @@ public:
 
 	static void SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld = false);
 
+	// Saves the dirty asset packages in InPackagesToSave without prompting for checkout or confirmation.
+	// Packages are serialized one after the other and their files are written asynchronously.
+	// Returns false if the save was cancelled or if any package failed to save, OutUnsavedPackages then contains
+	// the dirty packages that failed to save or were skipped because of the cancel.
+	static bool SaveBakedPackagesNonInteractive(
+		const TArray<UPackage*>& InPackagesToSave, TArray<UPackage*>& OutUnsavedPackages, bool bInShowProgress = true);
+
 	// Look for InObjectToFind among InOutputs. Return true if found and set OutOutputIndex and OutIdentifier.
 	static bool FindOutputObject(
 		const UObject* InObjectToFind, EHoudiniOutputType InOutputType, const TArray<UHoudiniOutput*> InOutputs, int32& OutOutputIndex, FHoudiniOutputObjectIdentifier &OutIdentifier);
@@ -863,6 +863,39 @@ FHoudiniEngineDetails::CreateBakeWidgets(
         ]
     ];
 
+	LeftColumnVerticalBox->AddSlot()
+    .AutoHeight()
+    .Padding(0.0f, 0.0f, 0.0f, 3.5f)
+    [
+        SNew(SBox)
+        .WidthOverride(160.f)
+        [
+            SNew(SCheckBox)
+            .Content()
+            [
+                SNew(STextBlock).Text(LOCTEXT("HoudiniEngineUIBakeMeshSplitInstancersAsInstancesCheckBox", "Bake Split Instancers As Instances"))
+                .ToolTipText(LOCTEXT("HoudiniEngineUIBakeMeshSplitInstancersAsInstancesCheckBoxToolTip", "Bake instancers with per-instance colors to hierarchical instanced static mesh components, storing the colors as per-instance custom data, instead of creating one static mesh component per instance."))
+                .Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+            ]
+            .IsChecked_Lambda([MainHAC]()
+            {
+                return MainHAC->bBakeMeshSplitInstancersAsInstances ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+            })
+            .OnCheckStateChanged_Lambda([MainHAC, InHACs](ECheckBoxState NewState)
+            {
+                const bool bNewState = (NewState == ECheckBoxState::Checked);
+
+                for (auto & NextHAC : InHACs) 
+                {
+                    if (!NextHAC || NextHAC->IsPendingKill())
+                    	continue;
+
+                    NextHAC->bBakeMeshSplitInstancersAsInstances = bNewState;
+                }
+            })
+        ]
+    ];
+
 	// TODO: find a better way to manage the initial binding/unbinding of the post cook bake delegate
 	// We do this here to ensure the delegate is bound/unbound correctly when the UI is initially drawn
 	// Currently we have the problem that the HoudiniEngineRuntime and HoudiniEngine modules cannot access
@@ -137,6 +137,9 @@ void FHoudiniEngineEditor::StartupModule()
 	// PreSaveWorld and PreBeginPIE, for HoudiniStaticMesh -> UStaticMesh builds
 	RegisterEditorDelegates();
 
+	// Expose the content hash of baked assets to the asset registry, so identical bakes can be found
+	UObject::GetMetaDataTagsForAssetRegistry().Add(HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH);
+
 	// Store the instance.
 	FHoudiniEngineEditor::HoudiniEngineEditorInstance = this;
 
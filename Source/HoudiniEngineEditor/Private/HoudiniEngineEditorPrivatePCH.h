@@ -43,6 +43,9 @@
 #define HAPI_UNREAL_ONLINE_DOC_URL								TEXT("https://www.sidefx.com/docs/unreal/")
 #define HAPI_UNREAL_ONLINE_FORUM_URL							TEXT("https://www.sidefx.com/forum/51/")
 
+// Meta information stored in baked packages, and exposed as an asset registry tag.
+#define HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH              TEXT( "HoudiniBakeContentHash" )
+
 
 //
 // Parameter UI constants
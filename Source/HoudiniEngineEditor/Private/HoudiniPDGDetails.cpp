@@ -647,6 +647,46 @@ FHoudiniPDGDetails::AddPDGCommandletStatus(
             })
         ]
     ];
+
+	// Worker pool throughput / queue depth row
+	InPDGCategory.AddCustomRow(FText::GetEmpty())
+	.WholeRowContent()
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.0f)
+		.Padding(2.0f, 0.0f)
+		.VAlign(VAlign_Center)
+		.HAlign(HAlign_Center)
+		[
+			SNew(STextBlock)
+			.Visibility_Lambda([]()
+			{
+				if (!FHoudiniEngineCommands::IsPDGCommandletEnabled())
+					return EVisibility::Collapsed;
+
+				return FHoudiniEngine::Get().IsPDGCommandletRunningOrConnected() ? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			.Text_Lambda([]()
+			{
+				return FText::FromString(GetPDGCommandletPoolStatsString());
+			})
+		]
+	];
+}
+
+FString
+FHoudiniPDGDetails::GetPDGCommandletPoolStatsString()
+{
+	const FHoudiniBGEOCommandletPoolStats Stats = FHoudiniEngine::Get().GetPDGCommandletPoolStats();
+	return FString::Printf(
+		TEXT("Importers: %d/%d connected | Queued: %d | In flight: %d | Imported: %d (%.1f/s)"),
+		Stats.NumConnectedWorkers,
+		Stats.NumWorkers,
+		Stats.NumQueuedImports,
+		Stats.NumInFlightImports,
+		Stats.NumCompletedImports,
+		Stats.ImportsPerSecond);
 }
 
 bool
@@ -2562,6 +2602,44 @@ FHoudiniPDGDetails::CreatePDGBakeWidgets(IDetailCategoryBuilder& InPDGCategory,
             })
         ]
     ];
+
+	LeftColumnVerticalBox->AddSlot()
+    .AutoHeight()
+    .Padding(0.0f, 0.0f, 0.0f, 3.5f)
+    [
+        SNew(SBox)
+        .WidthOverride(160.f)
+        [
+            SNew(SCheckBox)
+            .Content()
+            [
+                SNew(STextBlock).Text(LOCTEXT("HoudiniEngineUIBakeMeshSplitInstancersAsInstancesCheckBox", "Bake Split Instancers As Instances"))
+                .ToolTipText(LOCTEXT("HoudiniEngineUIBakeMeshSplitInstancersAsInstancesCheckBoxToolTip", "Bake instancers with per-instance colors to hierarchical instanced static mesh components, storing the colors as per-instance custom data, instead of creating one static mesh component per instance."))
+                .Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+            ]
+            .IsChecked_Lambda([InPDGAssetLink]()
+            {
+                return InPDGAssetLink->bBakeMeshSplitInstancersAsInstances ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+            })
+            .OnCheckStateChanged_Lambda([InPDGAssetLink](ECheckBoxState NewState)
+            {
+                const bool bNewState = (NewState == ECheckBoxState::Checked);
+
+				// Record a transaction for undo/redo
+				FScopedTransaction Transaction(
+					TEXT(HOUDINI_MODULE_RUNTIME),
+					LOCTEXT("HoudiniPDGAssetLinkParameterChange", "Houdini PDG Asset Link Parameter: Changing a value"),
+					InPDGAssetLink);
+			
+				InPDGAssetLink->Modify();
+                InPDGAssetLink->bBakeMeshSplitInstancersAsInstances = bNewState;
+            	
+				// Notify that we have changed the property
+				FHoudiniEngineEditorUtils::NotifyPostEditChangeProperty(
+					GET_MEMBER_NAME_STRING_CHECKED(UHoudiniPDGAssetLink, bBakeMeshSplitInstancersAsInstances), InPDGAssetLink);
+            })
+        ]
+    ];
 	
 	RightColumnVerticalBox->AddSlot()
     .AutoHeight()
@@ -108,6 +108,9 @@ class FHoudiniPDGDetails : public TSharedFromThis<FHoudiniPDGDetails, ESPMode::N
 		// Helper for getting the commandlet status text and color for the UI
 		static void GetPDGCommandletStatus(FString& OutStatusString, FLinearColor& OutStatusColor);
 
+		// Helper for getting the commandlet worker pool throughput / queue depth text for the UI
+		static FString GetPDGCommandletPoolStatsString();
+
 		// Helper to check if the asset link state is Linked
 		static FORCEINLINE bool IsPDGLinked(UHoudiniPDGAssetLink* InPDGAssetLink)
 		{
@@ -49,6 +49,7 @@
 #include "HoudiniPublicAPI.h"
 #include "HoudiniPublicAPIBlueprintLib.h"
 #include "HoudiniPublicAPIInputTypes.h"
+#include "HoudiniPublicAPIProcessHDAVariantsNode.h"
 
 FHoudiniPublicAPIRampPoint::FHoudiniPublicAPIRampPoint()
 	: Position(0)
@@ -403,6 +404,42 @@ UHoudiniPublicAPIAssetWrapper::GetReplacePreviousBake_Implementation() const
 	return HAC->bReplacePreviousBake;
 }
 
+UHoudiniPublicAPIProcessHDAVariantsNode*
+UHoudiniPublicAPIAssetWrapper::ProcessVariants_Implementation(
+	const TArray<FHoudiniPublicAPIVariant>& InVariants,
+	const bool bInBakeVariants,
+	const FString& InBakeDirectoryPath,
+	const EHoudiniEngineBakeOption InBakeMethod,
+	const bool bInRecenterBakedActors)
+{
+	UHoudiniAssetComponent* HAC = nullptr;
+	if (!GetValidHoudiniAssetComponentWithError(HAC))
+		return nullptr;
+
+	if (InVariants.Num() <= 0)
+	{
+		SetErrorMessage(TEXT("No variants to process."));
+		return nullptr;
+	}
+
+	// The node reuses the instantiated asset as is, so it must not be instantiating or cooking already
+	if (HAC->GetAssetState() != EHoudiniAssetState::None)
+	{
+		SetErrorMessage(FString::Printf(
+			TEXT("Cannot process variants while the asset is in the %s state."), *(HAC->GetAssetStateAsString())));
+		return nullptr;
+	}
+
+	UHoudiniPublicAPIProcessHDAVariantsNode* Node = UHoudiniPublicAPIProcessHDAVariantsNode::ProcessVariantsWithExistingWrapper(
+		this, InVariants, bInBakeVariants, InBakeDirectoryPath, InBakeMethod, bInRecenterBakedActors);
+	if (!IsValid(Node))
+		return nullptr;
+
+	Node->Activate();
+
+	return Node;
+}
+
 bool
 UHoudiniPublicAPIAssetWrapper::GetValidHoudiniAssetActorWithError(AHoudiniAssetActor*& OutActor) const
 {
@@ -0,0 +1,596 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPublicAPIProcessHDAVariantsNode.h"
+
+#include "HoudiniPublicAPI.h"
+#include "HoudiniPublicAPIBlueprintLib.h"
+#include "HoudiniPublicAPIAssetWrapper.h"
+#include "HoudiniPublicAPIInputTypes.h"
+
+#include "HoudiniAssetComponent.h"
+#include "HoudiniOutput.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+
+UHoudiniPublicAPIProcessHDAVariantsNode::UHoudiniPublicAPIProcessHDAVariantsNode(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	if ( HasAnyFlags(RF_ClassDefaultObject) == false )
+	{
+		AddToRoot();
+	}
+
+	HoudiniAsset = nullptr;
+	InstantiateAt = FTransform::Identity;
+	WorldContextObject = nullptr;
+	SpawnInLevelOverride = nullptr;
+	NumInstances = 1;
+	bBakeVariants = true;
+	BakeDirectoryPath = FString();
+	BakeMethod = EHoudiniEngineBakeOption::ToActor;
+	bRecenterBakedActors = false;
+	bDeleteInstantiatedAssetsOnCompletion = true;
+	ExistingAssetWrapper = nullptr;
+	bRestoreAutoBake = false;
+
+	bAnyInstanceInstantiated = false;
+	bFinished = false;
+	NextVariantIndex = 0;
+	NumProcessedVariants = 0;
+	bHasDefaultParameters = false;
+	bHasDefaultInputs = false;
+}
+
+UHoudiniPublicAPIProcessHDAVariantsNode*
+UHoudiniPublicAPIProcessHDAVariantsNode::ProcessHDAVariants(
+	UHoudiniAsset* InHoudiniAsset,
+	const TArray<FHoudiniPublicAPIVariant>& InVariants,
+	const FTransform& InInstantiateAt,
+	UObject* InWorldContextObject,
+	ULevel* InSpawnInLevelOverride,
+	const int32 InNumInstances,
+	const bool bInBakeVariants,
+	const FString& InBakeDirectoryPath,
+	const EHoudiniEngineBakeOption InBakeMethod,
+	const bool bInRecenterBakedActors,
+	const bool bInDeleteInstantiatedAssetsOnCompletion)
+{
+	UHoudiniPublicAPIProcessHDAVariantsNode* Node = NewObject<UHoudiniPublicAPIProcessHDAVariantsNode>();
+	
+	Node->HoudiniAsset = InHoudiniAsset;
+	Node->Variants = InVariants;
+	Node->InstantiateAt = InInstantiateAt;
+	Node->WorldContextObject = InWorldContextObject;
+	Node->SpawnInLevelOverride = InSpawnInLevelOverride;
+	Node->NumInstances = InNumInstances;
+	Node->bBakeVariants = bInBakeVariants;
+	Node->BakeDirectoryPath = InBakeDirectoryPath;
+	Node->BakeMethod = InBakeMethod;
+	Node->bRecenterBakedActors = bInRecenterBakedActors;
+	Node->bDeleteInstantiatedAssetsOnCompletion = bInDeleteInstantiatedAssetsOnCompletion;
+
+	return Node;
+}
+
+UHoudiniPublicAPIProcessHDAVariantsNode*
+UHoudiniPublicAPIProcessHDAVariantsNode::ProcessVariantsWithExistingWrapper(
+	UHoudiniPublicAPIAssetWrapper* InAssetWrapper,
+	const TArray<FHoudiniPublicAPIVariant>& InVariants,
+	const bool bInBakeVariants,
+	const FString& InBakeDirectoryPath,
+	const EHoudiniEngineBakeOption InBakeMethod,
+	const bool bInRecenterBakedActors)
+{
+	if (!IsValid(InAssetWrapper))
+		return nullptr;
+
+	UHoudiniPublicAPIProcessHDAVariantsNode* Node = NewObject<UHoudiniPublicAPIProcessHDAVariantsNode>();
+
+	Node->ExistingAssetWrapper = InAssetWrapper;
+	Node->Variants = InVariants;
+	Node->NumInstances = 1;
+	Node->bBakeVariants = bInBakeVariants;
+	Node->BakeDirectoryPath = InBakeDirectoryPath;
+	Node->BakeMethod = InBakeMethod;
+	Node->bRecenterBakedActors = bInRecenterBakedActors;
+	// The asset belongs to the caller
+	Node->bDeleteInstantiatedAssetsOnCompletion = false;
+
+	return Node;
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::Activate()
+{
+	UHoudiniPublicAPI* API = UHoudiniPublicAPIBlueprintLib::GetAPI();
+	if (!IsValid(API) || (!IsValid(HoudiniAsset) && !IsValid(ExistingAssetWrapper)) || Variants.Num() <= 0)
+	{
+		HandleFailure();
+		return;
+	}
+
+	Results.SetNum(Variants.Num());
+	for (int32 VariantIndex = 0; VariantIndex < Variants.Num(); ++VariantIndex)
+		Results[VariantIndex].VariantIndex = VariantIndex;
+
+	// No point in instantiating more assets than we have variants
+	const int32 NumInstancesToCreate = IsValid(ExistingAssetWrapper) ? 1 : FMath::Clamp(NumInstances, 1, Variants.Num());
+	AssetWrappers.Reserve(NumInstancesToCreate);
+	CurrentVariantIndices.Init(INDEX_NONE, NumInstancesToCreate);
+	CurrentVariantStartTimes.Init(0.0, NumInstancesToCreate);
+	FailedInstances.Init(false, NumInstancesToCreate);
+
+	if (IsValid(ExistingAssetWrapper))
+	{
+		ActivateWithExistingWrapper();
+		return;
+	}
+
+	for (int32 InstanceIndex = 0; InstanceIndex < NumInstancesToCreate; ++InstanceIndex)
+	{
+		UHoudiniPublicAPIAssetWrapper* AssetWrapper = UHoudiniPublicAPIAssetWrapper::CreateEmptyWrapper(API);
+		if (!IsValid(AssetWrapper))
+		{
+			HandleFailure();
+			return;
+		}
+		AssetWrappers.Add(AssetWrapper);
+
+		AssetWrapper->GetOnPreInstantiationDelegate().AddDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePreInstantiation);
+		AssetWrapper->GetOnPostInstantiationDelegate().AddDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostInstantiation);
+		AssetWrapper->GetOnPostCookDelegate().AddDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostCook);
+		AssetWrapper->GetOnPostProcessingDelegate().AddDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostProcessing);
+
+		// Baking is driven by this node after each variant's cook, so keep auto bake disabled
+		if (!API->InstantiateAssetWithExistingWrapper(
+				AssetWrapper,
+				HoudiniAsset,
+				InstantiateAt,
+				WorldContextObject,
+				SpawnInLevelOverride,
+				true,
+				false,
+				BakeDirectoryPath,
+				BakeMethod,
+				false,
+				bRecenterBakedActors,
+				false))
+		{
+			HandleFailure();
+			return;
+		}
+
+		// The wrapper does not report failed instantiations, so watch the HAC's state directly
+		UHoudiniAssetComponent* HAC = AssetWrapper->GetHoudiniAssetComponent();
+		if (IsValid(HAC))
+			HAC->GetOnAssetStateChangeDelegate().AddUObject(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandleAssetStateChange);
+	}
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::ActivateWithExistingWrapper()
+{
+	UHoudiniAssetComponent* HAC = ExistingAssetWrapper->GetHoudiniAssetComponent();
+	if (!IsValid(HAC) || HAC->GetAssetState() != EHoudiniAssetState::None)
+	{
+		HandleFailure();
+		return;
+	}
+
+	AssetWrappers.Add(ExistingAssetWrapper);
+
+	// The asset is already instantiated, so only the cook and output events are of interest
+	ExistingAssetWrapper->GetOnPostCookDelegate().AddDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostCook);
+	ExistingAssetWrapper->GetOnPostProcessingDelegate().AddDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostProcessing);
+
+	// Baking is driven by this node after each variant's cook
+	bRestoreAutoBake = ExistingAssetWrapper->IsAutoBakeEnabled();
+	if (bRestoreAutoBake)
+		ExistingAssetWrapper->SetAutoBakeEnabled(false);
+
+	ExistingAssetWrapper->GetParameterTuples(DefaultParameters);
+	ExistingAssetWrapper->GetBakeFolder(DefaultBakeFolder);
+	bHasDefaultParameters = true;
+	ExistingAssetWrapper->GetInputsAtIndices(DefaultNodeInputs);
+	ExistingAssetWrapper->GetInputParameters(DefaultParameterInputs);
+	bHasDefaultInputs = true;
+	bAnyInstanceInstantiated = true;
+
+	if (AssignNextVariant(0, true))
+		ExistingAssetWrapper->Recook();
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::UnbindDelegates()
+{
+	for (UHoudiniPublicAPIAssetWrapper* AssetWrapper : AssetWrappers)
+	{
+		if (!IsValid(AssetWrapper))
+			continue;
+
+		AssetWrapper->GetOnPreInstantiationDelegate().RemoveDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePreInstantiation);
+		AssetWrapper->GetOnPostInstantiationDelegate().RemoveDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostInstantiation);
+		AssetWrapper->GetOnPostCookDelegate().RemoveDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostCook);
+		AssetWrapper->GetOnPostProcessingDelegate().RemoveDynamic(this, &UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostProcessing);
+
+		UHoudiniAssetComponent* HAC = AssetWrapper->GetHoudiniAssetComponent();
+		if (IsValid(HAC))
+			HAC->GetOnAssetStateChangeDelegate().RemoveAll(this);
+	}
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::ReleaseAssetWrappers(const bool bInDeleteInstantiatedAssets)
+{
+	UnbindDelegates();
+
+	if (bRestoreAutoBake && IsValid(ExistingAssetWrapper))
+		ExistingAssetWrapper->SetAutoBakeEnabled(true);
+	bRestoreAutoBake = false;
+
+	// Never delete an asset we did not instantiate
+	if (!bInDeleteInstantiatedAssets || IsValid(ExistingAssetWrapper))
+		return;
+
+	for (UHoudiniPublicAPIAssetWrapper* AssetWrapper : AssetWrappers)
+	{
+		if (IsValid(AssetWrapper))
+			AssetWrapper->DeleteInstantiatedAsset();
+	}
+}
+
+int32
+UHoudiniPublicAPIProcessHDAVariantsNode::GetInstanceIndex(UHoudiniPublicAPIAssetWrapper* InAssetWrapper) const
+{
+	const int32 InstanceIndex = AssetWrappers.IndexOfByKey(InAssetWrapper);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		HOUDINI_LOG_WARNING(
+			TEXT("[UHoudiniPublicAPIProcessHDAVariantsNode] Received delegate event from unexpected asset wrapper (%s)!"),
+			IsValid(InAssetWrapper) ? *(InAssetWrapper->GetName()) : TEXT(""));
+	}
+
+	return InstanceIndex;
+}
+
+bool
+UHoudiniPublicAPIProcessHDAVariantsNode::AssignNextVariant(const int32 InInstanceIndex, const bool bInSetInputs)
+{
+	const int32 PreviousVariantIndex = CurrentVariantIndices[InInstanceIndex];
+	CurrentVariantIndices[InInstanceIndex] = INDEX_NONE;
+	if (NextVariantIndex >= Variants.Num())
+		return false;
+
+	const int32 VariantIndex = NextVariantIndex++;
+	CurrentVariantIndices[InInstanceIndex] = VariantIndex;
+	CurrentVariantStartTimes[InInstanceIndex] = FPlatformTime::Seconds();
+
+	UHoudiniPublicAPIAssetWrapper* AssetWrapper = AssetWrappers[InInstanceIndex];
+	const FHoudiniPublicAPIVariant& Variant = Variants[VariantIndex];
+
+	// Undo what the previous variant of this instance changed, so that it does not leak into this one
+	if (Variants.IsValidIndex(PreviousVariantIndex))
+		ResetVariantOverrides(InInstanceIndex, PreviousVariantIndex, Variant);
+
+	FDirectoryPath VariantBakeDirectory;
+	VariantBakeDirectory.Path = Variant.BakeDirectoryPath.IsEmpty() ? BakeDirectoryPath : Variant.BakeDirectoryPath;
+	if (VariantBakeDirectory.Path.IsEmpty())
+		VariantBakeDirectory = DefaultBakeFolder;
+	if (!VariantBakeDirectory.Path.IsEmpty())
+		AssetWrapper->SetBakeFolder(VariantBakeDirectory);
+
+	if (Variant.Parameters.Num() > 0)
+		AssetWrapper->SetParameterTuples(Variant.Parameters);
+
+	if (bInSetInputs)
+	{
+		if (Variant.NodeInputs.Num() > 0)
+			AssetWrapper->SetInputsAtIndices(Variant.NodeInputs);
+		if (Variant.ParameterInputs.Num() > 0)
+			AssetWrapper->SetInputParameters(Variant.ParameterInputs);
+	}
+
+	return true;
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::ResetVariantOverrides(const int32 InInstanceIndex, const int32 InPreviousVariantIndex, const FHoudiniPublicAPIVariant& InNextVariant)
+{
+	UHoudiniPublicAPIAssetWrapper* AssetWrapper = AssetWrappers[InInstanceIndex];
+	const FHoudiniPublicAPIVariant& PreviousVariant = Variants[InPreviousVariantIndex];
+
+	// Only restore what the previous variant set and the next variant does not: the rest is either still at its
+	// default value or is about to be overwritten anyway
+	TMap<FName, FHoudiniParameterTuple> ParametersToRestore;
+	for (const auto& Entry : PreviousVariant.Parameters)
+	{
+		if (InNextVariant.Parameters.Contains(Entry.Key))
+			continue;
+		const FHoudiniParameterTuple* const DefaultValue = DefaultParameters.Find(Entry.Key);
+		if (DefaultValue)
+			ParametersToRestore.Add(Entry.Key, *DefaultValue);
+	}
+	if (ParametersToRestore.Num() > 0)
+		AssetWrapper->SetParameterTuples(ParametersToRestore);
+
+	TMap<int32, UHoudiniPublicAPIInput*> NodeInputsToRestore;
+	for (const auto& Entry : PreviousVariant.NodeInputs)
+	{
+		if (InNextVariant.NodeInputs.Contains(Entry.Key))
+			continue;
+		UHoudiniPublicAPIInput* const* const DefaultInput = DefaultNodeInputs.Find(Entry.Key);
+		if (DefaultInput && IsValid(*DefaultInput))
+			NodeInputsToRestore.Add(Entry.Key, *DefaultInput);
+	}
+	if (NodeInputsToRestore.Num() > 0)
+		AssetWrapper->SetInputsAtIndices(NodeInputsToRestore);
+
+	TMap<FName, UHoudiniPublicAPIInput*> ParameterInputsToRestore;
+	for (const auto& Entry : PreviousVariant.ParameterInputs)
+	{
+		if (InNextVariant.ParameterInputs.Contains(Entry.Key))
+			continue;
+		UHoudiniPublicAPIInput* const* const DefaultInput = DefaultParameterInputs.Find(Entry.Key);
+		if (DefaultInput && IsValid(*DefaultInput))
+			ParameterInputsToRestore.Add(Entry.Key, *DefaultInput);
+	}
+	if (ParameterInputsToRestore.Num() > 0)
+		AssetWrapper->SetInputParameters(ParameterInputsToRestore);
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::FinishCurrentVariant(const int32 InInstanceIndex, FHoudiniPublicAPIVariantResult& InResult)
+{
+	NumProcessedVariants++;
+
+	if (VariantCompleted.IsBound())
+		VariantCompleted.Broadcast(AssetWrappers[InInstanceIndex], InResult);
+
+	if (NumProcessedVariants >= Variants.Num())
+	{
+		CurrentVariantIndices[InInstanceIndex] = INDEX_NONE;
+		FinishIfAllVariantsProcessed();
+		return;
+	}
+
+	// Reuse the instantiated asset for the next variant: set its parameters / inputs and recook it. A failed variant
+	// does not stop the others: its result records the failure.
+	if (AssignNextVariant(InInstanceIndex, true))
+		AssetWrappers[InInstanceIndex]->Recook();
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::FailInstance(const int32 InInstanceIndex)
+{
+	if (FailedInstances[InInstanceIndex])
+		return;
+	FailedInstances[InInstanceIndex] = true;
+
+	const int32 VariantIndex = CurrentVariantIndices[InInstanceIndex];
+	CurrentVariantIndices[InInstanceIndex] = INDEX_NONE;
+	if (Results.IsValidIndex(VariantIndex))
+	{
+		Results[VariantIndex].bCookSuccess = false;
+		NumProcessedVariants++;
+		if (VariantCompleted.IsBound())
+			VariantCompleted.Broadcast(AssetWrappers[InInstanceIndex], Results[VariantIndex]);
+	}
+
+	// The remaining instances pick up the variants that are left, unless there are none
+	if (!FailedInstances.Contains(false))
+	{
+		while (NextVariantIndex < Variants.Num())
+		{
+			const int32 SkippedVariantIndex = NextVariantIndex++;
+			NumProcessedVariants++;
+			if (VariantCompleted.IsBound())
+				VariantCompleted.Broadcast(nullptr, Results[SkippedVariantIndex]);
+		}
+	}
+
+	FinishIfAllVariantsProcessed();
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::FinishIfAllVariantsProcessed()
+{
+	if (bFinished || NumProcessedVariants < Variants.Num())
+		return;
+
+	if (bAnyInstanceInstantiated)
+		HandleComplete();
+	else
+		HandleFailure();
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::HandleFailure()
+{
+	bFinished = true;
+
+	if (Failed.IsBound())
+		Failed.Broadcast(Results);
+
+	RemoveFromRoot();
+
+	// We only get here if nothing was cooked, so there are no variant outputs to preserve
+	ReleaseAssetWrappers(true);
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::HandleComplete()
+{
+	bFinished = true;
+
+	if (Completed.IsBound())
+		Completed.Broadcast(Results);
+
+	RemoveFromRoot();
+
+	ReleaseAssetWrappers(bDeleteInstantiatedAssetsOnCompletion);
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::HandleAssetStateChange(UHoudiniAssetComponent* InHAC, const EHoudiniAssetState InFromState, const EHoudiniAssetState InToState)
+{
+	// A failed instantiation sends the HAC back to NeedInstantiation, where it waits for a manual rebuild: none of
+	// the variants assigned to this instance would ever be processed
+	if (InToState != EHoudiniAssetState::NeedInstantiation)
+		return;
+	if (InFromState != EHoudiniAssetState::PreInstantiation && InFromState != EHoudiniAssetState::Instantiating)
+		return;
+
+	const int32 InstanceIndex = AssetWrappers.IndexOfByPredicate(
+		[InHAC](const UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+		{
+			return IsValid(InAssetWrapper) && InAssetWrapper->GetHoudiniAssetComponent() == InHAC;
+		});
+	if (InstanceIndex == INDEX_NONE)
+		return;
+
+	HOUDINI_LOG_WARNING(
+		TEXT("[UHoudiniPublicAPIProcessHDAVariantsNode] Failed to instantiate %s, its variants are processed by the remaining instances."),
+		IsValid(InHAC) ? *(InHAC->GetDisplayName()) : TEXT(""));
+
+	FailInstance(InstanceIndex);
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::HandlePreInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	const int32 InstanceIndex = GetInstanceIndex(InAssetWrapper);
+	if (InstanceIndex == INDEX_NONE)
+		return;
+
+	// All instances are of the same HDA, so the first one's default parameters are valid for all of them
+	if (!bHasDefaultParameters)
+	{
+		InAssetWrapper->GetParameterTuples(DefaultParameters);
+		InAssetWrapper->GetBakeFolder(DefaultBakeFolder);
+		bHasDefaultParameters = true;
+	}
+
+	// Set the parameters of the first variant before the first cook, inputs are set after instantiation
+	AssignNextVariant(InstanceIndex, false);
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	const int32 InstanceIndex = GetInstanceIndex(InAssetWrapper);
+	if (InstanceIndex == INDEX_NONE)
+		return;
+
+	bAnyInstanceInstantiated = true;
+
+	const int32 VariantIndex = CurrentVariantIndices[InstanceIndex];
+	if (!Variants.IsValidIndex(VariantIndex))
+		return;
+
+	if (!bHasDefaultInputs)
+	{
+		InAssetWrapper->GetInputsAtIndices(DefaultNodeInputs);
+		InAssetWrapper->GetInputParameters(DefaultParameterInputs);
+		bHasDefaultInputs = true;
+	}
+
+	const FHoudiniPublicAPIVariant& Variant = Variants[VariantIndex];
+	if (Variant.NodeInputs.Num() > 0)
+		InAssetWrapper->SetInputsAtIndices(Variant.NodeInputs);
+	if (Variant.ParameterInputs.Num() > 0)
+		InAssetWrapper->SetInputParameters(Variant.ParameterInputs);
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostCook(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const bool bInCookSuccess)
+{
+	const int32 InstanceIndex = GetInstanceIndex(InAssetWrapper);
+	if (InstanceIndex == INDEX_NONE)
+		return;
+
+	const int32 VariantIndex = CurrentVariantIndices[InstanceIndex];
+	if (!Results.IsValidIndex(VariantIndex))
+		return;
+
+	FHoudiniPublicAPIVariantResult& Result = Results[VariantIndex];
+	Result.bCookSuccess = bInCookSuccess;
+
+	// Outputs are not processed after a failed cook, so we won't get a post processing event for this variant
+	if (!bInCookSuccess)
+	{
+		Result.CookTimeSeconds = FPlatformTime::Seconds() - CurrentVariantStartTimes[InstanceIndex];
+		FinishCurrentVariant(InstanceIndex, Result);
+	}
+}
+
+void
+UHoudiniPublicAPIProcessHDAVariantsNode::HandlePostProcessing(UHoudiniPublicAPIAssetWrapper* InAssetWrapper)
+{
+	const int32 InstanceIndex = GetInstanceIndex(InAssetWrapper);
+	if (InstanceIndex == INDEX_NONE)
+		return;
+
+	const int32 VariantIndex = CurrentVariantIndices[InstanceIndex];
+	if (!Results.IsValidIndex(VariantIndex))
+		return;
+
+	FHoudiniPublicAPIVariantResult& Result = Results[VariantIndex];
+	const double CookEndTime = FPlatformTime::Seconds();
+	Result.CookTimeSeconds = CookEndTime - CurrentVariantStartTimes[InstanceIndex];
+
+	if (bBakeVariants)
+	{
+		// The bake saves the baked packages, so each variant is written out before moving on to the next one.
+		// Never replace the previous bake: each variant must produce its own assets.
+		Result.bBakeSuccess = InAssetWrapper->BakeAllOutputsWithSettings(BakeMethod, false, false, bRecenterBakedActors);
+		Result.BakeTimeSeconds = FPlatformTime::Seconds() - CookEndTime;
+
+		UHoudiniAssetComponent* HAC = InAssetWrapper->GetHoudiniAssetComponent();
+		if (Result.bBakeSuccess && IsValid(HAC))
+		{
+			for (const FHoudiniBakedOutput& BakedOutput : HAC->GetBakedOutputs())
+			{
+				for (const auto& Entry : BakedOutput.BakedOutputObjects)
+				{
+					UObject* BakedObject = Entry.Value.GetBakedObjectIfValid();
+					if (IsValid(BakedObject))
+						Result.BakedObjects.AddUnique(BakedObject);
+
+					AActor* BakedActor = Entry.Value.GetActorIfValid();
+					if (IsValid(BakedActor))
+						Result.BakedObjects.AddUnique(BakedActor);
+				}
+			}
+		}
+	}
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("[UHoudiniPublicAPIProcessHDAVariantsNode] Variant %d: cook %.3fs, bake %.3fs."),
+		VariantIndex, Result.CookTimeSeconds, Result.BakeTimeSeconds);
+
+	FinishCurrentVariant(InstanceIndex, Result);
+}
@@ -3,10 +3,44 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "HoudiniEditorTestUtils.h"
+#include "Tests/HoudiniCoreTests.h"
 
 #include "Core/Public/HAL/FileManager.h"
 #include "Misc/AutomationTest.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineBakeUtils.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniGeoImporter.h"
+#include "HoudiniInstanceTranslator.h"
+#include "HoudiniLandscapeTranslator.h"
+#include "HoudiniOutput.h"
+#include "HoudiniOutputTranslator.h"
+#include "HoudiniPackageParams.h"
+#include "HoudiniPublicAPIAssetWrapper.h"
+#include "HoudiniPublicAPIProcessHDAVariantsNode.h"
+
+#include "HoudiniMeshSplitInstancerComponent.h"
+
+#include "Async/ParallelFor.h"
+#include "ComponentReregisterContext.h"
+#include "FileHelpers.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Rendering/ColorVertexBuffer.h"
+#include "Serialization/ObjectWriter.h"
+#include "StaticMeshResources.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectHash.h"
 
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorEvergreenTest, "Houdini.Editor.EvergreenScreenshots", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
@@ -28,4 +62,897 @@ bool HoudiniEditorEvergreenTest::RunTest(const FString & Parameters)
 	return true;
 }
 
+// Can be run headless with:
+// UE4Editor-Cmd <Project> -ExecCmds="Automation RunTests Houdini.Editor.BakeSaveThroughput;Quit" -unattended -nullrhi
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorBakeSaveThroughputTest, "Houdini.Editor.BakeSaveThroughput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniEditorBakeSaveThroughputTest::RunTest(const FString & Parameters)
+{
+	const int32 NumPackages = 200;
+	const int32 TextureSize = 256;
+
+	const bool bSuccess = FHoudiniBenchmarkTestUtils::RunBenchmarkPasses(
+		this, nullptr,
+		FString::Printf(TEXT("Async bake save (%d packages)"), NumPackages),
+		[&](bool bAsyncSave)
+		{
+			const FString PackageFolder = FString::Printf(TEXT("/Game/HoudiniEngineTests/BakeSaveThroughput_%d"), bAsyncSave ? 1 : 0);
+
+			// Create packages holding some source texture data, like baked textures would
+			TArray<UPackage*> PackagesToSave;
+			TArray<uint8> TextureData;
+			TextureData.SetNumZeroed(TextureSize * TextureSize * 4);
+			for (int32 Index = 0; Index < NumPackages; Index++)
+			{
+				const FString TextureName = FString::Printf(TEXT("Texture_%d"), Index);
+				UPackage* Package = CreatePackage(*(PackageFolder + TEXT("/") + TextureName));
+				UTexture2D* Texture = NewObject<UTexture2D>(Package, *TextureName, RF_Public | RF_Standalone);
+				Texture->Source.Init(TextureSize, TextureSize, 1, 1, TSF_BGRA8, TextureData.GetData());
+				Package->MarkPackageDirty();
+				PackagesToSave.Add(Package);
+			}
+
+			// The baseline saves all the packages with the editor, like SaveBakedPackages does with source control
+			const double StartTime = FPlatformTime::Seconds();
+			if (bAsyncSave)
+				FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave);
+			else
+				FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false);
+			const double SaveTime = FPlatformTime::Seconds() - StartTime;
+
+			int32 NumSaved = 0;
+			for (UPackage* Package : PackagesToSave)
+			{
+				const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+				if (IFileManager::Get().FileExists(*Filename))
+					NumSaved++;
+			}
+			TestEqual(TEXT("Number of saved packages"), NumSaved, NumPackages);
+
+			// Clean up
+			for (UPackage* Package : PackagesToSave)
+			{
+				ForEachObjectWithPackage(Package, [](UObject* Object)
+				{
+					Object->ClearFlags(RF_Standalone);
+					return true;
+				});
+				Package->MarkPendingKill();
+			}
+			IFileManager::Get().DeleteDirectory(*FPackageName::LongPackageNameToFilename(PackageFolder), false, true);
+
+			return SaveTime;
+		});
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return bSuccess;
+}
+
+// Compares baking a mesh split instancer to one component per instance and to instanced components,
+// and checks that the instance colors are baked to the instanced components' per-instance custom data.
+// Can be run headless with:
+// UE4Editor-Cmd <Project> -ExecCmds="Automation RunTests Houdini.Editor.MeshSplitInstancerBakeCost;Quit" -unattended -nullrhi
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorMeshSplitInstancerBakeCostTest, "Houdini.Editor.MeshSplitInstancerBakeCost", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniEditorMeshSplitInstancerBakeCostTest::RunTest(const FString & Parameters)
+{
+	const int32 NumInstances = 20000;
+
+	UStaticMesh* StaticMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube static mesh"), StaticMesh))
+		return false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	if (!TestNotNull(TEXT("Test world"), World))
+		return false;
+
+	// Build a mesh split instancer with a scatter of instances
+	AActor* SourceActor = World->SpawnActor<AActor>();
+	UHoudiniMeshSplitInstancerComponent* MSIC = NewObject<UHoudiniMeshSplitInstancerComponent>(SourceActor);
+	SourceActor->SetRootComponent(MSIC);
+	MSIC->RegisterComponent();
+	MSIC->SetStaticMesh(StaticMesh);
+
+	TArray<FTransform> InstanceTransforms;
+	InstanceTransforms.SetNum(NumInstances);
+	for (int32 Index = 0; Index < NumInstances; Index++)
+		InstanceTransforms[Index].SetLocation(FVector((Index % 200) * 200.0f, (Index / 200) * 200.0f, 0.0f));
+
+	if (!TestTrue(TEXT("Set instance transforms"), MSIC->SetInstanceTransforms(InstanceTransforms)))
+		return false;
+
+	// Give each instance its own override vertex color, like the instance translator does for instance colors
+	TArray<UStaticMeshComponent*>& Instances = MSIC->GetInstancesForWrite();
+	if (!TestEqual(TEXT("Number of MSIC instances"), Instances.Num(), NumInstances))
+		return false;
+
+	if (!TestTrue(TEXT("Cube render data"), StaticMesh->RenderData && StaticMesh->RenderData->LODResources.Num() > 0))
+		return false;
+
+	const int32 NumVertices = StaticMesh->RenderData->LODResources[0].GetNumVertices();
+	TArray<FColor> InstanceColors;
+	InstanceColors.SetNum(NumInstances);
+	for (int32 Index = 0; Index < NumInstances; Index++)
+	{
+		InstanceColors[Index] = FColor(uint8(Index % 256), uint8((Index / 256) % 256), uint8(255 - Index % 256), 128);
+
+		UStaticMeshComponent* InstanceSMC = Instances[Index];
+		FComponentReregisterContext ComponentReregisterContext(InstanceSMC);
+		InstanceSMC->SetLODDataCount(1, 1);
+		FStaticMeshComponentLODInfo& LODInfo = InstanceSMC->LODData[0];
+		LODInfo.OverrideVertexColors = new FColorVertexBuffer;
+		LODInfo.OverrideVertexColors->InitFromSingleColor(InstanceColors[Index], NumVertices);
+		BeginInitResource(LODInfo.OverrideVertexColors);
+	}
+
+	const TCHAR* ModeNames[] = { TEXT("Components"), TEXT("HISMC") };
+	for (int32 Mode = 0; Mode < 2; Mode++)
+	{
+		AActor* BakedActor = World->SpawnActor<AActor>();
+		USceneComponent* RootComponent = NewObject<USceneComponent>(BakedActor);
+		BakedActor->SetRootComponent(RootComponent);
+		RootComponent->RegisterComponent();
+
+		TArray<UStaticMeshComponent*> Components;
+		const double BakeStartTime = FPlatformTime::Seconds();
+		if (Mode == 0)
+		{
+			FHoudiniEngineBakeUtils::DuplicateMeshSplitInstancerComponents(
+				BakedActor, RootComponent, MSIC, StaticMesh, nullptr, Components);
+		}
+		else
+		{
+			FHoudiniEngineBakeUtils::CreateInstancedComponentsFromMeshSplitInstancer(
+				BakedActor, RootComponent, MSIC, StaticMesh, nullptr, Components);
+		}
+		const double BakeTime = FPlatformTime::Seconds() - BakeStartTime;
+
+		// Serialize the actor and its subobjects, like saving the level would
+		TArray<UObject*> Objects;
+		Objects.Add(BakedActor);
+		GetObjectsWithOuter(BakedActor, Objects, true);
+
+		TArray<uint8> Bytes;
+		const double SerializeStartTime = FPlatformTime::Seconds();
+		FObjectWriter Writer(Bytes);
+		for (UObject* Object : Objects)
+			Object->Serialize(Writer);
+		const double SerializeTime = FPlatformTime::Seconds() - SerializeStartTime;
+
+		// Registering the components is the bulk of the cost of loading the actor in a level
+		BakedActor->UnregisterAllComponents();
+		const double RegisterStartTime = FPlatformTime::Seconds();
+		BakedActor->RegisterAllComponents();
+		const double RegisterTime = FPlatformTime::Seconds() - RegisterStartTime;
+
+		AddInfo(FString::Printf(
+			TEXT("%s: %d components, bake %.3f s, serialize %d bytes in %.3f s, register %.3f s"),
+			ModeNames[Mode], Components.Num(), BakeTime, Bytes.Num(), SerializeTime, RegisterTime));
+
+		int32 NumBakedInstances = 0;
+		for (UStaticMeshComponent* Component : Components)
+		{
+			UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(Component);
+			NumBakedInstances += ISMC ? ISMC->GetInstanceCount() : 1;
+		}
+		TestEqual(TEXT("Number of baked instances"), NumBakedInstances, NumInstances);
+
+		// The instances are laid out on a grid, so their location gives back their index and expected color
+		int32 NumColorMismatches = 0;
+		for (UStaticMeshComponent* Component : Components)
+		{
+			UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(Component);
+			if (!ISMC)
+				continue;
+
+			if (!TestEqual(TEXT("Number of custom data floats"), ISMC->NumCustomDataFloats, 4))
+				break;
+
+			for (int32 InstanceIndex = 0; InstanceIndex < ISMC->GetInstanceCount(); InstanceIndex++)
+			{
+				FTransform InstanceTransform;
+				ISMC->GetInstanceTransform(InstanceIndex, InstanceTransform);
+				const FVector Location = InstanceTransform.GetLocation();
+				const int32 Index = FMath::RoundToInt(Location.Y / 200.0f) * 200 + FMath::RoundToInt(Location.X / 200.0f);
+				if (!InstanceColors.IsValidIndex(Index))
+				{
+					NumColorMismatches++;
+					continue;
+				}
+
+				const FLinearColor Expected = InstanceColors[Index].ReinterpretAsLinear();
+				const float* CustomData = &ISMC->PerInstanceSMCustomData[InstanceIndex * 4];
+				if (!FMath::IsNearlyEqual(CustomData[0], Expected.R)
+					|| !FMath::IsNearlyEqual(CustomData[1], Expected.G)
+					|| !FMath::IsNearlyEqual(CustomData[2], Expected.B)
+					|| !FMath::IsNearlyEqual(CustomData[3], Expected.A))
+				{
+					NumColorMismatches++;
+				}
+			}
+		}
+		TestEqual(TEXT("Instances with mismatching custom data colors"), NumColorMismatches, 0);
+
+		World->DestroyActor(BakedActor);
+	}
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return true;
+}
+
+// Checks that identical meshes have the same bake content hash, and that baking them as new assets
+// to the same folder reuses the first baked mesh instead of creating a new one.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorBakeContentDedupeTest, "Houdini.Editor.BakeContentDedupe", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorBakeContentDedupeTest::RunTest(const FString & Parameters)
+{
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	UStaticMesh* SphereMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (!TestNotNull(TEXT("Cube static mesh"), CubeMesh) || !TestNotNull(TEXT("Sphere static mesh"), SphereMesh))
+		return false;
+
+	const FString TestFolder = TEXT("/Game/HoudiniEngineTests/BakeContentDedupe");
+	const FString TempFolder = TestFolder + TEXT("/Temp");
+
+	// Create temporary meshes, like the cooked outputs of a HAC: two identical ones and a different one
+	TArray<UPackage*> TestPackages;
+	auto CreateTempMesh = [&](UStaticMesh* InSourceMesh, const TCHAR* InName)
+	{
+		UPackage* Package = CreatePackage(*(TempFolder + TEXT("/") + InName));
+		TestPackages.Add(Package);
+		return DuplicateObject<UStaticMesh>(InSourceMesh, Package, InName);
+	};
+	UStaticMesh* TempMeshA = CreateTempMesh(CubeMesh, TEXT("MeshA"));
+	UStaticMesh* TempMeshB = CreateTempMesh(CubeMesh, TEXT("MeshB"));
+	UStaticMesh* TempMeshC = CreateTempMesh(SphereMesh, TEXT("MeshC"));
+
+	const FString HashA = FHoudiniEngineBakeUtils::GetBakeContentHash(TempMeshA);
+	const FString HashB = FHoudiniEngineBakeUtils::GetBakeContentHash(TempMeshB);
+	const FString HashC = FHoudiniEngineBakeUtils::GetBakeContentHash(TempMeshC);
+	TestFalse(TEXT("Content hash is not empty"), HashA.IsEmpty());
+	TestEqual(TEXT("Identical meshes have the same content hash"), HashA, HashB);
+	TestNotEqual(TEXT("Different meshes have different content hashes"), HashA, HashC);
+
+	// Bake the three meshes as new assets to the same folder
+	FHoudiniPackageParams PackageParams;
+	PackageParams.PackageMode = EPackageMode::Bake;
+	PackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+	PackageParams.BakeFolder = TestFolder + TEXT("/Bake");
+	PackageParams.TempCookFolder = TempFolder;
+	PackageParams.ObjectName = TEXT("BakedMesh");
+
+	const TArray<UHoudiniOutput*> ParentOutputs;
+	const TArray<FHoudiniEngineBakedActor> CurrentBakedActors;
+	TArray<UPackage*> CreatedPackages;
+	TMap<UMaterialInterface*, UMaterialInterface*> AlreadyBakedMaterials;
+	UStaticMesh* BakedMeshA = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
+		TempMeshA, nullptr, PackageParams, ParentOutputs, CurrentBakedActors, TempFolder, CreatedPackages, AlreadyBakedMaterials);
+	UStaticMesh* BakedMeshB = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
+		TempMeshB, nullptr, PackageParams, ParentOutputs, CurrentBakedActors, TempFolder, CreatedPackages, AlreadyBakedMaterials);
+	UStaticMesh* BakedMeshC = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
+		TempMeshC, nullptr, PackageParams, ParentOutputs, CurrentBakedActors, TempFolder, CreatedPackages, AlreadyBakedMaterials);
+
+	if (TestNotNull(TEXT("Baked mesh A"), BakedMeshA))
+	{
+		TestNotEqual(TEXT("Temporary mesh A is duplicated when baked"), BakedMeshA, TempMeshA);
+		TestEqual(TEXT("Identical mesh B reuses the baked mesh A"), BakedMeshB, BakedMeshA);
+		TestTrue(TEXT("Different mesh C is baked to a new mesh"), IsValid(BakedMeshC) && BakedMeshC != BakedMeshA);
+	}
+	TestEqual(TEXT("Number of created packages"), CreatedPackages.Num(), 2);
+
+	// Clean up
+	TestPackages.Append(CreatedPackages);
+	for (UPackage* Package : TestPackages)
+	{
+		ForEachObjectWithPackage(Package, [](UObject* Object)
+		{
+			Object->ClearFlags(RF_Standalone);
+			return true;
+		});
+		Package->MarkPendingKill();
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return true;
+}
+
+// Processes variants with an existing instantiated asset through UHoudiniPublicAPIAssetWrapper::ProcessVariants,
+// and checks that each variant gets its own result and that the asset is left alone afterwards.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorProcessVariantsTest, "Houdini.Editor.ProcessVariants", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorProcessVariantsTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this);
+
+	FHoudiniEditorTestUtils::InstantiateAsset(this, TEXT("/Game/TestHDAs/Evergreen"),
+		[=](UHoudiniAssetComponent * HAC, const bool IsSuccessful)
+		{
+			TStrongObjectPtr<UHoudiniPublicAPIAssetWrapper> AssetWrapper(
+				UHoudiniPublicAPIAssetWrapper::CreateWrapper(GetTransientPackage(), HAC));
+			if (!TestTrue(TEXT("Wrapped the instantiated asset"), AssetWrapper.IsValid()))
+				return;
+
+			TestNull(TEXT("No node without variants"), AssetWrapper->ProcessVariants(TArray<FHoudiniPublicAPIVariant>(), false));
+
+			const int32 NumVariants = 3;
+			TArray<FHoudiniPublicAPIVariant> Variants;
+			Variants.SetNum(NumVariants);
+			// An unknown parameter must not prevent the variant from cooking
+			Variants[1].Parameters.Add(TEXT("houdini_engine_test_unknown_parm"), FHoudiniParameterTuple(1));
+
+			const bool bAutoBakeWasEnabled = AssetWrapper->IsAutoBakeEnabled();
+			TStrongObjectPtr<UHoudiniPublicAPIProcessHDAVariantsNode> Node(AssetWrapper->ProcessVariants(Variants, false));
+			if (!TestTrue(TEXT("Started processing the variants"), Node.IsValid()))
+				return;
+
+			AddCommand(new FFunctionLatentCommand([=]()
+			{
+				if (!Node->IsFinished())
+					return false;
+
+				const TArray<FHoudiniPublicAPIVariantResult>& Results = Node->GetResults();
+				if (TestEqual(TEXT("One result per variant"), Results.Num(), NumVariants))
+				{
+					for (int32 VariantIndex = 0; VariantIndex < NumVariants; ++VariantIndex)
+					{
+						TestEqual(TEXT("Results are ordered by variant index"), Results[VariantIndex].VariantIndex, VariantIndex);
+						TestTrue(TEXT("Variant cooked"), Results[VariantIndex].bCookSuccess);
+						TestFalse(TEXT("Variant not baked"), Results[VariantIndex].bBakeSuccess);
+					}
+				}
+
+				TestTrue(TEXT("The existing asset is not deleted"), IsValid(HAC) && IsValid(HAC->GetOwner()));
+				TestEqual(TEXT("Auto bake setting is restored"), AssetWrapper->IsAutoBakeEnabled(), bAutoBakeWasEnabled);
+
+				return true;
+			}));
+		});
+
+	return true;
+}
+
+// Returns a sorted description of the output objects of a HAC, used to compare the results of output updates
+static TArray<FString> GetOutputObjectDescriptions(UHoudiniAssetComponent* HAC)
+{
+	TArray<FString> Descriptions;
+	for (UHoudiniOutput* Output : HAC->GetOutputs())
+	{
+		if (!IsValid(Output))
+			continue;
+
+		for (const auto& OutputObjectPair : Output->GetOutputObjects())
+		{
+			const FHoudiniOutputObjectIdentifier& Identifier = OutputObjectPair.Key;
+			const FHoudiniOutputObject& OutputObject = OutputObjectPair.Value;
+			Descriptions.Add(FString::Printf(TEXT("%d %d/%d/%d/%s %s %s"),
+				(int32)Output->GetType(), Identifier.ObjectId, Identifier.GeoId, Identifier.PartId, *Identifier.SplitIdentifier,
+				OutputObject.OutputObject ? *OutputObject.OutputObject->GetClass()->GetName() : TEXT("None"),
+				OutputObject.ProxyObject ? *OutputObject.ProxyObject->GetClass()->GetName() : TEXT("None")));
+		}
+	}
+	Descriptions.Sort();
+	return Descriptions;
+}
+
+// Checks that updating the outputs one work unit at a time (as the engine manager does over multiple ticks)
+// produces the same output objects as updating all the outputs at once.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorTimeSlicedOutputUpdateTest, "Houdini.Editor.TimeSlicedOutputUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorTimeSlicedOutputUpdateTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this);
+
+	FHoudiniEditorTestUtils::InstantiateAsset(this, TEXT("/Game/TestHDAs/Evergreen"),
+		[=](UHoudiniAssetComponent * HAC, const bool IsSuccessful)
+		{
+			if (!TestTrue(TEXT("Asset cooked"), IsSuccessful))
+				return;
+
+			bool bHasHoudiniStaticMeshOutput = false;
+			TestTrue(TEXT("Synchronous update"), FHoudiniOutputTranslator::UpdateOutputs(HAC, true, bHasHoudiniStaticMeshOutput));
+			const TArray<FString> SynchronousOutputs = GetOutputObjectDescriptions(HAC);
+			TestTrue(TEXT("Synchronous update created outputs"), SynchronousOutputs.Num() > 0);
+
+			FHoudiniOutputProcessingState ProcessingState;
+			if (!TestTrue(TEXT("Began the time-sliced update"), FHoudiniOutputTranslator::BeginUpdateOutputs(HAC, true, ProcessingState, true)))
+				return;
+
+			while (!FHoudiniOutputTranslator::ProcessNextOutput(HAC, ProcessingState));
+			TestTrue(TEXT("Ended the time-sliced update"), FHoudiniOutputTranslator::EndUpdateOutputs(HAC, ProcessingState, bHasHoudiniStaticMeshOutput));
+			TestFalse(TEXT("Processing state is closed"), ProcessingState.bIsValid);
+
+			TestEqual(TEXT("Time-sliced update creates the same outputs"), GetOutputObjectDescriptions(HAC), SynchronousOutputs);
+		});
+
+	return true;
+}
+
+// Checks that BGEO files are loaded in the importer's reusable node: consecutive loads use the same node,
+// which is kept when the file is closed, and the loaded geometry matches the geometry that was saved.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorReusableBGEONodeTest, "Houdini.Editor.ReusableBGEONode", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorReusableBGEONodeTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this);
+
+	FHoudiniEditorTestUtils::InstantiateAsset(this, TEXT("/Game/TestHDAs/Evergreen"),
+		[=](UHoudiniAssetComponent * HAC, const bool IsSuccessful)
+		{
+			if (!TestTrue(TEXT("Asset cooked"), IsSuccessful))
+				return;
+
+			const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+			HAPI_GeoInfo SourceGeoInfo;
+			FHoudiniApi::GeoInfo_Init(&SourceGeoInfo);
+			if (!TestTrue(TEXT("Got the asset's display geo"),
+				HAPI_RESULT_SUCCESS == FHoudiniApi::GetDisplayGeoInfo(Session, HAC->GetAssetId(), &SourceGeoInfo)))
+				return;
+
+			// Save the asset's geometry to a bgeo file
+			const FString BGEOFilePath = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("ReusableBGEONode.bgeo"));
+			IFileManager::Get().MakeDirectory(*FPaths::GetPath(BGEOFilePath), true);
+			if (!TestTrue(TEXT("Saved the bgeo file"),
+				HAPI_RESULT_SUCCESS == FHoudiniApi::SaveGeoToFile(Session, SourceGeoInfo.nodeId, TCHAR_TO_UTF8(*BGEOFilePath))))
+				return;
+
+			auto LoadAndCook = [&](HAPI_NodeId& OutNodeId, HAPI_GeoInfo& OutGeoInfo)
+			{
+				FHoudiniApi::GeoInfo_Init(&OutGeoInfo);
+				return UHoudiniGeoImporter::LoadBGEOFileInReusableNode(BGEOFilePath, TEXT("bgeo"), OutNodeId)
+					&& UHoudiniGeoImporter::CookFileNode(OutNodeId)
+					&& HAPI_RESULT_SUCCESS == FHoudiniApi::GetGeoInfo(Session, OutNodeId, &OutGeoInfo);
+			};
+
+			HAPI_NodeId FirstNodeId = -1;
+			HAPI_GeoInfo FirstGeoInfo;
+			if (!TestTrue(TEXT("First load"), LoadAndCook(FirstNodeId, FirstGeoInfo)))
+				return;
+			TestEqual(TEXT("Loaded geometry has the same parts"), FirstGeoInfo.partCount, SourceGeoInfo.partCount);
+			TestTrue(TEXT("Loaded in the reusable node"), UHoudiniGeoImporter::IsReusableBGEONode(FirstNodeId));
+
+			// Closing the file keeps the node for the next load
+			TestTrue(TEXT("Closed the file"), UHoudiniGeoImporter::CloseBGEOFile(FirstNodeId));
+			TestTrue(TEXT("Reusable node is kept"), FHoudiniEngineUtils::IsHoudiniNodeValid(FirstNodeId));
+
+			HAPI_NodeId SecondNodeId = -1;
+			HAPI_GeoInfo SecondGeoInfo;
+			if (TestTrue(TEXT("Second load"), LoadAndCook(SecondNodeId, SecondGeoInfo)))
+			{
+				TestEqual(TEXT("Second load reuses the node"), SecondNodeId, FirstNodeId);
+				TestEqual(TEXT("Reloaded geometry has the same parts"), SecondGeoInfo.partCount, SourceGeoInfo.partCount);
+			}
+
+			// Once forgotten, the node is deleted like any other node
+			UHoudiniGeoImporter::ResetReusableBGEONode();
+			TestFalse(TEXT("Node is no longer reusable"), UHoudiniGeoImporter::IsReusableBGEONode(FirstNodeId));
+			TestTrue(TEXT("Deleted the node"), UHoudiniGeoImporter::CloseBGEOFile(FirstNodeId));
+
+			IFileManager::Get().Delete(*BGEOFilePath);
+		});
+
+	return true;
+}
+
+// Checks that the strings resolved through the session string cache, one at a time or in batches,
+// match the strings returned by HAPI, before and after the cache is cleared.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorStringCacheTest, "Houdini.Editor.StringCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorStringCacheTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this);
+
+	FHoudiniEditorTestUtils::InstantiateAsset(this, TEXT("/Game/TestHDAs/Evergreen"),
+		[=](UHoudiniAssetComponent * HAC, const bool IsSuccessful)
+		{
+			if (!TestTrue(TEXT("Asset cooked"), IsSuccessful))
+				return;
+
+			const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+			HAPI_GeoInfo GeoInfo;
+			FHoudiniApi::GeoInfo_Init(&GeoInfo);
+			if (!TestTrue(TEXT("Got the asset's display geo"),
+				HAPI_RESULT_SUCCESS == FHoudiniApi::GetDisplayGeoInfo(Session, HAC->GetAssetId(), &GeoInfo)))
+				return;
+
+			// Use the point attribute names of the first part as test strings, with a duplicate handle
+			HAPI_PartInfo PartInfo;
+			FHoudiniApi::PartInfo_Init(&PartInfo);
+			if (!TestTrue(TEXT("Got the first part"),
+				HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(Session, GeoInfo.nodeId, 0, &PartInfo)))
+				return;
+
+			const int32 AttributeCount = PartInfo.attributeCounts[HAPI_ATTROWNER_POINT];
+			TArray<int32> StringHandles;
+			StringHandles.SetNum(AttributeCount);
+			if (!TestTrue(TEXT("Got the attribute names"), AttributeCount > 0 && HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeNames(
+				Session, GeoInfo.nodeId, 0, HAPI_ATTROWNER_POINT, StringHandles.GetData(), AttributeCount)))
+				return;
+			StringHandles.Add(StringHandles[0]);
+
+			// Resolve the strings directly with HAPI, without the cache
+			TArray<FString> ExpectedStrings;
+			for (const int32& StringHandle : StringHandles)
+			{
+				int32 BufferLength = 0;
+				FHoudiniApi::GetStringBufLength(Session, StringHandle, &BufferLength);
+				TArray<char> Buffer;
+				Buffer.SetNumZeroed(FMath::Max(BufferLength, 1));
+				FHoudiniApi::GetString(Session, StringHandle, Buffer.GetData(), BufferLength);
+				ExpectedStrings.Add(UTF8_TO_TCHAR(Buffer.GetData()));
+			}
+
+			FHoudiniEngineString::ClearStringCache();
+			for (int32 Pass = 0; Pass < 2; Pass++)
+			{
+				// The second pass resolves the strings from the cache
+				TArray<FString> BatchStrings;
+				TestTrue(TEXT("Resolved the strings in a batch"), FHoudiniEngineString::SHArrayToFStringArray(StringHandles, BatchStrings));
+				TestEqual(TEXT("Batch strings match HAPI's"), BatchStrings, ExpectedStrings);
+
+				FString SingleString;
+				TestTrue(TEXT("Resolved a single string"), FHoudiniEngineString::ToFString(StringHandles[0], SingleString));
+				TestEqual(TEXT("Single string matches HAPI's"), SingleString, ExpectedStrings[0]);
+			}
+
+			// Strings resolved one at a time after the cache was cleared
+			FHoudiniEngineString::ClearStringCache();
+			TArray<FString> SingleStrings;
+			TestTrue(TEXT("Resolved the strings one at a time"), FHoudiniEngineString::SHArrayToFStringArray_Singles(StringHandles, SingleStrings));
+			TestEqual(TEXT("Single strings match HAPI's"), SingleStrings, ExpectedStrings);
+
+			FString InvalidString;
+			TestFalse(TEXT("Invalid handle is not resolved"), FHoudiniEngineString::ToFString(0, InvalidString));
+		});
+
+	return true;
+}
+
+// Checks that gathering the HAPI data of all the instancer parts on worker threads
+// gives the same data as gathering it for each part on the game thread.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorParallelInstancerDataTest, "Houdini.Editor.ParallelInstancerData", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorParallelInstancerDataTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this);
+
+	FHoudiniEditorTestUtils::InstantiateAsset(this, TEXT("/Game/TestHDAs/Evergreen"),
+		[=](UHoudiniAssetComponent * HAC, const bool IsSuccessful)
+		{
+			if (!TestTrue(TEXT("Asset cooked"), IsSuccessful))
+				return;
+
+			TArray<FHoudiniGeoPartObject> InstancerHGPOs;
+			for (UHoudiniOutput* Output : HAC->GetOutputs())
+			{
+				if (!IsValid(Output) || Output->GetType() != EHoudiniOutputType::Instancer)
+					continue;
+
+				for (const FHoudiniGeoPartObject& HGPO : Output->GetHoudiniGeoPartObjects())
+				{
+					if (HGPO.Type == EHoudiniPartType::Instancer)
+						InstancerHGPOs.Add(HGPO);
+				}
+			}
+
+			if (InstancerHGPOs.Num() <= 0)
+			{
+				AddInfo(TEXT("The asset has no instancer parts, skipping."));
+				return;
+			}
+
+			TArray<FHoudiniInstancerPartHAPIData> SequentialData;
+			SequentialData.SetNum(InstancerHGPOs.Num());
+			TArray<bool> SequentialSucceeded;
+			for (int32 Index = 0; Index < InstancerHGPOs.Num(); Index++)
+				SequentialSucceeded.Add(FHoudiniInstanceTranslator::GatherInstancerPartHAPIData(InstancerHGPOs[Index], SequentialData[Index]));
+
+			TArray<FHoudiniInstancerPartHAPIData> ParallelData;
+			ParallelData.SetNum(InstancerHGPOs.Num());
+			TArray<bool> ParallelSucceeded;
+			ParallelSucceeded.SetNumZeroed(InstancerHGPOs.Num());
+			ParallelFor(InstancerHGPOs.Num(), [&](int32 Index)
+			{
+				ParallelSucceeded[Index] = FHoudiniInstanceTranslator::GatherInstancerPartHAPIData(InstancerHGPOs[Index], ParallelData[Index]);
+			});
+
+			TestTrue(TEXT("Same parts succeeded"), ParallelSucceeded == SequentialSucceeded);
+			for (int32 Index = 0; Index < InstancerHGPOs.Num(); Index++)
+			{
+				const FHoudiniInstancerPartHAPIData& Expected = SequentialData[Index];
+				const FHoudiniInstancerPartHAPIData& Actual = ParallelData[Index];
+				const FString Part = FString::Printf(TEXT("Part %d: "), Index);
+
+				TestTrue(Part + TEXT("Force HISM"), Actual.PartData.bForceHISM == Expected.PartData.bForceHISM);
+				TestTrue(Part + TEXT("Split mesh instancer"), Actual.PartData.bSplitMeshInstancer == Expected.PartData.bSplitMeshInstancer);
+				TestTrue(Part + TEXT("Foliage instancer"), Actual.PartData.bIsFoliageInstancer == Expected.PartData.bIsFoliageInstancer);
+				TestEqual(Part + TEXT("Split attribute"), Actual.PartData.SplitAttributeName, Expected.PartData.SplitAttributeName);
+				TestTrue(Part + TEXT("Split values"), Actual.PartData.SplitAttributeValues == Expected.PartData.SplitAttributeValues);
+				TestTrue(Part + TEXT("Output names"), Actual.PartData.OutputNames == Expected.PartData.OutputNames);
+				TestTrue(Part + TEXT("Tile values"), Actual.PartData.TileValues == Expected.PartData.TileValues);
+				TestTrue(Part + TEXT("Has instanced parts"), Actual.bHasInstancedHGPOs == Expected.bHasInstancedHGPOs);
+				if (!TestEqual(Part + TEXT("Number of instanced parts"), Actual.InstancedHGPOTransforms.Num(), Expected.InstancedHGPOTransforms.Num()))
+					continue;
+
+				for (int32 InstancedIdx = 0; InstancedIdx < Expected.InstancedHGPOTransforms.Num(); InstancedIdx++)
+				{
+					const TArray<FTransform>& ExpectedTransforms = Expected.InstancedHGPOTransforms[InstancedIdx];
+					const TArray<FTransform>& ActualTransforms = Actual.InstancedHGPOTransforms[InstancedIdx];
+					if (!TestEqual(Part + TEXT("Number of instances"), ActualTransforms.Num(), ExpectedTransforms.Num()))
+						continue;
+
+					bool bSameTransforms = true;
+					for (int32 TransformIdx = 0; TransformIdx < ExpectedTransforms.Num(); TransformIdx++)
+						bSameTransforms &= ActualTransforms[TransformIdx].Equals(ExpectedTransforms[TransformIdx]);
+					TestTrue(Part + TEXT("Same instance transforms"), bSameTransforms);
+				}
+			}
+		});
+
+	return true;
+}
+
+// Checks that streaming a heightfield's volume tiles gives the same float data, min/max and
+// landscape data as fetching the whole heightfield at once.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorHeightfieldTilesTest, "Houdini.Editor.HeightfieldTiles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorHeightfieldTilesTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this);
+
+	// The asset is only instantiated to make sure the session is running
+	FHoudiniEditorTestUtils::InstantiateAsset(this, TEXT("/Game/TestHDAs/Evergreen"),
+		[=](UHoudiniAssetComponent * HAC, const bool IsSuccessful)
+		{
+			if (!TestTrue(TEXT("Asset cooked"), IsSuccessful))
+				return;
+
+			IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.StreamHeightfieldTiles"));
+			if (!TestNotNull(TEXT("HoudiniEngine.StreamHeightfieldTiles"), CVar))
+				return;
+
+			// Create a noisy heightfield whose size isn't a multiple of the tile size
+			const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+			HAPI_NodeId HeightfieldNodeId = -1;
+			if (!TestTrue(TEXT("Created the heightfield node"),
+				HAPI_RESULT_SUCCESS == FHoudiniEngineUtils::CreateNode(-1, TEXT("SOP/heightfield"), TEXT("HeightfieldTiles"), false, &HeightfieldNodeId)))
+				return;
+
+			HAPI_NodeInfo HeightfieldNodeInfo;
+			FHoudiniApi::NodeInfo_Init(&HeightfieldNodeInfo);
+			FHoudiniApi::GetNodeInfo(Session, HeightfieldNodeId, &HeightfieldNodeInfo);
+			const HAPI_NodeId ObjectNodeId = HeightfieldNodeInfo.parentId;
+
+			FHoudiniApi::SetParmFloatValue(Session, HeightfieldNodeId, "size", 0, 300.0f);
+			FHoudiniApi::SetParmFloatValue(Session, HeightfieldNodeId, "size", 1, 170.0f);
+
+			HAPI_NodeId NoiseNodeId = -1;
+			const bool bCooked = HAPI_RESULT_SUCCESS == FHoudiniEngineUtils::CreateNode(ObjectNodeId, TEXT("heightfield_noise"), TEXT("noise"), false, &NoiseNodeId)
+				&& HAPI_RESULT_SUCCESS == FHoudiniApi::ConnectNodeInput(Session, NoiseNodeId, 0, HeightfieldNodeId, 0)
+				&& FHoudiniEngineUtils::HapiCookNode(NoiseNodeId, nullptr, true);
+
+			// Find the height volume
+			FHoudiniGeoPartObject HGPO;
+			HGPO.Type = EHoudiniPartType::Volume;
+			HGPO.ObjectId = ObjectNodeId;
+			HGPO.GeoId = NoiseNodeId;
+			HAPI_GeoInfo GeoInfo;
+			FHoudiniApi::GeoInfo_Init(&GeoInfo);
+			if (TestTrue(TEXT("Cooked the heightfield"), bCooked)
+				&& HAPI_RESULT_SUCCESS == FHoudiniApi::GetGeoInfo(Session, NoiseNodeId, &GeoInfo))
+			{
+				for (int32 PartId = 0; PartId < GeoInfo.partCount && HGPO.PartId < 0; PartId++)
+				{
+					HAPI_VolumeInfo PartVolumeInfo;
+					FHoudiniApi::VolumeInfo_Init(&PartVolumeInfo);
+					if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetVolumeInfo(Session, NoiseNodeId, PartId, &PartVolumeInfo)
+						&& FHoudiniEngineString(PartVolumeInfo.nameSH).ToFString() == TEXT("height"))
+						HGPO.PartId = PartId;
+				}
+			}
+
+			HAPI_VolumeInfo VolumeInfo;
+			if (TestTrue(TEXT("Found the height volume"), HGPO.PartId >= 0)
+				&& TestTrue(TEXT("Got the volume info"), FHoudiniLandscapeTranslator::GetHoudiniHeightfieldVolumeInfo(&HGPO, VolumeInfo)))
+			{
+				HGPO.VolumeInfo.XLength = VolumeInfo.xLength;
+				HGPO.VolumeInfo.YLength = VolumeInfo.yLength;
+				HGPO.VolumeInfo.ZLength = VolumeInfo.zLength;
+				HGPO.VolumeInfo.TileSize = VolumeInfo.tileSize;
+				TestTrue(TEXT("Heightfield spans several partial tiles"),
+					VolumeInfo.tileSize > 0 && VolumeInfo.xLength % VolumeInfo.tileSize != 0 && VolumeInfo.yLength % VolumeInfo.tileSize != 0);
+
+				TArray<float> FloatValues[2];
+				float FloatMin[2] = { 0.0f, 0.0f };
+				float FloatMax[2] = { 0.0f, 0.0f };
+				const int32 PreviousValue = CVar->GetInt();
+				for (int32 Pass = 0; Pass < 2; Pass++)
+				{
+					CVar->Set(Pass, ECVF_SetByCode);
+					TestTrue(TEXT("Got the float data"),
+						FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(&HGPO, FloatValues[Pass], FloatMin[Pass], FloatMax[Pass]));
+				}
+				CVar->Set(PreviousValue, ECVF_SetByCode);
+
+				TestTrue(TEXT("Heightfield isn't flat"), FloatMax[0] > FloatMin[0]);
+				TestTrue(TEXT("Streamed tiles match the heightfield data"), FloatValues[1] == FloatValues[0]);
+				TestEqual(TEXT("Streamed min"), FloatMin[1], FloatMin[0]);
+				TestEqual(TEXT("Streamed max"), FloatMax[1], FloatMax[0]);
+
+				// HF sizes need an X/Y swap
+				int32 UnrealSizeX = -1, UnrealSizeY = -1, NumSectionsPerComponent = -1, NumQuadsPerSection = -1;
+				if (TestTrue(TEXT("Got the landscape size"), FHoudiniLandscapeTranslator::CalcLandscapeSizeFromHeightfieldSize(
+					VolumeInfo.yLength, VolumeInfo.xLength, UnrealSizeX, UnrealSizeY, NumSectionsPerComponent, NumQuadsPerSection)))
+				{
+					TArray<uint16> IntHeightData;
+					FTransform LandscapeTransform;
+					TestTrue(TEXT("Converted the float data"), FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+						FloatValues[0], HGPO.VolumeInfo, UnrealSizeX, UnrealSizeY, FloatMin[0], FloatMax[0], IntHeightData, LandscapeTransform));
+
+					TArray<uint16> StreamedIntHeightData;
+					FTransform StreamedLandscapeTransform;
+					TestTrue(TEXT("Converted the streamed tiles"), FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+						&HGPO, HGPO.VolumeInfo, UnrealSizeX, UnrealSizeY, FloatMin[0], FloatMax[0], StreamedIntHeightData, StreamedLandscapeTransform));
+
+					TestTrue(TEXT("Streamed tiles give the same landscape data"), StreamedIntHeightData == IntHeightData);
+					TestTrue(TEXT("Streamed tiles give the same landscape transform"), StreamedLandscapeTransform.Equals(LandscapeTransform));
+				}
+			}
+
+			FHoudiniApi::DeleteNode(Session, ObjectNodeId);
+		});
+
+	return true;
+}
+
+// Checks that the output data fetched on a worker thread covers all the mesh and instancer parts
+// that need it, and that the outputs created from it match the outputs of a synchronous update.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorAsyncOutputFetchTest, "Houdini.Editor.AsyncOutputFetch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorAsyncOutputFetchTest::RunTest(const FString & Parameters)
+{
+	FHoudiniEditorTestUtils::InitializeTests(this);
+
+	FHoudiniEditorTestUtils::InstantiateAsset(this, TEXT("/Game/TestHDAs/Evergreen"),
+		[=](UHoudiniAssetComponent * HAC, const bool IsSuccessful)
+		{
+			if (!TestTrue(TEXT("Asset cooked"), IsSuccessful))
+				return;
+
+			bool bHasHoudiniStaticMeshOutput = false;
+			TestTrue(TEXT("Synchronous update"), FHoudiniOutputTranslator::UpdateOutputs(HAC, true, bHasHoudiniStaticMeshOutput));
+			const TArray<FString> SynchronousOutputs = GetOutputObjectDescriptions(HAC);
+
+			// BeginUpdateOutputs starts the fetch stage
+			FHoudiniOutputProcessingState ProcessingState;
+			if (!TestTrue(TEXT("Began the update"), FHoudiniOutputTranslator::BeginUpdateOutputs(HAC, true, ProcessingState, true)))
+				return;
+
+			// The parts the fetch stage is expected to cover
+			TSet<FHoudiniOutputObjectIdentifier> ExpectedMeshParts;
+			TSet<FHoudiniOutputObjectIdentifier> ExpectedInstancerParts;
+			for (UHoudiniOutput* Output : HAC->GetOutputs())
+			{
+				if (!IsValid(Output) || !HAC->IsOutputTypeSupported(Output->GetType()))
+					continue;
+
+				const bool bForceRebuild = Output->HasAnyCurrentProxy();
+				for (const FHoudiniGeoPartObject& HGPO : Output->GetHoudiniGeoPartObjects())
+				{
+					FHoudiniOutputObjectIdentifier PartIdentifier(HGPO.ObjectId, HGPO.GeoId, HGPO.PartId, FString());
+					PartIdentifier.PartName = HGPO.PartName;
+					if (Output->GetType() == EHoudiniOutputType::Mesh && HGPO.Type == EHoudiniPartType::Mesh
+						&& (bForceRebuild || HGPO.bHasGeoChanged || HGPO.bHasPartChanged))
+						ExpectedMeshParts.Add(PartIdentifier);
+					else if (Output->GetType() == EHoudiniOutputType::Instancer && HGPO.Type == EHoudiniPartType::Instancer)
+						ExpectedInstancerParts.Add(PartIdentifier);
+				}
+			}
+
+			const bool bExpectsData = ExpectedMeshParts.Num() > 0 || ExpectedInstancerParts.Num() > 0;
+			TestTrue(TEXT("Fetch stage started"), ProcessingState.PrefetchTask.IsValid() == bExpectsData);
+
+			// Poll the fetch stage like the engine manager does, without blocking on the task
+			while (FHoudiniOutputTranslator::IsFetchingOutputData(ProcessingState))
+				FPlatformProcess::Sleep(0.001f);
+
+			FHoudiniOutputTranslator::FinishFetchingOutputData(ProcessingState);
+			TestFalse(TEXT("Fetch stage is done"), ProcessingState.PrefetchTask.IsValid());
+			if (bExpectsData && TestTrue(TEXT("Fetched the output data"), ProcessingState.PrefetchedData.IsValid()))
+			{
+				TSet<FHoudiniOutputObjectIdentifier> FetchedMeshParts;
+				for (const auto& Pair : ProcessingState.PrefetchedData->MeshParts)
+				{
+					TestTrue(TEXT("Fetched mesh part is valid"), Pair.Value.IsValid());
+					FetchedMeshParts.Add(Pair.Key);
+				}
+
+				TSet<FHoudiniOutputObjectIdentifier> FetchedInstancerParts;
+				for (const auto& Pair : ProcessingState.InstancerPartHAPIData)
+					FetchedInstancerParts.Add(Pair.Key);
+
+				TestTrue(TEXT("Fetched all the mesh parts"), FetchedMeshParts.Num() == ExpectedMeshParts.Num() && FetchedMeshParts.Includes(ExpectedMeshParts));
+				TestTrue(TEXT("Fetched all the instancer parts"), FetchedInstancerParts.Num() == ExpectedInstancerParts.Num() && FetchedInstancerParts.Includes(ExpectedInstancerParts));
+				TestTrue(TEXT("Instancer data is handed to the processing state"), ProcessingState.bHasGatheredInstancerData);
+			}
+
+			while (!FHoudiniOutputTranslator::ProcessNextOutput(HAC, ProcessingState));
+			TestTrue(TEXT("Ended the update"), FHoudiniOutputTranslator::EndUpdateOutputs(HAC, ProcessingState, bHasHoudiniStaticMeshOutput));
+
+			TestEqual(TEXT("Prefetched data creates the same outputs"), GetOutputObjectDescriptions(HAC), SynchronousOutputs);
+		});
+
+	return true;
+}
+
+// Checks that the bake notification scope sends the PostEditChange and dirty package notifications immediately
+// without a scope, and only once per object, when the outermost scope ends, within nested scopes.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniEditorBakeNotificationScopeTest, "Houdini.Editor.BakeNotificationScope", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniEditorBakeNotificationScopeTest::RunTest(const FString & Parameters)
+{
+	UPackage* ChangedPackage = CreatePackage(TEXT("/Game/HoudiniEngineTests/BakeNotificationScope/Changed"));
+	UPackage* DirtyPackage = CreatePackage(TEXT("/Game/HoudiniEngineTests/BakeNotificationScope/Dirty"));
+	DirtyPackage->SetDirtyFlag(false);
+
+	// UObject::PostEditChange broadcasts OnObjectPropertyChanged
+	int32 NumPostEditChanges = 0;
+	const FDelegateHandle Handle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
+		[&NumPostEditChanges, ChangedPackage](UObject* InObject, FPropertyChangedEvent& InEvent)
+		{
+			if (InObject == ChangedPackage)
+				NumPostEditChanges++;
+		});
+
+	TestFalse(TEXT("No scope is active"), FHoudiniBakeNotificationScope::IsActive());
+	FHoudiniBakeNotificationScope::PostEditChange(ChangedPackage);
+	TestEqual(TEXT("PostEditChange is immediate without a scope"), NumPostEditChanges, 1);
+	FHoudiniBakeNotificationScope::MarkPackageDirty(DirtyPackage);
+	TestTrue(TEXT("Package is dirtied immediately without a scope"), DirtyPackage->IsDirty());
+
+	DirtyPackage->SetDirtyFlag(false);
+	NumPostEditChanges = 0;
+	{
+		FHoudiniBakeNotificationScope OuterScope;
+		TestTrue(TEXT("Scope is active"), FHoudiniBakeNotificationScope::IsActive());
+		{
+			FHoudiniBakeNotificationScope InnerScope;
+			FHoudiniBakeNotificationScope::PostEditChange(ChangedPackage);
+			FHoudiniBakeNotificationScope::PostEditChange(ChangedPackage);
+			FHoudiniBakeNotificationScope::MarkPackageDirty(DirtyPackage);
+		}
+
+		// Only the outermost scope sends the notifications
+		TestTrue(TEXT("Outer scope is still active"), FHoudiniBakeNotificationScope::IsActive());
+		FHoudiniBakeNotificationScope::PostEditChange(ChangedPackage);
+		FHoudiniBakeNotificationScope::MarkPackageDirty(DirtyPackage);
+		TestEqual(TEXT("PostEditChange is deferred"), NumPostEditChanges, 0);
+		TestFalse(TEXT("Dirty package is deferred"), DirtyPackage->IsDirty());
+	}
+
+	TestFalse(TEXT("Scope has ended"), FHoudiniBakeNotificationScope::IsActive());
+	TestEqual(TEXT("PostEditChange is sent once per object"), NumPostEditChanges, 1);
+	TestTrue(TEXT("Package is dirtied when the scope ends"), DirtyPackage->IsDirty());
+
+	// The notifications have been flushed, a new scope starts empty
+	NumPostEditChanges = 0;
+	{
+		FHoudiniBakeNotificationScope Scope;
+	}
+	TestEqual(TEXT("Flushed notifications are not sent again"), NumPostEditChanges, 0);
+
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(Handle);
+	for (UPackage* Package : { ChangedPackage, DirtyPackage })
+	{
+		Package->SetDirtyFlag(false);
+		Package->MarkPendingKill();
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return true;
+}
+
 #endif
@@ -45,6 +45,7 @@ class UHoudiniInput;
 class UTOPNode;
 class UHoudiniAssetComponent;
 class AHoudiniAssetActor;
+class UHoudiniPublicAPIProcessHDAVariantsNode;
 
 /**
  * The base class of a struct for Houdini Ramp points.
@@ -211,6 +212,60 @@ public:
 	TArray<FHoudiniPublicAPIColorRampPoint> ColorRampPoints;
 };
 
+/** The parameters and inputs of one variant processed by UHoudiniPublicAPIProcessHDAVariantsNode. */
+USTRUCT(BlueprintType, Category="Houdini Engine | Public API")
+struct HOUDINIENGINEEDITOR_API FHoudiniPublicAPIVariant
+{
+	GENERATED_BODY();
+
+	/** The parameter values to set before cooking the variant. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<FName, FHoudiniParameterTuple> Parameters;
+
+	/** The node inputs to set before cooking the variant. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<int32, UHoudiniPublicAPIInput*> NodeInputs;
+
+	/** The parameter-based inputs to set before cooking the variant. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	TMap<FName, UHoudiniPublicAPIInput*> ParameterInputs;
+
+	/** If not empty, overrides the node's bake directory for this variant. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Houdini Engine | Public API")
+	FString BakeDirectoryPath;
+};
+
+/** The result and timings of one variant processed by UHoudiniPublicAPIProcessHDAVariantsNode. */
+USTRUCT(BlueprintType, Category="Houdini Engine | Public API")
+struct HOUDINIENGINEEDITOR_API FHoudiniPublicAPIVariantResult
+{
+	GENERATED_BODY();
+
+	/** The index of the variant in the array passed to the node. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	int32 VariantIndex = INDEX_NONE;
+
+	/** True if the variant cooked successfully. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	bool bCookSuccess = false;
+
+	/** True if the variant was baked successfully. Always false if baking is disabled. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	bool bBakeSuccess = false;
+
+	/** Time from setting the variant's parameters and inputs to its outputs being processed, in seconds. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	float CookTimeSeconds = 0.0f;
+
+	/** Time spent baking and saving the variant's outputs, in seconds. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	float BakeTimeSeconds = 0.0f;
+
+	/** The objects (assets and actors) created by baking the variant. */
+	UPROPERTY(BlueprintReadOnly, Category="Houdini Engine | Public API")
+	TArray<UObject*> BakedObjects;
+};
+
 /**
  * A wrapper for spawned/instantiating HDAs.
  *
@@ -483,6 +538,30 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
 	bool GetReplacePreviousBake() const;
 
+	// Variants
+
+	/**
+	 * Process a batch of variants with the wrapped instantiated asset: for each variant its parameters and inputs are
+	 * set, the asset is recooked and its outputs are optionally baked, without re-instantiating the HDA. Processing
+	 * happens asynchronously from the Houdini Engine manager's tick: bind to the returned node's VariantCompleted /
+	 * Completed / Failed delegates to receive the per-variant results. The wrapped asset is not deleted afterwards.
+	 * @param InVariants The parameters and inputs of the variants to generate.
+	 * @param bInBakeVariants If true (the default), the outputs of each variant are baked (and saved) after its cook.
+	 * @param InBakeDirectoryPath The directory to bake to if the bake path is not set via attributes on the HDA output
+	 * or by the variant.
+	 * @param InBakeMethod The bake target (to actor vs blueprint). @see EHoudiniEngineBakeOption.
+	 * @param bInRecenterBakedActors Recenter the baked actors to their bounding box center. Defaults to false.
+	 * @return The node processing the variants, or nullptr if the wrapped asset is invalid, is not instantiated or is
+	 * currently cooking, or if InVariants is empty.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Houdini|Public API")
+	UHoudiniPublicAPIProcessHDAVariantsNode* ProcessVariants(
+		const TArray<FHoudiniPublicAPIVariant>& InVariants,
+		const bool bInBakeVariants=true,
+		const FString& InBakeDirectoryPath="",
+		const EHoudiniEngineBakeOption InBakeMethod=EHoudiniEngineBakeOption::ToActor,
+		const bool bInRecenterBakedActors=false);
+
 	// Parameters
 
 	/**
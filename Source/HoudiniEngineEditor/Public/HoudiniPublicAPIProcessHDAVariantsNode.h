@@ -0,0 +1,305 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Kismet/BlueprintAsyncActionBase.h"
+
+#include "HoudiniPublicAPIAssetWrapper.h"
+
+#include "HoudiniPublicAPIProcessHDAVariantsNode.generated.h"
+
+
+class UHoudiniAsset;
+class UHoudiniAssetComponent;
+
+// Delegate types for output pins on the node.
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnProcessHDAVariantsNodeVariantDelegate, UHoudiniPublicAPIAssetWrapper*, AssetWrapper, const FHoudiniPublicAPIVariantResult&, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnProcessHDAVariantsNodeOutputPinDelegate, const TArray<FHoudiniPublicAPIVariantResult>&, Results);
+
+/**
+ * A Blueprint async node for generating many variants of a single HDA. Instead of instantiating (and deleting) the
+ * HDA for every variant, the node instantiates it once per instance, and then for each variant: sets its parameters
+ * and inputs, recooks the instantiated asset, optionally bakes (and saves) the outputs and moves on to the next
+ * variant. Variants are distributed over InNumInstances instantiated assets, so that the processing of the outputs of
+ * one instance can overlap with the cook of another. Before a variant is applied to a reused instance, the parameters
+ * and inputs set by its previous variant are reset to the values the HDA had when it was instantiated, so that each
+ * variant only depends on its own settings and not on the order in which the variants are processed.
+ * A variant that fails to cook (or whose instance fails to instantiate) is recorded as failed in its result and the
+ * remaining variants are still processed, so that one bad variant does not discard the work done for the others.
+ * Everything happens asynchronously from the Houdini Engine manager's tick, and does not block the editor.
+ */
+UCLASS()
+class HOUDINIENGINEEDITOR_API UHoudiniPublicAPIProcessHDAVariantsNode : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+	
+public:
+	UHoudiniPublicAPIProcessHDAVariantsNode(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * Instantiates an HDA in the specified world/level and processes each of the supplied variants with it.
+	 * VariantCompleted is broadcast after each variant, Completed once all of the variants have been processed, with
+	 * the result of each variant. Failed is broadcast instead of Completed if the node could not be activated or if
+	 * none of the instances could be instantiated.
+	 * @param InHoudiniAsset The HDA to instantiate.
+	 * @param InVariants The parameters and inputs of the variants to generate.
+	 * @param InInstantiateAt The Transform to instantiate the HDA with.
+	 * @param InWorldContextObject A world context object for identifying the world to spawn in, if
+	 * InSpawnInLevelOverride is null.
+	 * @param InSpawnInLevelOverride If not nullptr, then the AHoudiniAssetActor is spawned in that level. If both
+	 * InSpawnInLevelOverride and InWorldContextObject are null, then the actor is spawned in the current editor
+	 * context world's current level.
+	 * @param InNumInstances The number of instances of the HDA to spread the variants over. Defaults to 1.
+	 * @param bInBakeVariants If true (the default), the outputs of each variant are baked (and saved) after its cook.
+	 * @param InBakeDirectoryPath The directory to bake to if the bake path is not set via attributes on the HDA output
+	 * or by the variant.
+	 * @param InBakeMethod The bake target (to actor vs blueprint). @see EHoudiniEngineBakeOption.
+	 * @param bInRecenterBakedActors Recenter the baked actors to their bounding box center. Defaults to false.
+	 * @param bInDeleteInstantiatedAssetsOnCompletion If true (the default), deletes the instantiated asset actors
+	 * once all variants have been processed.
+	 * @return The blueprint async node.
+	 */
+	UFUNCTION(BlueprintCallable, meta=(AdvancedDisplay=3,AutoCreateRefTerm="InInstantiateAt",BlueprintInternalUseOnly="true", WorldContext="WorldContextObject"), Category="Houdini|Public API")
+	static UHoudiniPublicAPIProcessHDAVariantsNode* ProcessHDAVariants(
+		UHoudiniAsset* InHoudiniAsset,
+		const TArray<FHoudiniPublicAPIVariant>& InVariants,
+		const FTransform& InInstantiateAt,
+		UObject* InWorldContextObject=nullptr,
+		ULevel* InSpawnInLevelOverride=nullptr,
+		const int32 InNumInstances=1,
+		const bool bInBakeVariants=true,
+		const FString& InBakeDirectoryPath="",
+		const EHoudiniEngineBakeOption InBakeMethod=EHoudiniEngineBakeOption::ToActor,
+		const bool bInRecenterBakedActors=false,
+		const bool bInDeleteInstantiatedAssetsOnCompletion=true);
+
+	/**
+	 * Create a node that processes the variants with an already instantiated asset instead of instantiating the HDA.
+	 * The asset is not deleted once the variants have been processed. The node is returned unactivated.
+	 * @see UHoudiniPublicAPIAssetWrapper::ProcessVariants()
+	 */
+	static UHoudiniPublicAPIProcessHDAVariantsNode* ProcessVariantsWithExistingWrapper(
+		UHoudiniPublicAPIAssetWrapper* InAssetWrapper,
+		const TArray<FHoudiniPublicAPIVariant>& InVariants,
+		const bool bInBakeVariants,
+		const FString& InBakeDirectoryPath,
+		const EHoudiniEngineBakeOption InBakeMethod,
+		const bool bInRecenterBakedActors);
+	
+	virtual void Activate() override;
+
+	/** Returns true once Completed or Failed has been broadcast. */
+	bool IsFinished() const { return bFinished; }
+
+	/** Returns the results of the variants, indexed by variant index. */
+	const TArray<FHoudiniPublicAPIVariantResult>& GetResults() const { return Results; }
+
+	/** Delegate that is broadcast after each variant has been cooked (and baked). */
+	UPROPERTY(BlueprintAssignable, Category="Houdini|Public API")
+	FOnProcessHDAVariantsNodeVariantDelegate VariantCompleted;
+
+	/** Delegate that is broadcast once all variants have been processed, with the results ordered by variant index. */
+	UPROPERTY(BlueprintAssignable, Category="Houdini|Public API")
+	FOnProcessHDAVariantsNodeOutputPinDelegate Completed;
+
+	/**
+	 * Delegate that is broadcast if we fail during activation of the node, or if none of the instances could be
+	 * instantiated, with the (failed) results of all variants.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Houdini|Public API")
+	FOnProcessHDAVariantsNodeOutputPinDelegate Failed;
+
+protected:
+
+	/** The HDA to instantiate. */
+	UPROPERTY()
+	UHoudiniAsset* HoudiniAsset;
+
+	/** The variants to process. */
+	UPROPERTY()
+	TArray<FHoudiniPublicAPIVariant> Variants;
+
+	/** The transform the instantiate the asset with. */
+	UPROPERTY()
+	FTransform InstantiateAt;
+
+	/** The world context object: spawn in this world if #SpawnInLevelOverride is not set. */ 
+	UPROPERTY()
+	UObject* WorldContextObject;
+
+	/** The level to spawn in. If both this and #WorldContextObject is not set, spawn in the editor context's level. */ 
+	UPROPERTY()
+	ULevel* SpawnInLevelOverride;
+
+	/** The number of instances of the HDA to spread the variants over. */
+	UPROPERTY()
+	int32 NumInstances;
+
+	/** Whether to bake each variant after its cook. */
+	UPROPERTY()
+	bool bBakeVariants;
+
+	/** Set the fallback bake directory, for if output attributes or the variant do not specify it. */
+	UPROPERTY()
+	FString BakeDirectoryPath;
+
+	/** The bake method/target: for example, to actors vs to blueprints. */
+	UPROPERTY()
+	EHoudiniEngineBakeOption BakeMethod;
+
+	/** Recenter the baked actors at their bounding box center. */
+	UPROPERTY()
+	bool bRecenterBakedActors;
+
+	/** Whether or not to delete the instantiated assets after Completed is broadcast. */
+	UPROPERTY()
+	bool bDeleteInstantiatedAssetsOnCompletion;
+
+	/** If set, the variants are processed with this wrapper's instantiated asset instead of instantiating the HDA. */
+	UPROPERTY()
+	UHoudiniPublicAPIAssetWrapper* ExistingAssetWrapper;
+
+	/** True if auto bake was enabled on #ExistingAssetWrapper, and must be re-enabled once we are done. */
+	bool bRestoreAutoBake;
+
+	/** The asset wrappers of the instantiated HDAs. */
+	UPROPERTY()
+	TArray<UHoudiniPublicAPIAssetWrapper*> AssetWrappers;
+
+	/** The variant currently being processed by each asset wrapper (INDEX_NONE if idle). */
+	TArray<int32> CurrentVariantIndices;
+
+	/** True for each asset wrapper whose instantiation failed: no more variants are assigned to it. */
+	TArray<bool> FailedInstances;
+
+	/** True once at least one instance was successfully instantiated. */
+	bool bAnyInstanceInstantiated;
+
+	/** True once Completed or Failed has been broadcast. */
+	bool bFinished;
+
+	/** The time at which each asset wrapper started processing its current variant. */
+	TArray<double> CurrentVariantStartTimes;
+
+	/** The index of the next variant to assign to an asset wrapper. */
+	int32 NextVariantIndex;
+
+	/** The results of the variants, indexed by variant index. */
+	UPROPERTY()
+	TArray<FHoudiniPublicAPIVariantResult> Results;
+
+	/** The number of variants that have been fully processed. */
+	int32 NumProcessedVariants;
+
+	/** The parameter values of the HDA before any variant was applied, taken from the first instance. */
+	UPROPERTY()
+	TMap<FName, FHoudiniParameterTuple> DefaultParameters;
+
+	/** The node inputs of the HDA after instantiation, before any variant's inputs were set. */
+	UPROPERTY()
+	TMap<int32, UHoudiniPublicAPIInput*> DefaultNodeInputs;
+
+	/** The parameter-based inputs of the HDA after instantiation, before any variant's inputs were set. */
+	UPROPERTY()
+	TMap<FName, UHoudiniPublicAPIInput*> DefaultParameterInputs;
+
+	/** The bake folder of the HDA before any variant was applied. */
+	UPROPERTY()
+	FDirectoryPath DefaultBakeFolder;
+
+	/** True once #DefaultParameters and #DefaultBakeFolder have been recorded. */
+	bool bHasDefaultParameters;
+
+	/** True once #DefaultNodeInputs and #DefaultParameterInputs have been recorded. */
+	bool bHasDefaultInputs;
+
+	/** Activate() for a node created with ProcessVariantsWithExistingWrapper(). */
+	void ActivateWithExistingWrapper();
+
+	/** Unbind all delegates */
+	void UnbindDelegates();
+
+	/**
+	 * Unbind our delegates, restore the settings we changed on #ExistingAssetWrapper and, if bInDeleteInstantiatedAssets
+	 * is true, delete the assets that this node instantiated.
+	 */
+	void ReleaseAssetWrappers(const bool bInDeleteInstantiatedAssets);
+
+	/** Returns the index of InAssetWrapper in #AssetWrappers, or INDEX_NONE if it is not one of ours. */
+	int32 GetInstanceIndex(UHoudiniPublicAPIAssetWrapper* InAssetWrapper) const;
+
+	/**
+	 * Assign the next variant to the instance at InInstanceIndex and set its parameters (and inputs if
+	 * bInSetInputs is true). Returns false if there are no variants left.
+	 */
+	bool AssignNextVariant(const int32 InInstanceIndex, const bool bInSetInputs);
+
+	/**
+	 * Reset the parameters and inputs that were set by the variant at InPreviousVariantIndex, and that are not set by
+	 * InNextVariant, on the instance at InInstanceIndex back to their values in the default snapshot.
+	 */
+	void ResetVariantOverrides(const int32 InInstanceIndex, const int32 InPreviousVariantIndex, const FHoudiniPublicAPIVariant& InNextVariant);
+
+	/** Record the result of the current variant of the instance at InInstanceIndex and start on its next variant. */
+	void FinishCurrentVariant(const int32 InInstanceIndex, FHoudiniPublicAPIVariantResult& InResult);
+
+	/**
+	 * Record the current variant of the instance at InInstanceIndex as failed and stop assigning variants to it. If no
+	 * instance is left, the variants that were not started yet are recorded as failed as well.
+	 */
+	void FailInstance(const int32 InInstanceIndex);
+
+	/** Broadcast Completed, or Failed if no instance could be instantiated, once all variants have been processed. */
+	void FinishIfAllVariantsProcessed();
+
+	/** Broadcast Failed and removes the node from the root set. */
+	virtual void HandleFailure();
+
+	/** Broadcast Completed and removes the node from the root set. */
+	virtual void HandleComplete();
+
+	/** Bound to the instantiated HACs' state change delegate. Fails the variant of an instance that fails to instantiate. */
+	void HandleAssetStateChange(UHoudiniAssetComponent* InHAC, const EHoudiniAssetState InFromState, const EHoudiniAssetState InToState);
+
+	/** Bound to the asset wrappers' pre-instantiation delegate. Sets the parameters of the first variant. */
+	UFUNCTION()
+	virtual void HandlePreInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+
+	/** Bound to the asset wrappers' post-instantiation delegate. Sets the inputs of the first variant. */
+	UFUNCTION()
+	virtual void HandlePostInstantiation(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+
+	/** Bound to the asset wrappers' post-cook delegate. Records failed cooks, since they are not processed. */
+	UFUNCTION()
+	virtual void HandlePostCook(UHoudiniPublicAPIAssetWrapper* InAssetWrapper, const bool bInCookSuccess);
+
+	/** Bound to the asset wrappers' post-processing delegate. Bakes the variant and moves on to the next one. */
+	UFUNCTION()
+	virtual void HandlePostProcessing(UHoudiniPublicAPIAssetWrapper* InAssetWrapper);
+};
@@ -34,6 +34,7 @@
 #include "Engine/SimpleConstructionScript.h"
 #include "UObject/Object.h"
 #include "Logging/LogMacros.h"
+#include "HAL/PlatformTime.h"
 
 #include "HoudiniParameterFloat.h"
 #include "HoudiniParameterToggle.h"
@@ -51,6 +52,10 @@
 
 HOUDINI_BP_DEFINE_LOG_CATEGORY();
 
+// Duration of the last Blueprint structure update caused by an output reconciliation.
+// Reported as the time saved by the recooks that don't need one.
+static double LastBlueprintStructureUpdateSeconds = 0.0;
+
 UHoudiniAssetBlueprintComponent::UHoudiniAssetBlueprintComponent(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -151,6 +156,12 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 
 	// Populate / update the outputs for the template from the preview / instance.
 	// TODO: Wrap the Blueprint manipulation in a transaction
+	const double ReconcileStartTime = FPlatformTime::Seconds();
+	int32 NumNodesCreated = 0;
+	int32 NumNodesUpdated = 0;
+	int32 NumNodesUnchanged = 0;
+	int32 NumNodesRemoved = 0;
+
 	TArray<UHoudiniOutput*>& TemplateOutputs = CachedTemplateComponent->Outputs;
 	TSet<UHoudiniOutput*> StaleTemplateOutputs(TemplateOutputs);
 
@@ -279,11 +290,6 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 				FName ComponentFName  = FName(ComponentName);
 			
 
-				const auto ComponentCopyOptions = ( EditorUtilities::ECopyOptions::Type )(
-						EditorUtilities::ECopyOptions::PropagateChangesToArchetypeInstances |
-						EditorUtilities::ECopyOptions::CallPostEditChangeProperty |
-						EditorUtilities::ECopyOptions::CallPostEditMove);
-				
 				if (IsValid(ComponentNode))
 				{
 					// Check if we have an existing and compatible SCS node containing a USceneComponent as a template component.
@@ -304,6 +310,7 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 						ComponentNode = nullptr;
 						ComponentTemplate = nullptr;
 						CachedTemplateComponent->MarkAsBlueprintStructureModified();
+						NumNodesRemoved++;
 					}
 				}
 
@@ -319,8 +326,10 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 					// Params.bClearReferences = false;
 					// UEngine::CopyPropertiesForUnrelatedObjects(ComponentInstance, ComponentNode->ComponentTemplate, Params);
 					
-					FHoudiniEngineRuntimeUtils::CopyComponentProperties(ComponentInstance, ComponentNode->ComponentTemplate, ComponentCopyOptions);
-					CachedTemplateComponent->MarkAsBlueprintStructureModified();
+					if (UpdateOutputNodeTemplate(CachedTemplateComponent.Get(), ComponentInstance, ComponentNode->ComponentTemplate))
+						NumNodesUpdated++;
+					else
+						NumNodesUnchanged++;
 
 					ComponentNode->ComponentTemplate->CreationMethod = EComponentCreationMethod::Native;
 				}
@@ -333,7 +342,7 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 					UEditorEngine::FCopyPropertiesForUnrelatedObjectsParams Params;
 					Params.bDoDelta = false; // We need a deep copy of parameters here so the CDO values get copied as well
 					UEditorEngine::CopyPropertiesForUnrelatedObjects(ComponentInstance, ComponentNode->ComponentTemplate, Params);
-					// FHoudiniEngineRuntimeUtils::CopyComponentProperties(ComponentInstance, ComponentNode->ComponentTemplate, ComponentCopyOptions);
+					// FHoudiniEngineRuntimeUtils::CopyComponentProperties(ComponentInstance, ComponentNode->ComponentTemplate, OutputComponentCopyOptions);
 
 					// {
 					// 	UInstancedStaticMeshComponent* Component = Cast<UInstancedStaticMeshComponent>(ComponentNode->ComponentTemplate);
@@ -358,6 +367,7 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 					TemplateObj.OutputComponent = ComponentNode->ComponentTemplate;
 
 					CachedTemplateComponent->MarkAsBlueprintStructureModified();
+					NumNodesCreated++;
 				}
 
 				// Cache the mapping between the output and the SCS node.
@@ -393,6 +403,7 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 				
 					SCS->RemoveNode(StaleNode, false);
 					CachedTemplateComponent->MarkAsBlueprintStructureModified();
+					NumNodesRemoved++;
 				}
 				/*
 				else
@@ -431,6 +442,7 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 				
 					SCS->RemoveNode(StaleNode, false);
 					CachedTemplateComponent->MarkAsBlueprintStructureModified();
+					NumNodesRemoved++;
 				}
 			}
 		}
@@ -475,13 +487,27 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 	CachedTemplateComponent->bLastCookSuccess = bLastCookSuccess;
 
 #if WITH_EDITOR
+	const double ReconcileSeconds = FPlatformTime::Seconds() - ReconcileStartTime;
+
 	// TODO: Do we need to handle this right now or can we wait for the next Houdini Engine manager tick to process it?
 	if (CachedTemplateComponent->NeedBlueprintStructureUpdate())
 	{
 		// We are about to recompile the blueprint. This will reconstruct the preview actor so we need to ensure
 		// that the old actor won't release the houdini nodes.
+		const double StructureUpdateStartTime = FPlatformTime::Seconds();
 		FHoudiniEngineRuntimeUtils::MarkBlueprintAsStructurallyModified(CachedTemplateComponent.Get());
 		SetCanDeleteHoudiniNodes(false);
+		LastBlueprintStructureUpdateSeconds = FPlatformTime::Seconds() - StructureUpdateStartTime;
+
+		HOUDINI_BP_MESSAGE(
+			TEXT("[UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent] %s: reconciled outputs in %.3fs (%d created, %d updated, %d unchanged, %d removed nodes), Blueprint recompiled in %.3fs."),
+			*GetPathName(), ReconcileSeconds, NumNodesCreated, NumNodesUpdated, NumNodesUnchanged, NumNodesRemoved, LastBlueprintStructureUpdateSeconds);
+	}
+	else
+	{
+		HOUDINI_BP_MESSAGE(
+			TEXT("[UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent] %s: reconciled outputs in %.3fs (%d created, %d updated, %d unchanged, %d removed nodes), Blueprint recompile skipped (last recompile took %.3fs)."),
+			*GetPathName(), ReconcileSeconds, NumNodesCreated, NumNodesUpdated, NumNodesUnchanged, NumNodesRemoved, LastBlueprintStructureUpdateSeconds);
 	}
 	/*else if (CachedTemplateComponent->NeedBlueprintUpdate())
 	{
@@ -489,6 +515,31 @@ UHoudiniAssetBlueprintComponent::CopyStateToTemplateComponent()
 	}*/
 #endif
 }
+
+bool
+UHoudiniAssetBlueprintComponent::UpdateOutputNodeTemplate(
+	UHoudiniAssetComponent* InTemplateComponent,
+	USceneComponent* InComponentInstance,
+	UActorComponent* InNodeTemplate)
+{
+	if (!IsValid(InTemplateComponent) || !IsValid(InComponentInstance) || !IsValid(InNodeTemplate))
+		return false;
+
+	const auto OutputComponentCopyOptions = ( EditorUtilities::ECopyOptions::Type )(
+			EditorUtilities::ECopyOptions::PropagateChangesToArchetypeInstances |
+			EditorUtilities::ECopyOptions::CallPostEditChangeProperty |
+			EditorUtilities::ECopyOptions::CallPostEditMove);
+
+	// CopyComponentProperties only copies (and propagates to the archetype instances) the properties
+	// that differ, so if nothing was copied the node is already up to date. Changing the properties of
+	// an existing node (ie, a new mesh) doesn't change the Blueprint's structure and doesn't require a recompile.
+	const int32 NumCopiedProperties = FHoudiniEngineRuntimeUtils::CopyComponentProperties(InComponentInstance, InNodeTemplate, OutputComponentCopyOptions);
+	if (NumCopiedProperties <= 0)
+		return false;
+
+	InTemplateComponent->MarkAsBlueprintModified();
+	return true;
+}
 #endif
 
 #if WITH_EDITOR
@@ -57,6 +57,11 @@ public:
 	
 	void CopyStateToTemplateComponent();
 
+	// Copies the properties of an output component instance to the template of its existing SCS node.
+	// Only the properties that differ are copied, and InTemplateComponent's Blueprint is then marked as modified.
+	// Updating an existing node never changes the Blueprint's structure. Returns true if the node was updated.
+	static bool UpdateOutputNodeTemplate(UHoudiniAssetComponent* InTemplateComponent, USceneComponent* InComponentInstance, UActorComponent* InNodeTemplate);
+
 	void CopyStateFromTemplateComponent(UHoudiniAssetBlueprintComponent* FromComponent, const bool bClearFromInputs, const bool bClearToInputs, const bool bCopyInputObjectComponentProperties);
 
 	void CopyDetailsFromComponent(
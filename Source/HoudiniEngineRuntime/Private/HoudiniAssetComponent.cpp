@@ -600,6 +600,8 @@ UHoudiniAssetComponent::ConvertLegacyData()
 	Version1CompatibilityHAC->MarkPendingKill();
 	Version1CompatibilityHAC = nullptr;
 
+	bConvertedFromLegacyData = true;
+
 	return true;
 }
 
@@ -683,6 +685,8 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 	
 	bNoProxyMeshNextCookRequested = false;
 	bBakeAfterNextCook = false;
+	bHasPreviewOutputs = false;
+	PreviewOutputsEditTime = 0.0;
 
 #if WITH_EDITORONLY_DATA
 	bGenerateMenuExpanded = true;
@@ -694,6 +698,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 
 	bRemoveOutputAfterBake = false;
 	bRecenterBakedActors = false;
+	bBakeMeshSplitInstancersAsInstances = false;
 	bReplacePreviousBake = false;
 #endif
 
@@ -717,6 +722,8 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 
 	LastTickTime = 0.0;
 
+	bConvertedFromLegacyData = false;
+
 	// Initialize the default SM Build settings with the plugin's settings default values
 	StaticMeshBuildSettings = FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
 }
@@ -965,6 +972,84 @@ UHoudiniAssetComponent::NeedUpdateInputs() const
 	return false;
 }
 
+double
+UHoudiniAssetComponent::GetLastParameterOrInputEditTime() const
+{
+	double LastEditTime = 0.0;
+	for (auto CurrentParm : Parameters)
+	{
+		if (!CurrentParm || CurrentParm->IsPendingKill())
+			continue;
+
+		if (!CurrentParm->HasChanged() || !CurrentParm->NeedsToTriggerUpdate())
+			continue;
+
+		LastEditTime = FMath::Max(LastEditTime, CurrentParm->GetLastChangeTime());
+	}
+
+	for (auto CurrentInput : Inputs)
+	{
+		if (!CurrentInput || CurrentInput->IsPendingKill())
+			continue;
+
+		if (!CurrentInput->HasChanged() || !CurrentInput->NeedsToTriggerUpdate())
+			continue;
+
+		LastEditTime = FMath::Max(LastEditTime, CurrentInput->GetLastChangeTime());
+	}
+
+	return LastEditTime;
+}
+
+bool
+UHoudiniAssetComponent::IsWaitingForEditsToSettle() const
+{
+	// Explicit update requests are never delayed
+	if (bForceNeedUpdate || bRecookRequested || bRebuildRequested)
+		return false;
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	const float CoalescingTime = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->ParameterEditCoalescingTime : 0.0f;
+	if (CoalescingTime <= 0.0f)
+		return false;
+
+	const double LastEditTime = GetLastParameterOrInputEditTime();
+	if (LastEditTime <= 0.0)
+		return false;
+
+	return (FPlatformTime::Seconds() - LastEditTime) < CoalescingTime;
+}
+
+bool
+UHoudiniAssetComponent::ShouldCookInPreviewMode() const
+{
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	if (!HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bEnablePreviewCookWhileEditing)
+		return false;
+
+	// Explicit recooks/rebuilds, bakes and requests for final meshes always need the full output processing
+	if (bForceNeedUpdate || bRecookRequested || bRebuildRequested)
+		return false;
+
+	if (bBakeAfterNextCook || bNoProxyMeshNextCookRequested || HasBeenLoaded())
+		return false;
+
+	// Only cooks triggered by parameter/input edits are previewed
+	return GetLastParameterOrInputEditTime() > 0.0;
+}
+
+bool
+UHoudiniAssetComponent::NeedPreviewOutputsRefinement() const
+{
+	if (!bHasPreviewOutputs)
+		return false;
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	const float RefinementDelay = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->PreviewCookRefinementDelay : 0.0f;
+
+	return (FPlatformTime::Seconds() - PreviewOutputsEditTime) >= RefinementDelay;
+}
+
 bool
 UHoudiniAssetComponent::HasPreviousBakeOutput() const
 {
@@ -82,6 +82,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetComponent : public UPrimitiveCompone
 	friend struct FHoudiniParameterTranslator;
 	friend struct FHoudiniPDGManager;
 	friend struct FHoudiniHandleTranslator;
+	friend class UHoudiniLegacyConversionCommandlet;
 
 #if WITH_EDITORONLY_DATA
 	friend class FHoudiniAssetComponentDetails;
@@ -235,6 +236,18 @@ public:
 	// Returns true if a parameter definition update (excluding values) is needed.
 	bool IsParameterDefinitionUpdateNeeded() const { return bParameterDefinitionUpdateNeeded; }
 
+	// Returns the most recent time (FPlatformTime::Seconds) a pending parameter or input edit was made, 0 if none.
+	double GetLastParameterOrInputEditTime() const;
+	// Returns true if the pending update only comes from parameter/input edits that are still
+	// within the edit coalescing window, and the cook should thus be delayed.
+	bool IsWaitingForEditsToSettle() const;
+	// Returns true if the next cook should only produce preview outputs (see bEnablePreviewCookWhileEditing)
+	bool ShouldCookInPreviewMode() const;
+	// Returns true if the current outputs were produced by a preview cook
+	bool HasPreviewOutputs() const { return bHasPreviewOutputs; }
+	// Returns true if the preview outputs should now be refined, as no edits were made for a while
+	bool NeedPreviewOutputsRefinement() const;
+
 	//------------------------------------------------------------------------------------------------
 	// Mutators
 	//------------------------------------------------------------------------------------------------
@@ -283,6 +296,9 @@ public:
 	// Set to True to force the next cook to bake the asset after the cook completes.
 	void SetBakeAfterNextCookEnabled(bool bInEnabled) { bBakeAfterNextCook = bInEnabled; }
 
+	// Indicates if the outputs of the next cook should be processed as a preview
+	void SetHasPreviewOutputs(bool bInHasPreviewOutputs) { bHasPreviewOutputs = bInHasPreviewOutputs; }
+
 	//
 	void SetPDGAssetLink(UHoudiniPDGAssetLink* InPDGAssetLink);
 	//
@@ -576,6 +592,11 @@ public:
 	UPROPERTY()
 	bool bRecenterBakedActors;
 
+	// If true, mesh split instancers are baked to hierarchical instanced static mesh components
+	// (instance colors are stored as per-instance custom data) instead of one component per instance
+	UPROPERTY()
+	bool bBakeMeshSplitInstancersAsInstances;
+
 	// If true, replace the previously baked output (if any) instead of creating new objects
 	UPROPERTY()
 	bool bReplacePreviousBake;
@@ -726,6 +747,15 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	bool bBakeAfterNextCook;
 
+	// If true, the outputs were (or are being) processed by a preview cook:
+	// expensive output stages have been skipped and the outputs need to be refined once the edits have settled.
+	UPROPERTY(Transient, DuplicateTransient)
+	bool bHasPreviewOutputs;
+
+	// Time of the last parameter/input edit that was included in the current preview outputs
+	UPROPERTY(Transient, DuplicateTransient)
+	double PreviewOutputsEditTime;
+
 	// Delegate to broadcast after a post cook event
 	// Arguments are (HoudiniAssetComponent* HAC, bool IsSuccessful)
 	FOnPostCookDelegate OnPostCookDelegate;
@@ -754,6 +784,10 @@ protected:
 	// Object used to convert V1 HAC to V2 HAC
 	UHoudiniAssetComponent_V1* Version1CompatibilityHAC;
 
+	// Indicates that this component was converted from legacy v1 data when it was loaded
+	UPROPERTY(Transient, DuplicateTransient)
+	bool bConvertedFromLegacyData;
+
 	// The last timestamp this component was ticked
 	// used to prioritize/limit the number of HAC processed per tick
 	UPROPERTY(Transient)
@@ -29,6 +29,7 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniWorldInputChangeTracker.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -72,6 +73,8 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FHoudiniWorldInputChangeTracker::Get().Shutdown();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
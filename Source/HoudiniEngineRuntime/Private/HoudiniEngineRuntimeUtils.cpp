@@ -27,6 +27,7 @@
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniWorldInputChangeTracker.h"
 
 #include "EngineUtils.h"
 #include "Engine/EngineTypes.h"
@@ -78,9 +79,17 @@ FHoudiniEngineRuntimeUtils::FindActorsOfClassInBounds(UWorld* World, TSubclassOf
 		return false;
 	
 	OutActors.Empty();
-	for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+
+	// Only look at the actors that are near the bounding boxes if possible
+	TArray<AActor*> CandidateActors;
+	if (!FHoudiniWorldInputChangeTracker::Get().FindActorsInBounds(World, BBoxes, CandidateActors))
+	{
+		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+			CandidateActors.Add(*ActorItr);
+	}
+
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor* CurrentActor = *ActorItr;
 		if (!IsValid(CurrentActor))
 			continue;
 		
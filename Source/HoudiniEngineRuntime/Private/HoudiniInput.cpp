@@ -34,6 +34,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniWorldInputChangeTracker.h"
 
 #include "EngineUtils.h"
 #include "Engine/Brush.h"
@@ -67,6 +68,7 @@ UHoudiniInput::UHoudiniInput()
 	, ParmId(-1)
 	, bIsObjectPathParameter(false)
 	, bHasChanged(false)
+	, LastChangeTime(0.0)
 	, bPackBeforeMerge(false)
 	, bExportLODs(false)
 	, bExportSockets(false)
@@ -2012,6 +2014,24 @@ UHoudiniInput::HasChanged()
 	return false;
 }
 
+double
+UHoudiniInput::GetLastChangeTime()
+{
+	double LastTime = LastChangeTime;
+
+	TArray<UHoudiniInputObject*>* InputObjectsPtr = GetHoudiniInputObjectArray(Type);
+	if (!InputObjectsPtr)
+		return LastTime;
+
+	for (auto CurrentInputObject : (*InputObjectsPtr))
+	{
+		if (CurrentInputObject && CurrentInputObject->HasChanged())
+			LastTime = FMath::Max(LastTime, CurrentInputObject->GetLastChangeTime());
+	}
+
+	return LastTime;
+}
+
 bool
 UHoudiniInput::IsTransformUploadNeeded()
 {
@@ -2361,10 +2381,18 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 
 	//UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
 	UWorld* MyWorld = GetWorld();
+
+	// Only look at the actors that are near the bound selectors if possible
+	TArray<AActor*> CandidateActors;
+	if (!FHoudiniWorldInputChangeTracker::Get().FindActorsInBounds(MyWorld, AllBBox, CandidateActors))
+	{
+		for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+			CandidateActors.Add(*ActorItr);
+	}
+
 	TArray<AActor*> NewSelectedActors;
-	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor *CurrentActor = *ActorItr;
 		if (!CurrentActor || CurrentActor->IsPendingKill())
 			continue;
 
@@ -115,6 +115,8 @@ public:
 	bool HasChanged();
 	// Indicates if this input needs to trigger an update
 	bool NeedsToTriggerUpdate();
+	// Returns the last time this input or one of its input objects was marked as changed
+	double GetLastChangeTime();
 	// Indicates this input should upload its data
 	bool IsDataUploadNeeded();
 	// Indicates this input's transform need to be uploaded
@@ -219,6 +221,8 @@ public:
 	{
 		bHasChanged = bInChanged;
 		SetNeedsToTriggerUpdate(bInChanged);
+		if (bInChanged)
+			LastChangeTime = FPlatformTime::Seconds();
 	};
 	void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	void MarkDataUploadNeeded(const bool& bInDataUploadNeeded) { bDataUploadNeeded = bInDataUploadNeeded; };
@@ -393,6 +397,10 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient)
 	bool bHasChanged;
 
+	// Time at which the input was last marked as changed, used to coalesce successive edits
+	UPROPERTY(Transient, DuplicateTransient)
+	double LastChangeTime;
+
 	// Indicates this input should trigger an HDA update/cook
 	UPROPERTY(Transient, DuplicateTransient)
 	bool bNeedsToTriggerUpdate;
@@ -63,6 +63,7 @@ UHoudiniInputObject::UHoudiniInputObject(const FObjectInitializer& ObjectInitial
 	, InputNodeId(-1)
 	, InputObjectNodeId(-1)
 	, bHasChanged(false)
+	, LastChangeTime(0.0)
 	, bNeedsToTriggerUpdate(false)
 	, bTransformChanged(false)
 	, bImportAsReference(false)
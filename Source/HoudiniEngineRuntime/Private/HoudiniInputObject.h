@@ -121,8 +121,11 @@ public:
 	// Indicates if this input needs to trigger an update
 	virtual bool NeedsToTriggerUpdate() const { return bNeedsToTriggerUpdate; };
 
-	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
-	void MarkTransformChanged(const bool& bInChanged) { bTransformChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
+	// Returns the time (FPlatformTime::Seconds) at which this input object was last marked as changed
+	double GetLastChangeTime() const { return LastChangeTime; };
+
+	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); if (bInChanged) LastChangeTime = FPlatformTime::Seconds(); };
+	void MarkTransformChanged(const bool& bInChanged) { bTransformChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); if (bInChanged) LastChangeTime = FPlatformTime::Seconds(); };
 	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 
 	void SetImportAsReference(const bool& bInImportAsRef) { bImportAsReference = bInImportAsRef; };
@@ -183,6 +186,10 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	bool bHasChanged;
 
+	// Time at which the input object was last marked as changed, used to coalesce successive edits
+	UPROPERTY(Transient, DuplicateTransient)
+	double LastChangeTime;
+
 	// Indicates this input object should trigger an input update/cook
 	UPROPERTY(DuplicateTransient)
 	bool bNeedsToTriggerUpdate;
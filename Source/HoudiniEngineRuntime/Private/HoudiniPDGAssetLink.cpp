@@ -71,6 +71,7 @@ UHoudiniPDGAssetLink::UHoudiniPDGAssetLink(const FObjectInitializer& ObjectIniti
 	PDGBakeSelectionOption = EPDGBakeSelectionOption::All;
 	PDGBakePackageReplaceMode = EPDGBakePackageReplaceModeOption::ReplaceExistingAssets;
 	bRecenterBakedActors = false;
+	bBakeMeshSplitInstancersAsInstances = false;
 	bBakeAfterAllWorkResultObjectsLoaded = false;
 #endif
 	
@@ -880,6 +880,11 @@ public:
 	UPROPERTY()
 	bool bRecenterBakedActors;
 
+	// If true, mesh split instancers are baked to hierarchical instanced static mesh components
+	// (instance colors are stored as per-instance custom data) instead of one component per instance
+	UPROPERTY()
+	bool bBakeMeshSplitInstancersAsInstances;
+
 	// Auto-bake: if this is true, it indicates that once all work result objects for the node is loaded they should
 	// all be baked 
 	UPROPERTY()
@@ -39,6 +39,7 @@ UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitialize
 	, bHasChanged(false)
 	, bNeedsToTriggerUpdate(true)
 	, bIsDefault(false)
+	, LastChangeTime(0.0)
 	, bIsSpare(false)
 	, bJoinNext(false)
 	, bIsChildOfMultiParm(false)
@@ -73,6 +74,16 @@ UHoudiniParameter::IsChildParameter() const
 	return ParentParmId >= 0;
 }
 
+void
+UHoudiniParameter::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	if (bInChanged)
+		LastChangeTime = FPlatformTime::Seconds();
+}
+
 void
 UHoudiniParameter::RevertToDefault()
 {
@@ -107,6 +107,8 @@ public:
 	virtual bool IsDisabled() const { return bIsDisabled; };
 	virtual bool HasChanged() const { return bHasChanged; };
 	virtual bool NeedsToTriggerUpdate() const { return bNeedsToTriggerUpdate; };
+	// Returns the time (FPlatformTime::Seconds) at which this parameter was last marked as changed
+	double GetLastChangeTime() const { return LastChangeTime; };
 	virtual bool IsDefault() const { return true; };
 	virtual bool IsSpare() const { return bIsSpare; };
 	virtual bool GetJoinNext() const { return bJoinNext; };
@@ -158,7 +160,7 @@ public:
 	virtual void SetTagCount(const uint32& InTagCount) { TagCount = InTagCount; };
 	virtual void SetValueIndex(const uint32& InValueIndex) { ValueIndex = InValueIndex; };
 
-	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
+	virtual void MarkChanged(const bool& bInChanged);
 	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	virtual void RevertToDefault();
 	virtual void RevertToDefault(const int32& TupleIndex);
@@ -258,6 +260,10 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient)
 	bool bIsDefault;
 
+	// Time at which the parameter was last marked as changed, used to coalesce successive edits
+	UPROPERTY(Transient, DuplicateTransient)
+	double LastChangeTime;
+
 	// Permissions for file parms
 	UPROPERTY()
 	bool bIsSpare;
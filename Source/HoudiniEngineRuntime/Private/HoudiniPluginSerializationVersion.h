@@ -76,6 +76,7 @@ enum EHoudiniPluginSerializationVersion
 
 	//------<Legacy v1 versions go above this line>------------------------------------------------------
 	VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_BASE = 100,
+	VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_COMPACT_STATIC_MESH = 101,
 
     // -----<new versions can be added before this line>-------------------------------------------------
     // - this needs to be the last line (see note below)
@@ -79,6 +79,9 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	bDisplaySlateCookingNotifications = true;
 	DefaultTemporaryCookFolder = HAPI_UNREAL_DEFAULT_TEMP_COOK_FOLDER;
 	DefaultBakeFolder = HAPI_UNREAL_DEFAULT_BAKE_FOLDER;
+	ParameterEditCoalescingTime = 0.0f;
+	bEnablePreviewCookWhileEditing = false;
+	PreviewCookRefinementDelay = 1.0f;
 
 	// Parameter options
 	//bTreatRampParametersAsMultiparms = false;
@@ -108,6 +111,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ProxyMeshAutoRefineTimeoutSeconds = 10.0f;
 	bEnableProxyStaticMeshRefinementOnPreSaveWorld = true;
 	bEnableProxyStaticMeshRefinementOnPreBeginPIE = true;
+	bCompactProxyStaticMeshSerialization = false;
 
 	// Generated StaticMesh settings.
 	bDoubleSidedGeometry = false;
@@ -141,6 +145,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	DistanceFieldResolutionScale = 2.0f; // ue default is 1.0
 
 	bPDGAsyncCommandletImportEnabled = false;
+	PDGAsyncCommandletImportWorkerCount = 1;
+	PDGAsyncCommandletMaxImportsPerWorker = 2;
 
 	// Legacy settings
 	bEnableBackwardCompatibility = true;
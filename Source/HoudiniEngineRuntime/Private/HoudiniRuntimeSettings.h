@@ -252,6 +252,22 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		FString DefaultBakeFolder;
 
+		// Delay (in seconds) after the last parameter or input edit before a cook is started.
+		// Successive edits made within this window (ie. when dragging a slider) are merged into a single upload and cook.
+		// <= 0.0 (default) disables the coalescing and starts a cook as soon as a change is detected.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (DisplayName = "Parameter Edit Coalescing Time", UIMin = "0.0", UIMax = "2.0"))
+		float ParameterEditCoalescingTime;
+
+		// If enabled, cooks triggered by parameter or input edits only create a preview of the outputs:
+		// proxy meshes are used instead of building static meshes and collisions, and existing materials/textures are reused.
+		// The outputs are fully processed once the edits have settled.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (DisplayName = "Preview Cook While Editing"))
+		bool bEnablePreviewCookWhileEditing;
+
+		// Time (in seconds) without any parameter or input edit after which the preview outputs are fully processed.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (DisplayName = "Preview Cook Refinement Delay", EditCondition = "bEnablePreviewCookWhileEditing", UIMin = "0.0", UIMax = "10.0"))
+		float PreviewCookRefinementDelay;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Parameter options.
 		//-------------------------------------------------------------------------------------------------------------
@@ -326,6 +342,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Refine Proxy Static Meshes On PIE", EditCondition = "bEnableProxyStaticMesh"))
 		bool bEnableProxyStaticMeshRefinementOnPreBeginPIE;
 
+		// Save the proxy meshes' normals, tangents, colors and UVs in a quantized and compressed form.
+		// This reduces the size of maps with many proxy meshes, but the saved data loses some precision.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Compact Proxy Static Mesh Serialization", EditCondition = "bEnableProxyStaticMesh"))
+		bool bCompactProxyStaticMeshSerialization;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Generated StaticMesh settings.
 		//-------------------------------------------------------------------------------------------------------------
@@ -459,6 +480,14 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Enabled"))
 		bool bPDGAsyncCommandletImportEnabled;
 
+		// Number of async importer processes to run. Work item results are dispatched to the least loaded importer.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Worker Count", ClampMin = "1", UIMin = "1", UIMax = "16", EditCondition = "bPDGAsyncCommandletImportEnabled"))
+		int32 PDGAsyncCommandletImportWorkerCount;
+
+		// Maximum number of imports sent to a single async importer at a time. Further imports are queued until an importer is available.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Max Imports Per Worker", ClampMin = "1", UIMin = "1", UIMax = "32", EditCondition = "bPDGAsyncCommandletImportEnabled"))
+		int32 PDGAsyncCommandletMaxImportsPerWorker;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Legacy
 		//-------------------------------------------------------------------------------------------------------------
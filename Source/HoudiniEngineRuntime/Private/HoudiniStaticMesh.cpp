@@ -26,9 +26,69 @@
 
 #include "HoudiniStaticMesh.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniPluginSerializationVersion.h"
+#include "HoudiniRuntimeSettings.h"
 
 #include "Async/ParallelFor.h"
 #include "MeshUtilitiesCommon.h"
+#include "Math/Vector2DHalf.h"
+#include "Misc/Compression.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// Flags describing the content of the compact vertex instance data
+enum EHoudiniStaticMeshCompactFlags : uint8
+{
+	HSMCF_Normals = 1 << 0,
+	HSMCF_UTangents = 1 << 1,
+	HSMCF_VTangentSigns = 1 << 2,
+	HSMCF_VTangents = 1 << 3,
+	HSMCF_Colors = 1 << 4,
+	HSMCF_UVs = 1 << 5,
+};
+
+// Encodes a direction as two 16 bits snorm values, using an octahedral projection
+static uint32
+PackUnitVector(const FVector& InVector)
+{
+	FVector Dir = InVector.GetSafeNormal();
+	if (Dir.IsZero())
+		Dir = FVector(0, 0, 1);
+
+	const float L1Norm = FMath::Abs(Dir.X) + FMath::Abs(Dir.Y) + FMath::Abs(Dir.Z);
+	float X = Dir.X / L1Norm;
+	float Y = Dir.Y / L1Norm;
+	if (Dir.Z < 0.0f)
+	{
+		// Fold the lower hemisphere over the diagonals
+		const float FoldedX = (1.0f - FMath::Abs(Y)) * (X >= 0.0f ? 1.0f : -1.0f);
+		const float FoldedY = (1.0f - FMath::Abs(X)) * (Y >= 0.0f ? 1.0f : -1.0f);
+		X = FoldedX;
+		Y = FoldedY;
+	}
+
+	const int16 QuantizedX = (int16)FMath::RoundToInt(FMath::Clamp(X, -1.0f, 1.0f) * MAX_int16);
+	const int16 QuantizedY = (int16)FMath::RoundToInt(FMath::Clamp(Y, -1.0f, 1.0f) * MAX_int16);
+	return (uint32)(uint16)QuantizedX | ((uint32)(uint16)QuantizedY << 16);
+}
+
+static FVector
+UnpackUnitVector(const uint32& InPacked)
+{
+	float X = (float)(int16)(InPacked & 0xFFFF) / MAX_int16;
+	float Y = (float)(int16)(InPacked >> 16) / MAX_int16;
+	const float Z = 1.0f - FMath::Abs(X) - FMath::Abs(Y);
+	if (Z < 0.0f)
+	{
+		const float UnfoldedX = (1.0f - FMath::Abs(Y)) * (X >= 0.0f ? 1.0f : -1.0f);
+		const float UnfoldedY = (1.0f - FMath::Abs(X)) * (Y >= 0.0f ? 1.0f : -1.0f);
+		X = UnfoldedX;
+		Y = UnfoldedY;
+	}
+
+	return FVector(X, Y, Z).GetSafeNormal();
+}
 
 UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -38,10 +98,20 @@ UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializ
 	bHasColors = false;
 	NumUVLayers = 0;
 	bHasPerFaceMaterials = false;
+	CompactVertexInstanceDataUncompressedSize = 0;
+	bHasCompactVertexInstanceData = false;
 }
 
 void UHoudiniStaticMesh::Initialize(uint32 InNumVertices, uint32 InNumTriangles, uint32 InNumUVLayers, uint32 InInitialNumStaticMaterials, bool bInHasNormals, bool bInHasTangents, bool bInHasColors, bool bInHasPerFaceMaterials)
 {
+	// The compact data, if any, is replaced by the new mesh
+	{
+		FScopeLock Lock(&CompactVertexInstanceDataLock);
+		CompactVertexInstanceData.Empty();
+		CompactVertexInstanceDataUncompressedSize = 0;
+		bHasCompactVertexInstanceData = false;
+	}
+
 	// Initialize the vertex positions and triangle indices arrays
 	VertexPositions.Init(FVector::ZeroVector, InNumVertices);
 	TriangleIndices.Init(FIntVector(-1, -1, -1), InNumTriangles);
@@ -68,6 +138,8 @@ void UHoudiniStaticMesh::SetHasPerFaceMaterials(bool bInHasPerFaceMaterials)
 
 void UHoudiniStaticMesh::SetHasNormals(bool bInHasNormals)
 {
+	DecodeCompactVertexInstanceData();
+
 	bHasNormals = bInHasNormals;
 	if (bHasNormals)
 		VertexInstanceNormals.Init(FVector(0, 0, 1), GetNumVertexInstances());
@@ -77,6 +149,8 @@ void UHoudiniStaticMesh::SetHasNormals(bool bInHasNormals)
 
 void UHoudiniStaticMesh::SetHasTangents(bool bInHasTangents)
 {
+	DecodeCompactVertexInstanceData();
+
 	bHasTangents = bInHasTangents;
 	if (bHasTangents)
 	{
@@ -92,6 +166,8 @@ void UHoudiniStaticMesh::SetHasTangents(bool bInHasTangents)
 
 void UHoudiniStaticMesh::SetHasColors(bool bInHasColors)
 {
+	DecodeCompactVertexInstanceData();
+
 	bHasColors = bInHasColors;
 	if (bHasColors)
 		VertexInstanceColors.Init(FColor(127, 127, 127), GetNumVertexInstances());
@@ -101,6 +177,8 @@ void UHoudiniStaticMesh::SetHasColors(bool bInHasColors)
 
 void UHoudiniStaticMesh::SetNumUVLayers(uint32 InNumUVLayers)
 {
+	DecodeCompactVertexInstanceData();
+
 	NumUVLayers = InNumUVLayers;
 	if (NumUVLayers > 0)
 		VertexInstanceUVs.Init(FVector2D::ZeroVector, GetNumVertexInstances() * NumUVLayers);
@@ -140,6 +218,8 @@ void UHoudiniStaticMesh::SetTriangleVertexNormal(uint32 InTriangleIndex, uint8 I
 		return;
 	}
 
+	DecodeCompactVertexInstanceData();
+
 	check(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
 	check(VertexInstanceNormals.IsValidIndex(VertexInstanceIndex));
@@ -154,6 +234,8 @@ void UHoudiniStaticMesh::SetTriangleVertexUTangent(uint32 InTriangleIndex, uint8
 		return;
 	}
 
+	DecodeCompactVertexInstanceData();
+
 	check(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
 	check(VertexInstanceUTangents.IsValidIndex(VertexInstanceIndex));
@@ -168,6 +250,8 @@ void UHoudiniStaticMesh::SetTriangleVertexVTangent(uint32 InTriangleIndex, uint8
 		return;
 	}
 
+	DecodeCompactVertexInstanceData();
+
 	check(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
 	check(VertexInstanceVTangents.IsValidIndex(VertexInstanceIndex));
@@ -182,6 +266,8 @@ void UHoudiniStaticMesh::SetTriangleVertexColor(uint32 InTriangleIndex, uint8 In
 		return;
 	}
 
+	DecodeCompactVertexInstanceData();
+
 	check(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceIndex = InTriangleIndex * 3 + InTriangleVertexIndex;
 	check(VertexInstanceColors.IsValidIndex(VertexInstanceIndex));
@@ -196,6 +282,8 @@ void UHoudiniStaticMesh::SetTriangleVertexUV(uint32 InTriangleIndex, uint8 InTri
 		return;
 	}
 
+	DecodeCompactVertexInstanceData();
+
 	check(TriangleIndices.IsValidIndex(InTriangleIndex));
 	const uint32 VertexInstanceUVIndex = InUVLayer * GetNumVertexInstances() + InTriangleIndex * 3 + InTriangleVertexIndex;
 	check(VertexInstanceUVs.IsValidIndex(VertexInstanceUVIndex));
@@ -224,6 +312,8 @@ void UHoudiniStaticMesh::SetStaticMaterial(uint32 InMaterialIndex, const FStatic
 
 void UHoudiniStaticMesh::CalculateNormals(bool bInComputeWeightedNormals)
 {
+	DecodeCompactVertexInstanceData();
+
 	const int32 NumVertexInstances = GetNumVertexInstances();
 
 	// Pre-allocate space in the vertex instance normals array
@@ -320,6 +410,8 @@ void UHoudiniStaticMesh::CalculateNormals(bool bInComputeWeightedNormals)
 
 void UHoudiniStaticMesh::CalculateTangents(bool bInComputeWeightedNormals)
 {
+	DecodeCompactVertexInstanceData();
+
 	const int32 NumVertexInstances = GetNumVertexInstances();
 
 	VertexInstanceUTangents.SetNum(NumVertexInstances);
@@ -342,6 +434,8 @@ void UHoudiniStaticMesh::CalculateTangents(bool bInComputeWeightedNormals)
 
 void UHoudiniStaticMesh::Optimize()
 {
+	DecodeCompactVertexInstanceData();
+
 	VertexPositions.Shrink();
 	TriangleIndices.Shrink();
 	VertexInstanceColors.Shrink();
@@ -397,6 +491,8 @@ int32 UHoudiniStaticMesh::GetMaterialIndex(FName InMaterialSlotName) const
 
 bool UHoudiniStaticMesh::IsValid(bool bInSkipVertexIndicesCheck) const
 {
+	DecodeCompactVertexInstanceData();
+
 	// Validate the number of vertices, indices and triangles. This is basically the same function as FRawMesh::IsValid()
 	const int32 NumVertices = GetNumVertices();
 	const int32 NumVertexInstances = GetNumVertexInstances();
@@ -438,28 +534,294 @@ void UHoudiniStaticMesh::Serialize(FArchive &InArchive)
 {
 	Super::Serialize(InArchive);
 
-	VertexPositions.Shrink();
-	VertexPositions.BulkSerialize(InArchive);
+	InArchive.UsingCustomVersion(FHoudiniCustomSerializationVersion::GUID);
 
-	TriangleIndices.Shrink();
+	// Don't let a concurrent decode empty the compact data while we save it
+	FScopeLock Lock(&CompactVertexInstanceDataLock);
+
+	// Older versions always saved the full precision vertex instance data
+	if (InArchive.IsLoading() && InArchive.CustomVer(FHoudiniCustomSerializationVersion::GUID) < VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_V2_COMPACT_STATIC_MESH)
+	{
+		CompactVertexInstanceData.Empty();
+		CompactVertexInstanceDataUncompressedSize = 0;
+		bHasCompactVertexInstanceData = false;
+
+		VertexPositions.BulkSerialize(InArchive);
+		TriangleIndices.BulkSerialize(InArchive);
+		VertexInstanceColors.BulkSerialize(InArchive);
+		VertexInstanceNormals.BulkSerialize(InArchive);
+		VertexInstanceUTangents.BulkSerialize(InArchive);
+		VertexInstanceVTangents.BulkSerialize(InArchive);
+		VertexInstanceUVs.BulkSerialize(InArchive);
+		MaterialIDsPerTriangle.BulkSerialize(InArchive);
+		return;
+	}
+
+	bool bCompact = false;
+	bool bEncodedForSaving = false;
+	if (InArchive.IsSaving())
+	{
+		if (HasCompactVertexInstanceData())
+		{
+			// The data hasn't been decoded, so it hasn't changed since it was loaded
+			bCompact = true;
+		}
+		else
+		{
+			// Only use the compact form when saving to disk, not for undo/redo or duplication
+			const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+			if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bCompactProxyStaticMeshSerialization
+				&& InArchive.IsPersistent() && !InArchive.IsTransacting() && GetNumVertexInstances() > 0)
+			{
+				const int64 RawSize = VertexInstanceColors.Num() * sizeof(FColor)
+					+ (VertexInstanceNormals.Num() + VertexInstanceUTangents.Num() + VertexInstanceVTangents.Num()) * sizeof(FVector)
+					+ VertexInstanceUVs.Num() * sizeof(FVector2D);
+
+				bCompact = EncodeCompactVertexInstanceData(CompactVertexInstanceData, CompactVertexInstanceDataUncompressedSize);
+				bEncodedForSaving = bCompact;
+				if (bCompact)
+				{
+					HOUDINI_LOG_MESSAGE(
+						TEXT("[UHoudiniStaticMesh::Serialize] %s: saving %d bytes of compact vertex instance data instead of %lld bytes."),
+						*GetPathName(), CompactVertexInstanceData.Num(), RawSize);
+				}
+			}
+		}
+	}
+
+	InArchive << bCompact;
+
+	VertexPositions.BulkSerialize(InArchive);
 	TriangleIndices.BulkSerialize(InArchive);
+	MaterialIDsPerTriangle.BulkSerialize(InArchive);
 
-	VertexInstanceColors.Shrink();
-	VertexInstanceColors.BulkSerialize(InArchive);
+	if (bCompact)
+	{
+		InArchive << CompactVertexInstanceDataUncompressedSize;
+		CompactVertexInstanceData.BulkSerialize(InArchive);
 
-	VertexInstanceNormals.Shrink();
-	VertexInstanceNormals.BulkSerialize(InArchive);
+		if (InArchive.IsLoading())
+		{
+			// The compact data will be decoded on first access (usually when building the render proxy)
+			bHasCompactVertexInstanceData = CompactVertexInstanceData.Num() > 0;
+			VertexInstanceColors.Empty();
+			VertexInstanceNormals.Empty();
+			VertexInstanceUTangents.Empty();
+			VertexInstanceVTangents.Empty();
+			VertexInstanceUVs.Empty();
+		}
+		else if (bEncodedForSaving)
+		{
+			// The vertex instance arrays are still valid, no need to keep the compact copy around
+			CompactVertexInstanceData.Empty();
+			CompactVertexInstanceDataUncompressedSize = 0;
+		}
+	}
+	else
+	{
+		if (InArchive.IsLoading())
+		{
+			CompactVertexInstanceData.Empty();
+			CompactVertexInstanceDataUncompressedSize = 0;
+			bHasCompactVertexInstanceData = false;
+		}
 
-	VertexInstanceUTangents.Shrink();
-	VertexInstanceUTangents.BulkSerialize(InArchive);
+		VertexInstanceColors.BulkSerialize(InArchive);
+		VertexInstanceNormals.BulkSerialize(InArchive);
+		VertexInstanceUTangents.BulkSerialize(InArchive);
+		VertexInstanceVTangents.BulkSerialize(InArchive);
+		VertexInstanceUVs.BulkSerialize(InArchive);
+	}
+}
 
-	VertexInstanceVTangents.Shrink();
-	VertexInstanceVTangents.BulkSerialize(InArchive);
+bool UHoudiniStaticMesh::EncodeCompactVertexInstanceData(TArray<uint8>& OutCompactData, int32& OutUncompressedSize) const
+{
+	OutCompactData.Empty();
+	OutUncompressedSize = 0;
 
-	VertexInstanceUVs.Shrink();
-	VertexInstanceUVs.BulkSerialize(InArchive);
+	const int32 NumVertexInstances = GetNumVertexInstances();
 
-	MaterialIDsPerTriangle.Shrink();
-	MaterialIDsPerTriangle.BulkSerialize(InArchive);
+	uint8 Flags = 0;
+	TArray<uint32> PackedNormals;
+	TArray<uint32> PackedUTangents;
+	TArray<uint32> PackedVTangents;
+	TArray<int8> VTangentSigns;
+	TArray<FVector2DHalf> HalfUVs;
+
+	if (VertexInstanceNormals.Num() == NumVertexInstances)
+	{
+		Flags |= HSMCF_Normals;
+		PackedNormals.SetNumUninitialized(NumVertexInstances);
+		ParallelFor(NumVertexInstances, [this, &PackedNormals](int32 VertexInstanceIndex)
+		{
+			PackedNormals[VertexInstanceIndex] = PackUnitVector(VertexInstanceNormals[VertexInstanceIndex]);
+		});
+	}
+
+	if (VertexInstanceUTangents.Num() == NumVertexInstances)
+	{
+		Flags |= HSMCF_UTangents;
+		PackedUTangents.SetNumUninitialized(NumVertexInstances);
+		ParallelFor(NumVertexInstances, [this, &PackedUTangents](int32 VertexInstanceIndex)
+		{
+			PackedUTangents[VertexInstanceIndex] = PackUnitVector(VertexInstanceUTangents[VertexInstanceIndex]);
+		});
+	}
+
+	if (VertexInstanceVTangents.Num() == NumVertexInstances)
+	{
+		if ((Flags & HSMCF_Normals) && (Flags & HSMCF_UTangents))
+		{
+			// The V tangent can be rebuilt from the normal and U tangent, only keep its direction
+			Flags |= HSMCF_VTangentSigns;
+			VTangentSigns.SetNumUninitialized(NumVertexInstances);
+			ParallelFor(NumVertexInstances, [this, &VTangentSigns](int32 VertexInstanceIndex)
+			{
+				const FVector Binormal = FVector::CrossProduct(
+					VertexInstanceNormals[VertexInstanceIndex], VertexInstanceUTangents[VertexInstanceIndex]);
+				VTangentSigns[VertexInstanceIndex] = (FVector::DotProduct(Binormal, VertexInstanceVTangents[VertexInstanceIndex]) < 0.0f) ? -1 : 1;
+			});
+		}
+		else
+		{
+			Flags |= HSMCF_VTangents;
+			PackedVTangents.SetNumUninitialized(NumVertexInstances);
+			ParallelFor(NumVertexInstances, [this, &PackedVTangents](int32 VertexInstanceIndex)
+			{
+				PackedVTangents[VertexInstanceIndex] = PackUnitVector(VertexInstanceVTangents[VertexInstanceIndex]);
+			});
+		}
+	}
+
+	if (VertexInstanceColors.Num() == NumVertexInstances)
+		Flags |= HSMCF_Colors;
+
+	if (NumUVLayers > 0 && VertexInstanceUVs.Num() == NumUVLayers * NumVertexInstances)
+	{
+		Flags |= HSMCF_UVs;
+		HalfUVs.SetNumUninitialized(VertexInstanceUVs.Num());
+		ParallelFor(VertexInstanceUVs.Num(), [this, &HalfUVs](int32 UVIndex)
+		{
+			HalfUVs[UVIndex] = FVector2DHalf(VertexInstanceUVs[UVIndex]);
+		});
+	}
+
+	// Write the packed arrays to a buffer and compress it
+	TArray<uint8> UncompressedData;
+	FMemoryWriter Writer(UncompressedData, true);
+	int32 SerializedNumVertexInstances = NumVertexInstances;
+	Writer << SerializedNumVertexInstances;
+	Writer << Flags;
+	PackedNormals.BulkSerialize(Writer);
+	PackedUTangents.BulkSerialize(Writer);
+	PackedVTangents.BulkSerialize(Writer);
+	VTangentSigns.BulkSerialize(Writer);
+	const_cast<TArray<FColor>&>(VertexInstanceColors).BulkSerialize(Writer);
+	HalfUVs.BulkSerialize(Writer);
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedData.Num());
+	OutCompactData.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, OutCompactData.GetData(), CompressedSize, UncompressedData.GetData(), UncompressedData.Num()))
+	{
+		OutCompactData.Empty();
+		return false;
+	}
+
+	OutCompactData.SetNum(CompressedSize, false);
+	OutUncompressedSize = UncompressedData.Num();
+
+	return true;
 }
 
+void UHoudiniStaticMesh::DecodeCompactVertexInstanceData() const
+{
+	if (!HasCompactVertexInstanceData())
+		return;
+
+	// Another thread may have decoded the data while we were waiting for the lock
+	FScopeLock Lock(&CompactVertexInstanceDataLock);
+	if (!HasCompactVertexInstanceData())
+		return;
+
+	// The compact data is only a serialized form of the vertex instance arrays
+	UHoudiniStaticMesh* Mesh = const_cast<UHoudiniStaticMesh*>(this);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<uint8> UncompressedData;
+	UncompressedData.SetNumUninitialized(CompactVertexInstanceDataUncompressedSize);
+	const bool bUncompressed = FCompression::UncompressMemory(
+		NAME_Zlib, UncompressedData.GetData(), UncompressedData.Num(),
+		CompactVertexInstanceData.GetData(), CompactVertexInstanceData.Num());
+
+	Mesh->CompactVertexInstanceData.Empty();
+	Mesh->CompactVertexInstanceDataUncompressedSize = 0;
+
+	if (!bUncompressed)
+	{
+		Mesh->bHasCompactVertexInstanceData = false;
+		HOUDINI_LOG_WARNING(TEXT("[UHoudiniStaticMesh::DecodeCompactVertexInstanceData] %s: failed to uncompress the vertex instance data."), *GetPathName());
+		return;
+	}
+
+	FMemoryReader Reader(UncompressedData, true);
+	int32 NumVertexInstances = 0;
+	uint8 Flags = 0;
+	TArray<uint32> PackedNormals;
+	TArray<uint32> PackedUTangents;
+	TArray<uint32> PackedVTangents;
+	TArray<int8> VTangentSigns;
+	TArray<FVector2DHalf> HalfUVs;
+	Reader << NumVertexInstances;
+	Reader << Flags;
+	PackedNormals.BulkSerialize(Reader);
+	PackedUTangents.BulkSerialize(Reader);
+	PackedVTangents.BulkSerialize(Reader);
+	VTangentSigns.BulkSerialize(Reader);
+	Mesh->VertexInstanceColors.BulkSerialize(Reader);
+	HalfUVs.BulkSerialize(Reader);
+
+	Mesh->VertexInstanceNormals.SetNumUninitialized(PackedNormals.Num());
+	ParallelFor(PackedNormals.Num(), [Mesh, &PackedNormals](int32 VertexInstanceIndex)
+	{
+		Mesh->VertexInstanceNormals[VertexInstanceIndex] = UnpackUnitVector(PackedNormals[VertexInstanceIndex]);
+	});
+
+	Mesh->VertexInstanceUTangents.SetNumUninitialized(PackedUTangents.Num());
+	ParallelFor(PackedUTangents.Num(), [Mesh, &PackedUTangents](int32 VertexInstanceIndex)
+	{
+		Mesh->VertexInstanceUTangents[VertexInstanceIndex] = UnpackUnitVector(PackedUTangents[VertexInstanceIndex]);
+	});
+
+	if (Flags & HSMCF_VTangentSigns)
+	{
+		Mesh->VertexInstanceVTangents.SetNumUninitialized(VTangentSigns.Num());
+		ParallelFor(VTangentSigns.Num(), [Mesh, &VTangentSigns](int32 VertexInstanceIndex)
+		{
+			const FVector Binormal = FVector::CrossProduct(
+				Mesh->VertexInstanceNormals[VertexInstanceIndex], Mesh->VertexInstanceUTangents[VertexInstanceIndex]);
+			Mesh->VertexInstanceVTangents[VertexInstanceIndex] = Binormal.GetSafeNormal() * VTangentSigns[VertexInstanceIndex];
+		});
+	}
+	else
+	{
+		Mesh->VertexInstanceVTangents.SetNumUninitialized(PackedVTangents.Num());
+		ParallelFor(PackedVTangents.Num(), [Mesh, &PackedVTangents](int32 VertexInstanceIndex)
+		{
+			Mesh->VertexInstanceVTangents[VertexInstanceIndex] = UnpackUnitVector(PackedVTangents[VertexInstanceIndex]);
+		});
+	}
+
+	Mesh->VertexInstanceUVs.SetNumUninitialized(HalfUVs.Num());
+	ParallelFor(HalfUVs.Num(), [Mesh, &HalfUVs](int32 UVIndex)
+	{
+		Mesh->VertexInstanceUVs[UVIndex] = HalfUVs[UVIndex];
+	});
+
+	// Only publish the decoded arrays once they are complete: threads that see the flag cleared skip the lock
+	Mesh->bHasCompactVertexInstanceData = false;
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("[UHoudiniStaticMesh::DecodeCompactVertexInstanceData] %s: decoded %d vertex instances in %.3f ms."),
+		*GetPathName(), NumVertexInstances, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
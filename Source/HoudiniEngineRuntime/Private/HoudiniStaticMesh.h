@@ -28,6 +28,8 @@
 
 #include "CoreMinimal.h"
 #include "Engine/StaticMesh.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
 
 #include "HoudiniStaticMesh.generated.h"
 
@@ -162,19 +164,19 @@ public:
 	const TArray<FIntVector>& GetTriangleIndices() const { return TriangleIndices; }
 
 	UFUNCTION()
-	const TArray<FColor>& GetVertexInstanceColors() const { return VertexInstanceColors; }
+	const TArray<FColor>& GetVertexInstanceColors() const { DecodeCompactVertexInstanceData(); return VertexInstanceColors; }
 
 	UFUNCTION()
-	const TArray<FVector>& GetVertexInstanceNormals() const { return VertexInstanceNormals; }
+	const TArray<FVector>& GetVertexInstanceNormals() const { DecodeCompactVertexInstanceData(); return VertexInstanceNormals; }
 
 	UFUNCTION()
-	const TArray<FVector>& GetVertexInstanceUTangents() const { return VertexInstanceUTangents; }
+	const TArray<FVector>& GetVertexInstanceUTangents() const { DecodeCompactVertexInstanceData(); return VertexInstanceUTangents; }
 
 	UFUNCTION()
-	const TArray<FVector>& GetVertexInstanceVTangents() const { return VertexInstanceVTangents; }
+	const TArray<FVector>& GetVertexInstanceVTangents() const { DecodeCompactVertexInstanceData(); return VertexInstanceVTangents; }
 
 	UFUNCTION()
-	const TArray<FVector2D>& GetVertexInstanceUVs() const { return VertexInstanceUVs; }
+	const TArray<FVector2D>& GetVertexInstanceUVs() const { DecodeCompactVertexInstanceData(); return VertexInstanceUVs; }
 
 	UFUNCTION()
 	const TArray<int32>& GetMaterialIDsPerTriangle() const { return MaterialIDsPerTriangle; }
@@ -196,9 +198,25 @@ public:
 	UFUNCTION()
 	bool IsValid(bool bInSkipVertexIndicesCheck=false) const;
 
-	// Custom serialization: we use TArray::BulkSerialize to speed up array serialization
+	// Returns true if the vertex instance data (normals, tangents, colors, UVs) is still in its compact
+	// serialized form and hasn't been decoded yet.
+	bool HasCompactVertexInstanceData() const { return bHasCompactVertexInstanceData; }
+
+	// Custom serialization: we use TArray::BulkSerialize to speed up array serialization.
+	// If enabled in the runtime settings, the vertex instance data is saved in a compact, compressed form
+	// (see EncodeCompactVertexInstanceData) that is only decoded the first time it is accessed.
 	virtual void Serialize(FArchive &InArchive) override;
 
+protected:
+
+	// Decodes the compact vertex instance data loaded by Serialize() into the vertex instance arrays, if needed.
+	// Thread safe: the const getters can trigger the decode from several threads (game and render threads) at once.
+	void DecodeCompactVertexInstanceData() const;
+
+	// Encodes the vertex instance arrays in their compact form:
+	// octahedral normals and tangents, a sign instead of the V tangent, half precision UVs, compressed with zlib.
+	bool EncodeCompactVertexInstanceData(TArray<uint8>& OutCompactData, int32& OutUncompressedSize) const;
+
 protected:
 
 	UPROPERTY()
@@ -254,5 +272,17 @@ protected:
 	/** The materials of the mesh. Index by MaterialID (MaterialIndex). */
 	UPROPERTY()
 	TArray<FStaticMaterial> StaticMaterials;
+
+	/** The compressed compact vertex instance data, if it was loaded in that form and not yet decoded. */
+	TArray<uint8> CompactVertexInstanceData;
+
+	/** The size of CompactVertexInstanceData once uncompressed. */
+	int32 CompactVertexInstanceDataUncompressedSize;
+
+	/** True while CompactVertexInstanceData holds data that has not been decoded into the vertex instance arrays. */
+	FThreadSafeBool bHasCompactVertexInstanceData;
+
+	/** Guards CompactVertexInstanceData and its decoding into the vertex instance arrays. */
+	mutable FCriticalSection CompactVertexInstanceDataLock;
 };
 
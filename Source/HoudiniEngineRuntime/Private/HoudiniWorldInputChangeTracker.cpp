@@ -0,0 +1,493 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniWorldInputChangeTracker.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniInput.h"
+
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ITransaction.h"
+#include "UObject/UObjectGlobals.h"
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineWorldInputSpatialIndexCellSize(
+	TEXT("HoudiniEngine.WorldInputSpatialIndexCellSize"),
+	5000.0f,
+	TEXT("Size (in cm) of the cells of the grid used to find the actors inside world input bound selectors.\n")
+	TEXT("<= 0.0: Disabled, bound selectors iterate on all the actors of the world\n")
+);
+
+// Actors covering more cells than this are not added to the grid, but tested by every query
+static const int32 MaxCellsPerIndexedActor = 512;
+
+// Queries covering more cells than this iterate on the indexed actors instead
+static const int32 MaxCellsPerQuery = 4096;
+
+// Cell coordinates are clamped to this range to avoid overflows with huge bounds
+static const double MaxCellCoordinate = 1 << 20;
+
+FHoudiniWorldInputChangeTracker&
+FHoudiniWorldInputChangeTracker::Get()
+{
+	static FHoudiniWorldInputChangeTracker Instance;
+	return Instance;
+}
+
+FHoudiniWorldInputChangeTracker::FHoudiniWorldInputChangeTracker()
+	: bDelegatesRegistered(false)
+	, CurrentSerial(0)
+	, InvalidationSerial(0)
+{
+}
+
+bool
+FHoudiniWorldInputChangeTracker::IsEnabled()
+{
+	if (!bDelegatesRegistered)
+		bDelegatesRegistered = RegisterDelegates();
+
+	return bDelegatesRegistered;
+}
+
+void
+FHoudiniWorldInputChangeTracker::Shutdown()
+{
+	UnregisterDelegates();
+
+	ActorChangeSerials.Empty();
+	WorldChangeSerials.Empty();
+	InputUpdateSerials.Empty();
+	SpatialIndices.Empty();
+}
+
+bool
+FHoudiniWorldInputChangeTracker::RegisterDelegates()
+{
+#if WITH_EDITOR
+	// Changes are only tracked in the editor: world inputs are not updated in game worlds
+	if (!GIsEditor || IsRunningCommandlet() || !GEngine)
+		return false;
+
+	OnActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FHoudiniWorldInputChangeTracker::OnActorMoved);
+	OnLevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FHoudiniWorldInputChangeTracker::OnLevelActorAdded);
+	OnLevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FHoudiniWorldInputChangeTracker::OnLevelActorDeleted);
+	OnObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FHoudiniWorldInputChangeTracker::OnObjectModified);
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FHoudiniWorldInputChangeTracker::OnObjectPropertyChanged);
+	OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FHoudiniWorldInputChangeTracker::OnObjectTransacted);
+	OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FHoudiniWorldInputChangeTracker::OnWorldCleanup);
+
+	// Changes made before we started listening are unknown
+	InvalidateAll();
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void
+FHoudiniWorldInputChangeTracker::UnregisterDelegates()
+{
+#if WITH_EDITOR
+	if (!bDelegatesRegistered)
+		return;
+
+	if (GEngine)
+	{
+		GEngine->OnActorMoved().Remove(OnActorMovedHandle);
+		GEngine->OnLevelActorAdded().Remove(OnLevelActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(OnLevelActorDeletedHandle);
+	}
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(OnObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(OnObjectTransactedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
+#endif
+
+	bDelegatesRegistered = false;
+}
+
+uint64
+FHoudiniWorldInputChangeTracker::GetInputLastUpdateSerial(const UHoudiniInput* InInput) const
+{
+	const uint64* FoundSerial = InputUpdateSerials.Find(InInput);
+	if (!FoundSerial || *FoundSerial < InvalidationSerial)
+		return 0;
+
+	return *FoundSerial;
+}
+
+void
+FHoudiniWorldInputChangeTracker::SetInputLastUpdateSerial(const UHoudiniInput* InInput, const uint64& InSerial)
+{
+	if (!IsValid(InInput))
+		return;
+
+	InputUpdateSerials.Add(InInput, InSerial);
+}
+
+bool
+FHoudiniWorldInputChangeTracker::HasActorChangedSince(const AActor* InActor, const uint64& InSerial) const
+{
+	if (InSerial == 0)
+		return true;
+
+	const uint64* FoundSerial = ActorChangeSerials.Find(InActor);
+	return FoundSerial && *FoundSerial > InSerial;
+}
+
+bool
+FHoudiniWorldInputChangeTracker::HasWorldChangedSince(const UWorld* InWorld, const uint64& InSerial) const
+{
+	if (InSerial == 0)
+		return true;
+
+	const uint64* FoundSerial = WorldChangeSerials.Find(InWorld);
+	return FoundSerial && *FoundSerial > InSerial;
+}
+
+void
+FHoudiniWorldInputChangeTracker::MarkActorBoundsChanged(AActor* InActor)
+{
+	// Nothing is indexed or cached until the tracker is enabled
+	if (!bDelegatesRegistered)
+		return;
+
+	MarkActorChanged(InActor, false);
+}
+
+void
+FHoudiniWorldInputChangeTracker::OnActorMoved(AActor* InActor)
+{
+	MarkActorChanged(InActor, false);
+}
+
+void
+FHoudiniWorldInputChangeTracker::OnLevelActorAdded(AActor* InActor)
+{
+	MarkActorChanged(InActor, false);
+}
+
+void
+FHoudiniWorldInputChangeTracker::OnLevelActorDeleted(AActor* InActor)
+{
+	MarkActorChanged(InActor, true);
+}
+
+void
+FHoudiniWorldInputChangeTracker::OnObjectModified(UObject* InObject)
+{
+	MarkObjectChanged(InObject);
+}
+
+void
+FHoudiniWorldInputChangeTracker::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InEvent)
+{
+	MarkObjectChanged(InObject);
+}
+
+void
+FHoudiniWorldInputChangeTracker::OnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InEvent)
+{
+	// Catches undo/redo, which don't send modified/property changed notifications
+	MarkObjectChanged(InObject);
+}
+
+void
+FHoudiniWorldInputChangeTracker::OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+	SpatialIndices.Remove(InWorld);
+	WorldChangeSerials.Remove(InWorld);
+
+	// Remove the actors/inputs that have been destroyed
+	for (auto Iter = ActorChangeSerials.CreateIterator(); Iter; ++Iter)
+	{
+		if (!Iter.Key().IsValid())
+			Iter.RemoveCurrent();
+	}
+
+	for (auto Iter = InputUpdateSerials.CreateIterator(); Iter; ++Iter)
+	{
+		if (!Iter.Key().IsValid())
+			Iter.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniWorldInputChangeTracker::MarkObjectChanged(UObject* InObject)
+{
+	if (!InObject)
+		return;
+
+	AActor* Actor = Cast<AActor>(InObject);
+	if (!Actor)
+	{
+		UActorComponent* Component = Cast<UActorComponent>(InObject);
+		Actor = Component ? Component->GetOwner() : InObject->GetTypedOuter<AActor>();
+	}
+
+	if (Actor)
+	{
+		MarkActorChanged(Actor, false);
+	}
+	else if (InObject->IsAsset())
+	{
+		// Assets (meshes, materials...) can be used by any actor: update all the inputs
+		InvalidateAll();
+	}
+}
+
+void
+FHoudiniWorldInputChangeTracker::MarkActorChanged(AActor* InActor, const bool& bRemoved)
+{
+	if (!InActor)
+		return;
+
+	// World inputs are only updated in editor worlds
+	UWorld* World = InActor->GetWorld();
+	if (!World || World->WorldType != EWorldType::Editor)
+		return;
+
+	CurrentSerial++;
+	ActorChangeSerials.Add(InActor, CurrentSerial);
+	WorldChangeSerials.Add(World, CurrentSerial);
+
+	// The actor's bounds will be updated in the index before its next query
+	FActorSpatialIndex* Index = SpatialIndices.Find(World);
+	if (Index)
+	{
+		if (bRemoved)
+		{
+			Index->PendingActors.Remove(InActor);
+			RemoveActorFromSpatialIndex(*Index, InActor);
+		}
+		else
+		{
+			Index->PendingActors.Add(InActor);
+		}
+	}
+}
+
+void
+FHoudiniWorldInputChangeTracker::InvalidateAll()
+{
+	CurrentSerial++;
+	InvalidationSerial = CurrentSerial;
+
+	// All inputs updated before this need a full update, so we don't need the previous changes anymore
+	ActorChangeSerials.Empty();
+	WorldChangeSerials.Empty();
+
+	// The actors' bounds might have changed as well
+	SpatialIndices.Empty();
+}
+
+bool
+FHoudiniWorldInputChangeTracker::GetCellRange(
+	const FActorSpatialIndex& InIndex, const FBox& InBox, FIntVector& OutMin, FIntVector& OutMax) const
+{
+	if (!InBox.IsValid || InIndex.CellSize <= 0.0f)
+		return false;
+
+	auto ToCell = [&InIndex](const double InValue)
+	{
+		return (int32)FMath::Clamp(FMath::FloorToDouble(InValue / InIndex.CellSize), -MaxCellCoordinate, MaxCellCoordinate);
+	};
+
+	OutMin = FIntVector(ToCell(InBox.Min.X), ToCell(InBox.Min.Y), ToCell(InBox.Min.Z));
+	OutMax = FIntVector(ToCell(InBox.Max.X), ToCell(InBox.Max.Y), ToCell(InBox.Max.Z));
+
+	return true;
+}
+
+static int64
+GetNumCellsInRange(const FIntVector& InMin, const FIntVector& InMax)
+{
+	return (int64)(InMax.X - InMin.X + 1) * (int64)(InMax.Y - InMin.Y + 1) * (int64)(InMax.Z - InMin.Z + 1);
+}
+
+void
+FHoudiniWorldInputChangeTracker::BuildSpatialIndex(UWorld* InWorld, FActorSpatialIndex& OutIndex, const float& InCellSize)
+{
+	OutIndex = FActorSpatialIndex();
+	OutIndex.CellSize = InCellSize;
+
+	for (TActorIterator<AActor> ActorItr(InWorld); ActorItr; ++ActorItr)
+		AddActorToSpatialIndex(OutIndex, *ActorItr);
+}
+
+void
+FHoudiniWorldInputChangeTracker::AddActorToSpatialIndex(FActorSpatialIndex& InIndex, AActor* InActor)
+{
+	if (!IsValid(InActor))
+		return;
+
+	const FBox Bounds = InActor->GetComponentsBoundingBox(true);
+	InIndex.ActorBounds.Add(InActor, Bounds);
+
+	FIntVector CellMin, CellMax;
+	if (!GetCellRange(InIndex, Bounds, CellMin, CellMax))
+		return;
+
+	if (GetNumCellsInRange(CellMin, CellMax) > MaxCellsPerIndexedActor)
+	{
+		InIndex.LargeActors.Add(InActor);
+		return;
+	}
+
+	for (int32 X = CellMin.X; X <= CellMax.X; X++)
+	{
+		for (int32 Y = CellMin.Y; Y <= CellMax.Y; Y++)
+		{
+			for (int32 Z = CellMin.Z; Z <= CellMax.Z; Z++)
+				InIndex.Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(InActor);
+		}
+	}
+}
+
+void
+FHoudiniWorldInputChangeTracker::RemoveActorFromSpatialIndex(FActorSpatialIndex& InIndex, const TWeakObjectPtr<AActor>& InActor)
+{
+	FBox Bounds(ForceInit);
+	if (!InIndex.ActorBounds.RemoveAndCopyValue(InActor, Bounds))
+		return;
+
+	if (InIndex.LargeActors.Remove(InActor) > 0)
+		return;
+
+	FIntVector CellMin, CellMax;
+	if (!GetCellRange(InIndex, Bounds, CellMin, CellMax))
+		return;
+
+	for (int32 X = CellMin.X; X <= CellMax.X; X++)
+	{
+		for (int32 Y = CellMin.Y; Y <= CellMax.Y; Y++)
+		{
+			for (int32 Z = CellMin.Z; Z <= CellMax.Z; Z++)
+			{
+				const FIntVector Cell(X, Y, Z);
+				TArray<TWeakObjectPtr<AActor>>* CellActors = InIndex.Cells.Find(Cell);
+				if (!CellActors)
+					continue;
+
+				CellActors->RemoveSingleSwap(InActor);
+				if (CellActors->Num() <= 0)
+					InIndex.Cells.Remove(Cell);
+			}
+		}
+	}
+}
+
+void
+FHoudiniWorldInputChangeTracker::FlushPendingActors(FActorSpatialIndex& InIndex)
+{
+	for (const TWeakObjectPtr<AActor>& PendingActor : InIndex.PendingActors)
+	{
+		RemoveActorFromSpatialIndex(InIndex, PendingActor);
+		AddActorToSpatialIndex(InIndex, PendingActor.Get());
+	}
+
+	InIndex.PendingActors.Empty();
+}
+
+bool
+FHoudiniWorldInputChangeTracker::FindActorsInBounds(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors)
+{
+	OutActors.Empty();
+
+	if (!IsValid(InWorld) || InWorld->WorldType != EWorldType::Editor)
+		return false;
+
+	// The index relies on the change notifications to stay up to date
+	if (!IsEnabled())
+		return false;
+
+	const float CellSize = CVarHoudiniEngineWorldInputSpatialIndexCellSize.GetValueOnAnyThread();
+	if (CellSize <= 0.0f)
+		return false;
+
+	FActorSpatialIndex& Index = SpatialIndices.FindOrAdd(InWorld);
+	if (Index.CellSize != CellSize)
+		BuildSpatialIndex(InWorld, Index, CellSize);
+	else
+		FlushPendingActors(Index);
+
+	TSet<AActor*> FoundActors;
+	auto AddCandidate = [&FoundActors](const TWeakObjectPtr<AActor>& InActor)
+	{
+		AActor* Actor = InActor.Get();
+		if (IsValid(Actor))
+			FoundActors.Add(Actor);
+	};
+
+	for (const FBox& Box : InBoxes)
+	{
+		FIntVector CellMin, CellMax;
+		if (!GetCellRange(Index, Box, CellMin, CellMax))
+			continue;
+
+		if (GetNumCellsInRange(CellMin, CellMax) > MaxCellsPerQuery)
+		{
+			// Cheaper to test the bounds of all the indexed actors
+			for (const auto& Pair : Index.ActorBounds)
+			{
+				if (Pair.Value.IsValid && Pair.Value.Intersect(Box))
+					AddCandidate(Pair.Key);
+			}
+			continue;
+		}
+
+		for (int32 X = CellMin.X; X <= CellMax.X; X++)
+		{
+			for (int32 Y = CellMin.Y; Y <= CellMax.Y; Y++)
+			{
+				for (int32 Z = CellMin.Z; Z <= CellMax.Z; Z++)
+				{
+					const TArray<TWeakObjectPtr<AActor>>* CellActors = Index.Cells.Find(FIntVector(X, Y, Z));
+					if (!CellActors)
+						continue;
+
+					for (const TWeakObjectPtr<AActor>& CellActor : *CellActors)
+						AddCandidate(CellActor);
+				}
+			}
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& LargeActor : Index.LargeActors)
+		AddCandidate(LargeActor);
+
+	OutActors = FoundActors.Array();
+
+	return true;
+}
@@ -0,0 +1,156 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class UWorld;
+class UHoudiniInput;
+struct FPropertyChangedEvent;
+class FTransactionObjectEvent;
+
+// Tracks changes made to the actors of the editor worlds, so that world inputs
+// only need to look at the actors that have been moved or modified since their last update.
+// Changes are recorded from the engine's notifications (actor moved/added/deleted, object modified,
+// property changed, undo/redo) as increasing change serials.
+// The tracker also maintains a grid of the actors' bounds, used to query the actors inside
+// the bound selectors without iterating on every actor of the world.
+class HOUDINIENGINERUNTIME_API FHoudiniWorldInputChangeTracker
+{
+	public:
+
+		static FHoudiniWorldInputChangeTracker& Get();
+
+		// Returns true if the tracker is registered to the engine's notifications.
+		// When this returns false, world inputs should poll all their objects.
+		bool IsEnabled();
+
+		// Unregister from the engine's notifications and clear all the recorded changes
+		void Shutdown();
+
+		// Returns the current change serial
+		uint64 GetCurrentSerial() const { return CurrentSerial; }
+
+		// Returns the serial at which the input was last updated, 0 if it hasn't been updated yet
+		// or if all the inputs need to be fully checked again.
+		uint64 GetInputLastUpdateSerial(const UHoudiniInput* InInput) const;
+		// Stores the serial at which the input has been updated
+		void SetInputLastUpdateSerial(const UHoudiniInput* InInput, const uint64& InSerial);
+
+		// Returns true if the actor has been modified after the given serial
+		bool HasActorChangedSince(const AActor* InActor, const uint64& InSerial) const;
+		// Returns true if any actor of the given world has been modified/added/removed after the given serial
+		bool HasWorldChangedSince(const UWorld* InWorld, const uint64& InSerial) const;
+
+		// Record a change for an actor whose components have been updated without sending notifications,
+		// (like the outputs of a HAC after a cook) so that its bounds are updated in the spatial index
+		// and the bound selectors are evaluated again.
+		void MarkActorBoundsChanged(AActor* InActor);
+
+		// Collect the actors whose bounds might intersect with any of the given boxes.
+		// The actual intersection still has to be tested by the caller.
+		// Returns false if the spatial index can't be used (the caller should then iterate on the world's actors).
+		bool FindActorsInBounds(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors);
+
+	private:
+
+		FHoudiniWorldInputChangeTracker();
+
+		// Uniform grid of the actor bounds of a world
+		struct FActorSpatialIndex
+		{
+			// Cell size used when building the index
+			float CellSize = 0.0f;
+			// Actors in each cell
+			TMap<FIntVector, TArray<TWeakObjectPtr<AActor>>> Cells;
+			// Actors covering too many cells, tested for every query
+			TSet<TWeakObjectPtr<AActor>> LargeActors;
+			// Bounds of each indexed actor, as they were when indexed
+			TMap<TWeakObjectPtr<AActor>, FBox> ActorBounds;
+			// Actors whose bounds need to be updated before the next query
+			TSet<TWeakObjectPtr<AActor>> PendingActors;
+		};
+
+		bool RegisterDelegates();
+		void UnregisterDelegates();
+
+		// Notification handlers
+		void OnActorMoved(AActor* InActor);
+		void OnLevelActorAdded(AActor* InActor);
+		void OnLevelActorDeleted(AActor* InActor);
+		void OnObjectModified(UObject* InObject);
+		void OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InEvent);
+		void OnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InEvent);
+		void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+
+		// Record a change for the actor that owns the given object
+		void MarkObjectChanged(UObject* InObject);
+		void MarkActorChanged(AActor* InActor, const bool& bRemoved);
+
+		// Invalidate all changes, forcing a full update of every world input
+		void InvalidateAll();
+
+		// Index helpers
+		void BuildSpatialIndex(UWorld* InWorld, FActorSpatialIndex& OutIndex, const float& InCellSize);
+		void AddActorToSpatialIndex(FActorSpatialIndex& InIndex, AActor* InActor);
+		void RemoveActorFromSpatialIndex(FActorSpatialIndex& InIndex, const TWeakObjectPtr<AActor>& InActor);
+		void FlushPendingActors(FActorSpatialIndex& InIndex);
+		bool GetCellRange(const FActorSpatialIndex& InIndex, const FBox& InBox, FIntVector& OutMin, FIntVector& OutMax) const;
+
+	private:
+
+		bool bDelegatesRegistered;
+
+		// Serial of the last recorded change
+		uint64 CurrentSerial;
+
+		// Serial of the last full invalidation
+		uint64 InvalidationSerial;
+
+		// Serial of the last change of each actor
+		TMap<TWeakObjectPtr<AActor>, uint64> ActorChangeSerials;
+
+		// Serial of the last change of each world (any actor modified, added or removed)
+		TMap<TWeakObjectPtr<UWorld>, uint64> WorldChangeSerials;
+
+		// Serial at which each input was last updated
+		TMap<TWeakObjectPtr<UHoudiniInput>, uint64> InputUpdateSerials;
+
+		// Spatial index of each world's actors
+		TMap<TWeakObjectPtr<UWorld>, FActorSpatialIndex> SpatialIndices;
+
+		FDelegateHandle OnActorMovedHandle;
+		FDelegateHandle OnLevelActorAddedHandle;
+		FDelegateHandle OnLevelActorDeletedHandle;
+		FDelegateHandle OnObjectModifiedHandle;
+		FDelegateHandle OnObjectPropertyChangedHandle;
+		FDelegateHandle OnObjectTransactedHandle;
+		FDelegateHandle OnWorldCleanupHandle;
+};
@@ -4,8 +4,17 @@
 
 #include "HoudiniRuntimeTests.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniParameter.h"
+#include "HoudiniRuntimeSettings.h"
+#include "HoudiniWorldInputChangeTracker.h"
 #include "Misc/AutomationTest.h"
 
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestAutomation, "Houdini.Runtime.TestAutomation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
 bool HoudiniRuntimeTestAutomation::RunTest(const FString & Parameters)
@@ -14,4 +23,160 @@ bool HoudiniRuntimeTestAutomation::RunTest(const FString & Parameters)
 	return true;
 }
 
+// Checks that parameter edits delay the cook while the coalescing time hasn't elapsed, that explicit recook
+// requests are never delayed, and that only edit-triggered cooks are processed as previews.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeParameterEditCoalescingTest, "Houdini.Runtime.ParameterEditCoalescing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeParameterEditCoalescingTest::RunTest(const FString & Parameters)
+{
+	UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetMutableDefault<UHoudiniRuntimeSettings>();
+	if (!TestNotNull(TEXT("Runtime settings"), HoudiniRuntimeSettings))
+		return false;
+
+	const float PreviousCoalescingTime = HoudiniRuntimeSettings->ParameterEditCoalescingTime;
+	const bool bPreviousEnablePreviewCook = HoudiniRuntimeSettings->bEnablePreviewCookWhileEditing;
+	const float PreviousRefinementDelay = HoudiniRuntimeSettings->PreviewCookRefinementDelay;
+
+	// Long enough for the edit to never settle during the test
+	HoudiniRuntimeSettings->ParameterEditCoalescingTime = 1000.0f;
+	HoudiniRuntimeSettings->bEnablePreviewCookWhileEditing = true;
+	HoudiniRuntimeSettings->PreviewCookRefinementDelay = 0.0f;
+
+	UHoudiniAssetComponent* HAC = NewObject<UHoudiniAssetComponent>();
+	UHoudiniParameter* Parm = UHoudiniParameter::Create(HAC, TEXT("test"));
+	HAC->GetParameters().Add(Parm);
+
+	// Nothing was edited
+	TestEqual(TEXT("No edit time without edits"), HAC->GetLastParameterOrInputEditTime(), 0.0);
+	TestFalse(TEXT("Not waiting without edits"), HAC->IsWaitingForEditsToSettle());
+	TestFalse(TEXT("No preview cook without edits"), HAC->ShouldCookInPreviewMode());
+
+	// A parameter edit delays the cook, which is then a preview
+	Parm->MarkChanged(true);
+	TestTrue(TEXT("Edit time is recorded"), HAC->GetLastParameterOrInputEditTime() > 0.0);
+	TestTrue(TEXT("Waiting after an edit"), HAC->IsWaitingForEditsToSettle());
+	TestTrue(TEXT("Preview cook after an edit"), HAC->ShouldCookInPreviewMode());
+
+	// Explicit recooks are neither delayed nor previewed
+	HAC->SetRecookRequested(true);
+	TestFalse(TEXT("Not waiting when a recook is requested"), HAC->IsWaitingForEditsToSettle());
+	TestFalse(TEXT("No preview cook when a recook is requested"), HAC->ShouldCookInPreviewMode());
+	HAC->SetRecookRequested(false);
+
+	// Requests for final meshes are not previewed
+	HAC->SetNoProxyMeshNextCookRequested(true);
+	TestFalse(TEXT("No preview cook when no proxy is requested"), HAC->ShouldCookInPreviewMode());
+	HAC->SetNoProxyMeshNextCookRequested(false);
+
+	// Edits that don't trigger an update are ignored
+	Parm->SetNeedsToTriggerUpdate(false);
+	TestFalse(TEXT("Not waiting for edits that don't trigger updates"), HAC->IsWaitingForEditsToSettle());
+	Parm->SetNeedsToTriggerUpdate(true);
+
+	// Coalescing is opt-in
+	HoudiniRuntimeSettings->ParameterEditCoalescingTime = 0.0f;
+	TestFalse(TEXT("Not waiting when coalescing is disabled"), HAC->IsWaitingForEditsToSettle());
+
+	// Preview outputs are refined once the refinement delay elapsed
+	TestFalse(TEXT("No refinement without preview outputs"), HAC->NeedPreviewOutputsRefinement());
+	HAC->SetHasPreviewOutputs(true);
+	TestTrue(TEXT("Preview outputs need refinement"), HAC->NeedPreviewOutputsRefinement());
+
+	HoudiniRuntimeSettings->bEnablePreviewCookWhileEditing = false;
+	TestFalse(TEXT("No preview cook when disabled"), HAC->ShouldCookInPreviewMode());
+
+	HoudiniRuntimeSettings->ParameterEditCoalescingTime = PreviousCoalescingTime;
+	HoudiniRuntimeSettings->bEnablePreviewCookWhileEditing = bPreviousEnablePreviewCook;
+	HoudiniRuntimeSettings->PreviewCookRefinementDelay = PreviousRefinementDelay;
+
+	return true;
+}
+
+#if WITH_EDITOR
+// Checks that reconciling an unchanged output node with its component instance doesn't update the Blueprint,
+// and that a changed node only marks the Blueprint as modified, without a structural update (and recompile).
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeBlueprintOutputReconciliationTest, "Houdini.Runtime.BlueprintOutputReconciliation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeBlueprintOutputReconciliationTest::RunTest(const FString & Parameters)
+{
+	UStaticMesh* StaticMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube static mesh"), StaticMesh))
+		return false;
+
+	UStaticMeshComponent* ComponentInstance = NewObject<UStaticMeshComponent>();
+	UStaticMeshComponent* NodeTemplate = NewObject<UStaticMeshComponent>();
+	ComponentInstance->SetStaticMesh(StaticMesh);
+
+	// The output's mesh changed: the node template is updated and the Blueprint modified
+	UHoudiniAssetComponent* ChangedTemplateComponent = NewObject<UHoudiniAssetComponent>();
+	TestTrue(TEXT("Changed node is updated"),
+		UHoudiniAssetBlueprintComponent::UpdateOutputNodeTemplate(ChangedTemplateComponent, ComponentInstance, NodeTemplate));
+	TestEqual(TEXT("Node template mesh"), NodeTemplate->GetStaticMesh(), StaticMesh);
+	TestTrue(TEXT("Changed node modifies the Blueprint"), ChangedTemplateComponent->NeedBlueprintUpdate());
+	TestFalse(TEXT("Changed node doesn't modify the Blueprint's structure"), ChangedTemplateComponent->NeedBlueprintStructureUpdate());
+
+	// Nothing changed since: the node is left as is and the Blueprint isn't modified
+	UHoudiniAssetComponent* UnchangedTemplateComponent = NewObject<UHoudiniAssetComponent>();
+	TestFalse(TEXT("Unchanged node is not updated"),
+		UHoudiniAssetBlueprintComponent::UpdateOutputNodeTemplate(UnchangedTemplateComponent, ComponentInstance, NodeTemplate));
+	TestFalse(TEXT("Unchanged node doesn't modify the Blueprint"), UnchangedTemplateComponent->NeedBlueprintUpdate());
+	TestFalse(TEXT("Unchanged node doesn't modify the Blueprint's structure"), UnchangedTemplateComponent->NeedBlueprintStructureUpdate());
+
+	return true;
+}
+
+// Checks that the world input spatial index picks up the new bounds of an actor whose components were moved
+// without change notifications, like the outputs of a HAC after a cook, once the actor is marked as changed.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeWorldInputSpatialIndexTest, "Houdini.Runtime.WorldInputSpatialIndex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeWorldInputSpatialIndexTest::RunTest(const FString & Parameters)
+{
+	FHoudiniWorldInputChangeTracker& ChangeTracker = FHoudiniWorldInputChangeTracker::Get();
+	if (!ChangeTracker.IsEnabled())
+	{
+		AddInfo(TEXT("World input change tracking is not available, skipping."));
+		return true;
+	}
+
+	UStaticMesh* StaticMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube static mesh"), StaticMesh))
+		return false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	if (!TestNotNull(TEXT("Test world"), World))
+		return false;
+
+	AActor* Actor = World->SpawnActor<AActor>();
+	UStaticMeshComponent* SMC = NewObject<UStaticMeshComponent>(Actor);
+	SMC->SetStaticMesh(StaticMesh);
+	Actor->SetRootComponent(SMC);
+	SMC->RegisterComponent();
+
+	const FVector NearLocation = FVector::ZeroVector;
+	const FVector FarLocation(1000000.0f, 0.0f, 0.0f);
+	auto IsActorFoundAt = [&](const FVector& InLocation)
+	{
+		TArray<AActor*> FoundActors;
+		ChangeTracker.FindActorsInBounds(World, { FBox::BuildAABB(InLocation, FVector(100.0f)) }, FoundActors);
+		return FoundActors.Contains(Actor);
+	};
+
+	// Builds the index
+	ChangeTracker.MarkActorBoundsChanged(Actor);
+	TestTrue(TEXT("Actor found at its initial location"), IsActorFoundAt(NearLocation));
+
+	// Move the output without notifications, then mark it as changed like the output translator does
+	SMC->SetWorldLocation(FarLocation);
+	ChangeTracker.MarkActorBoundsChanged(Actor);
+	TestTrue(TEXT("Actor found at its new location"), IsActorFoundAt(FarLocation));
+	TestFalse(TEXT("Actor no longer found at its initial location"), IsActorFoundAt(NearLocation));
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return true;
+}
+#endif
+
 #endif
\ No newline at end of file